@@ -0,0 +1,301 @@
+// Steady-state allocation check for ChunkManager::Update.
+//
+// Replaces the global operator new to count heap allocations per thread, then
+// drives a headless ChunkManager (null render backend) through:
+//
+//   idle  — stand still after everything in range has loaded. No thread may
+//           allocate, synchronous or multithreaded.
+//   walk  — walk back and forth over a short stretch at walking speed, after
+//           one warm-up lap. The main thread may not allocate: synchronous
+//           meshing reuses pooled mesh buffers. The workers' generation and
+//           mesh buffers are inherent and only reported.
+//
+// Any gated allocation exits with code 2 (run in CI).
+//
+// Usage: SleakAllocCheck [--rd 6] [--workers 2] [--frames 600] [--laps 2]
+//                        [--seed 12345] [--json <out.json>]
+
+#include "World/ChunkManager.hpp"
+#include "World/ChunkRenderBackend.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+// ── Counting allocator ───────────────────────────────────────────────
+
+static std::atomic<uint64_t> g_allocs{0};
+static thread_local uint64_t t_allocs = 0;
+
+static void* CountedAlloc(size_t size) {
+    ++t_allocs;
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    return std::malloc(size ? size : 1);
+}
+
+static void* CountedAlignedAlloc(size_t size, size_t align) {
+    ++t_allocs;
+    g_allocs.fetch_add(1, std::memory_order_relaxed);
+    size = (size + align - 1) / align * align;
+#ifdef _WIN32
+    return _aligned_malloc(size ? size : align, align);
+#else
+    return std::aligned_alloc(align, size ? size : align);
+#endif
+}
+
+// The frees stay out of line: inlined into a delete the compiler can see
+// free() paired with operator new and warns (-Wmismatched-new-delete)
+#ifdef _MSC_VER
+#define ALLOC_NOINLINE __declspec(noinline)
+#else
+#define ALLOC_NOINLINE __attribute__((noinline))
+#endif
+
+ALLOC_NOINLINE static void CountedFree(void* p) {
+    std::free(p);
+}
+
+ALLOC_NOINLINE static void AlignedFree(void* p) {
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+void* operator new(size_t size) {
+    if (void* p = CountedAlloc(size)) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](size_t size) {
+    if (void* p = CountedAlloc(size)) return p;
+    throw std::bad_alloc();
+}
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return CountedAlloc(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return CountedAlloc(size); }
+void* operator new(size_t size, std::align_val_t align) {
+    if (void* p = CountedAlignedAlloc(size, static_cast<size_t>(align))) return p;
+    throw std::bad_alloc();
+}
+void* operator new[](size_t size, std::align_val_t align) {
+    if (void* p = CountedAlignedAlloc(size, static_cast<size_t>(align))) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { CountedFree(p); }
+void operator delete[](void* p) noexcept { CountedFree(p); }
+void operator delete(void* p, size_t) noexcept { CountedFree(p); }
+void operator delete[](void* p, size_t) noexcept { CountedFree(p); }
+void operator delete(void* p, const std::nothrow_t&) noexcept { CountedFree(p); }
+void operator delete[](void* p, const std::nothrow_t&) noexcept { CountedFree(p); }
+void operator delete(void* p, std::align_val_t) noexcept { AlignedFree(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { AlignedFree(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { AlignedFree(p); }
+void operator delete[](void* p, size_t, std::align_val_t) noexcept { AlignedFree(p); }
+
+// ── Scenarios ────────────────────────────────────────────────────────
+
+static constexpr float WALK_SPEED = 4.317f;     // MainScene max walk speed, m/s
+static constexpr float WALK_SPAN = 48.0f;       // three chunks each way
+static constexpr float FRAME_DT = 1.0f / 60.0f;
+static constexpr float EYE_Y = 100.0f;
+
+struct Result {
+    std::string name;
+    bool gated = false;
+    bool gateAllThreads = false;
+    int frames = 0;
+    uint64_t mainAllocs = 0;
+    uint64_t mainMaxFrame = 0;      // worst single frame on the main thread
+    uint64_t allAllocs = 0;         // every thread, including workers
+    bool timedOut = false;
+
+    bool Failed() const {
+        if (!gated) return false;
+        return timedOut || mainAllocs != 0 || (gateAllThreads && allAllocs != 0);
+    }
+};
+
+struct Options {
+    int renderDistance = 6;
+    int workers = 2;
+    int idleFrames = 600;
+    int laps = 2;
+    uint32_t seed = 12345;
+};
+
+static std::unique_ptr<ChunkManager> MakeManager(const Options& opt, NullChunkRenderBackend& backend,
+                                                 bool multithreaded) {
+    auto manager = std::make_unique<ChunkManager>();
+    manager->SetSeed(opt.seed);
+    manager->Initialize(&backend);
+    manager->SetRenderDistance(opt.renderDistance);
+    if (multithreaded) {
+        manager->SetWorkerCount(opt.workers);
+        manager->SetMultithreaded(true);
+    }
+    return manager;
+}
+
+static void Frame(ChunkManager& manager, float x, float z) {
+    manager.Update(x, EYE_Y, z);
+    manager.RenderColumns();
+    manager.RenderWater();
+}
+
+// Holds position until everything in range is loaded (false after 60 s)
+static bool WaitLoaded(ChunkManager& manager, float x, float z) {
+    auto start = std::chrono::steady_clock::now();
+    while (std::chrono::steady_clock::now() - start < std::chrono::seconds(60)) {
+        Frame(manager, x, z);
+        if (manager.IsFullyLoaded()) return true;
+    }
+    return false;
+}
+
+// Position along a back-and-forth walk, `frame` frames in
+static float WalkX(int frame) {
+    float d = static_cast<float>(frame) * FRAME_DT * WALK_SPEED;
+    float lap = 2.0f * WALK_SPAN;
+    float t = d - lap * static_cast<float>(static_cast<int>(d / lap));
+    return 8.0f + (t < WALK_SPAN ? t : lap - t);
+}
+
+static int FramesPerLap() {
+    return static_cast<int>(2.0f * WALK_SPAN / (WALK_SPEED * FRAME_DT)) + 1;
+}
+
+// Counts allocations over `frames` frames of `position(frame)`
+template <typename Position>
+static void Measure(ChunkManager& manager, int first, int frames, Position position, Result& r) {
+    uint64_t allStart = g_allocs.load();
+    uint64_t mainStart = t_allocs;
+    for (int i = first; i < first + frames; ++i) {
+        uint64_t before = t_allocs;
+        Frame(manager, position(i), 8.0f);
+        r.mainMaxFrame = std::max(r.mainMaxFrame, t_allocs - before);
+    }
+    r.mainAllocs = t_allocs - mainStart;
+    r.allAllocs = g_allocs.load() - allStart;
+    r.frames = frames;
+}
+
+static Result RunIdle(const Options& opt, bool multithreaded) {
+    Result r;
+    r.name = multithreaded ? "idle (workers)" : "idle (sync)";
+    r.gated = true;
+    r.gateAllThreads = true;
+
+    NullChunkRenderBackend backend;
+    auto manager = MakeManager(opt, backend, multithreaded);
+    r.timedOut = !WaitLoaded(*manager, 8.0f, 8.0f);
+    for (int i = 0; i < 60; ++i) Frame(*manager, 8.0f, 8.0f);    // settle
+    Measure(*manager, 0, opt.idleFrames, [](int) { return 8.0f; }, r);
+    return r;
+}
+
+static Result RunWalk(const Options& opt, bool multithreaded) {
+    Result r;
+    r.name = multithreaded ? "walk (workers)" : "walk (sync)";
+    r.gated = true;
+
+    NullChunkRenderBackend backend;
+    auto manager = MakeManager(opt, backend, multithreaded);
+    r.timedOut = !WaitLoaded(*manager, WalkX(0), 8.0f);
+
+    // Warm-up lap: first visits fill the column caches and size the pools
+    int lap = FramesPerLap();
+    for (int i = 0; i < lap; ++i) Frame(*manager, WalkX(i), 8.0f);
+    Measure(*manager, lap, lap * opt.laps, WalkX, r);
+    return r;
+}
+
+// ── Main ─────────────────────────────────────────────────────────────
+
+int main(int argc, char** argv) {
+    Options opt;
+    std::string jsonPath;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--rd") == 0 && i + 1 < argc) {
+            opt.renderDistance = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--workers") == 0 && i + 1 < argc) {
+            opt.workers = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc) {
+            opt.idleFrames = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--laps") == 0 && i + 1 < argc) {
+            opt.laps = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            opt.seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            jsonPath = argv[++i];
+        } else {
+            std::fprintf(stderr,
+                "Usage: %s [--rd 6] [--workers 2] [--frames 600] [--laps 2]\n"
+                "          [--seed 12345] [--json <out.json>]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (opt.renderDistance < 1 || opt.workers < 1 || opt.idleFrames < 1 || opt.laps < 1) {
+        std::fprintf(stderr, "--rd, --workers, --frames and --laps must be positive\n");
+        return 1;
+    }
+
+    std::printf("ChunkManager steady-state allocations — rd %d, %d workers, seed %u\n\n",
+                opt.renderDistance, opt.workers, opt.seed);
+
+    std::vector<Result> results;
+    results.push_back(RunIdle(opt, false));
+    results.push_back(RunIdle(opt, true));
+    results.push_back(RunWalk(opt, false));
+    results.push_back(RunWalk(opt, true));
+
+    std::printf("%-16s %7s %12s %14s %14s %12s  %s\n",
+                "scenario", "frames", "main allocs", "main/frame", "worst frame", "all threads", "gate");
+    bool failed = false;
+    for (const auto& r : results) {
+        const char* gate = !r.gated ? "report" : r.Failed() ? "FAIL" : "ok";
+        std::printf("%-16s %7d %12llu %14.3f %14llu %12llu  %s%s\n",
+                    r.name.c_str(), r.frames,
+                    static_cast<unsigned long long>(r.mainAllocs),
+                    static_cast<double>(r.mainAllocs) / static_cast<double>(r.frames),
+                    static_cast<unsigned long long>(r.mainMaxFrame),
+                    static_cast<unsigned long long>(r.allAllocs),
+                    gate, r.timedOut ? " (never fully loaded)" : "");
+        failed |= r.Failed();
+    }
+
+    if (!jsonPath.empty()) {
+        std::ofstream f(jsonPath);
+        f << "{\n  \"benchmark\": \"alloc_check\",\n";
+        f << "  \"render_distance\": " << opt.renderDistance << ",\n";
+        f << "  \"workers\": " << opt.workers << ",\n";
+        f << "  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const auto& r = results[i];
+            f << "    {\"scenario\": \"" << r.name << "\", \"frames\": " << r.frames
+              << ", \"main_allocs\": " << r.mainAllocs
+              << ", \"main_worst_frame\": " << r.mainMaxFrame
+              << ", \"all_allocs\": " << r.allAllocs
+              << ", \"gated\": " << (r.gated ? "true" : "false")
+              << ", \"passed\": " << (r.Failed() ? "false" : "true") << "}"
+              << (i + 1 < results.size() ? "," : "") << "\n";
+        }
+        f << "  ]\n}\n";
+        std::printf("\nWrote %s\n", jsonPath.c_str());
+    }
+
+    if (failed) {
+        std::printf("\nFAILED: ChunkManager::Update allocated in a gated steady state\n");
+        return 2;
+    }
+    std::printf("\nSteady state is allocation-free\n");
+    return 0;
+}
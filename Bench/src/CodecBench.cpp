@@ -0,0 +1,165 @@
+// Region codec benchmark — compression ratio and MB/s for every chunk codec
+// over the chunks of real world saves.
+//
+// Usage: SleakCodecBench <saves/World> [more worlds...] [--json <out.json>]
+
+#include "World/ChunkCodec.hpp"
+#include "World/RegionFile.hpp"
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+using Clock = std::chrono::steady_clock;
+
+struct CodecResult {
+    std::string name;
+    size_t encodedBytes = 0;
+    double encodeMBps = 0.0;
+    double decodeMBps = 0.0;
+    bool roundTripOk = true;
+};
+
+// Repeat `fn` until at least `minSeconds` elapsed; returns seconds per pass.
+template <typename Fn>
+static double TimePasses(Fn&& fn, double minSeconds = 0.25) {
+    int passes = 0;
+    auto start = Clock::now();
+    double elapsed = 0.0;
+    do {
+        fn();
+        ++passes;
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    } while (elapsed < minSeconds);
+    return elapsed / passes;
+}
+
+static bool LoadWorldChunks(const std::string& worldPath, std::vector<ChunkSaveData>& out) {
+    fs::path regionDir = fs::path(worldPath) / "regions";
+    std::error_code ec;
+    if (!fs::is_directory(regionDir, ec)) {
+        std::fprintf(stderr, "No regions directory in '%s'\n", worldPath.c_str());
+        return false;
+    }
+    for (auto& entry : fs::directory_iterator(regionDir, ec)) {
+        if (entry.path().extension() != ".dat") continue;
+        std::vector<ChunkSaveData> chunks;
+        if (!RegionFile::Load(entry.path().string(), chunks)) {
+            std::fprintf(stderr, "Skipping unreadable region %s\n", entry.path().string().c_str());
+            continue;
+        }
+        out.insert(out.end(), chunks.begin(), chunks.end());
+    }
+    return true;
+}
+
+static CodecResult BenchCodec(const std::vector<ChunkSaveData>& chunks, int codecIndex) {
+    // codecIndex == -1 benchmarks the per-chunk selector used by RegionFile::Save
+    bool best = codecIndex < 0;
+    CodecResult r;
+    r.name = best ? "Best" : ChunkCodec::GetName(static_cast<ChunkCodecId>(codecIndex));
+
+    std::vector<std::vector<uint8_t>> encoded(chunks.size());
+    std::vector<ChunkCodecId> ids(chunks.size());
+    double rawMB = static_cast<double>(chunks.size() * 4096) / (1024.0 * 1024.0);
+
+    double encSec = TimePasses([&] {
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            const auto& b = chunks[i].blocks;
+            if (best) {
+                ids[i] = ChunkCodec::EncodeBest(b.data(), b.size(), encoded[i]);
+            } else {
+                ids[i] = static_cast<ChunkCodecId>(codecIndex);
+                ChunkCodec::Encode(ids[i], b.data(), b.size(), encoded[i]);
+            }
+        }
+    });
+
+    for (auto& e : encoded) r.encodedBytes += e.size();
+
+    std::array<uint8_t, 4096> scratch;
+    double decSec = TimePasses([&] {
+        for (size_t i = 0; i < chunks.size(); ++i)
+            ChunkCodec::Decode(ids[i], encoded[i].data(), encoded[i].size(),
+                               scratch.data(), scratch.size());
+    });
+
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        if (!ChunkCodec::Decode(ids[i], encoded[i].data(), encoded[i].size(),
+                                scratch.data(), scratch.size()) ||
+            std::memcmp(scratch.data(), chunks[i].blocks.data(), 4096) != 0) {
+            r.roundTripOk = false;
+            break;
+        }
+    }
+
+    r.encodeMBps = rawMB / encSec;
+    r.decodeMBps = rawMB / decSec;
+    return r;
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::string> worlds;
+    std::string jsonPath;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            jsonPath = argv[++i];
+        else
+            worlds.push_back(argv[i]);
+    }
+    if (worlds.empty()) {
+        std::fprintf(stderr, "Usage: %s <saves/World> [...] [--json <out.json>]\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<ChunkSaveData> chunks;
+    for (auto& w : worlds) LoadWorldChunks(w, chunks);
+    if (chunks.empty()) {
+        std::fprintf(stderr, "No chunks found\n");
+        return 1;
+    }
+
+    size_t rawBytes = chunks.size() * 4096;
+    std::printf("%zu chunks, %.2f MB raw\n\n", chunks.size(),
+                static_cast<double>(rawBytes) / (1024.0 * 1024.0));
+    std::printf("%-12s %12s %8s %12s %12s\n", "Codec", "Bytes", "Ratio", "Enc MB/s", "Dec MB/s");
+
+    std::vector<CodecResult> results;
+    for (int c = 0; c < static_cast<int>(ChunkCodecId::COUNT); ++c) {
+        // Delta needs the world generator for its base chunks
+        if (c == static_cast<int>(ChunkCodecId::Delta)) continue;
+        results.push_back(BenchCodec(chunks, c));
+    }
+    results.push_back(BenchCodec(chunks, -1));
+
+    bool allOk = true;
+    for (auto& r : results) {
+        double ratio = static_cast<double>(rawBytes) / static_cast<double>(r.encodedBytes);
+        std::printf("%-12s %12zu %7.2fx %12.1f %12.1f%s\n", r.name.c_str(), r.encodedBytes,
+                    ratio, r.encodeMBps, r.decodeMBps, r.roundTripOk ? "" : "  ROUND-TRIP FAILED");
+        allOk &= r.roundTripOk;
+    }
+
+    if (!jsonPath.empty()) {
+        std::ofstream f(jsonPath);
+        f << "{\n  \"benchmark\": \"region_codec\",\n";
+        f << "  \"chunks\": " << chunks.size() << ",\n";
+        f << "  \"raw_bytes\": " << rawBytes << ",\n  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            auto& r = results[i];
+            f << "    {\"codec\": \"" << r.name << "\", \"bytes\": " << r.encodedBytes
+              << ", \"ratio\": " << static_cast<double>(rawBytes) / static_cast<double>(r.encodedBytes)
+              << ", \"encode_mbps\": " << r.encodeMBps
+              << ", \"decode_mbps\": " << r.decodeMBps << "}"
+              << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        f << "  ]\n}\n";
+    }
+
+    return allOk ? 0 : 2;
+}
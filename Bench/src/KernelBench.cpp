@@ -0,0 +1,261 @@
+// Codec kernel checks and microbenchmarks.
+//
+// Every supported kernel tier is first checked against the scalar reference
+// (CRC32, run scanning, uniform detection, region codec output); any mismatch
+// exits with code 2. Then CRC32 / run-scan throughput and RegionFile save/load
+// throughput are measured per tier.
+//
+// Usage: SleakKernelBench [saves/World ...] [--verify-only] [--json <out.json>]
+// Without a world, a synthetic layered terrain is used for the region numbers.
+
+#include "World/ChunkCodec.hpp"
+#include "World/CodecKernels.hpp"
+#include "World/RegionFile.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+using Clock = std::chrono::steady_clock;
+
+template <typename Fn>
+static double TimePasses(Fn&& fn, double minSeconds = 0.25) {
+    int passes = 0;
+    auto start = Clock::now();
+    double elapsed = 0.0;
+    do {
+        fn();
+        ++passes;
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    } while (elapsed < minSeconds);
+    return elapsed / passes;
+}
+
+static std::vector<KernelTier> SupportedTiers() {
+    std::vector<KernelTier> tiers;
+    for (int t = 0; t <= static_cast<int>(CodecKernels::GetMaxTier()); ++t)
+        tiers.push_back(static_cast<KernelTier>(t));
+    return tiers;
+}
+
+// ── Input chunks ─────────────────────────────────────────────────────
+
+static void LoadWorldChunks(const std::string& worldPath, std::vector<ChunkSaveData>& out) {
+    std::error_code ec;
+    for (auto& entry : fs::directory_iterator(fs::path(worldPath) / "regions", ec)) {
+        if (entry.path().extension() != ".dat") continue;
+        std::vector<ChunkSaveData> chunks;
+        if (RegionFile::Load(entry.path().string(), chunks))
+            out.insert(out.end(), chunks.begin(), chunks.end());
+    }
+}
+
+// Stone / dirt / grass layers under a wavy surface, water below sea level
+static void MakeSyntheticChunks(std::vector<ChunkSaveData>& out) {
+    std::mt19937 rng(1234);
+    for (int cx = 0; cx < 8; ++cx)
+    for (int cz = 0; cz < 8; ++cz)
+    for (int cy = 0; cy < 6; ++cy) {
+        ChunkSaveData c{cx, cy, cz, {}};
+        for (int y = 0; y < 16; ++y)
+        for (int z = 0; z < 16; ++z)
+        for (int x = 0; x < 16; ++x) {
+            int wx = cx * 16 + x, wz = cz * 16 + z, wy = cy * 16 + y;
+            int h = 60 + static_cast<int>(8.0 * std::sin(wx * 0.07) + 6.0 * std::cos(wz * 0.05));
+            uint8_t b = 0;
+            if (wy < h - 4) b = (rng() % 64 == 0) ? 12 : 3;  // stone, rare ore
+            else if (wy < h) b = 2;
+            else if (wy == h) b = 1;
+            else if (wy < 64) b = 9;
+            c.blocks[x + z * 16 + y * 256] = b;
+        }
+        out.push_back(c);
+    }
+}
+
+// ── Equivalence checks ───────────────────────────────────────────────
+
+static int s_failures = 0;
+
+static void Check(bool ok, const char* what, KernelTier tier, size_t a, size_t b) {
+    if (ok) return;
+    if (++s_failures <= 20)
+        std::fprintf(stderr, "MISMATCH %s [%s] (%zu, %zu)\n", what,
+                     CodecKernels::GetTierName(tier), a, b);
+}
+
+static void VerifyKernels(const std::vector<ChunkSaveData>& chunks) {
+    std::mt19937 rng(42);
+    std::vector<uint8_t> buf(4096 + 64);
+    for (auto& b : buf) b = static_cast<uint8_t>(rng());
+
+    const uint8_t check[] = "123456789";
+    for (KernelTier tier : SupportedTiers()) {
+        Check(CodecKernels::CRC32(tier, check, 9) == 0xCBF43926u, "crc32 check value", tier, 9, 0);
+
+        // Every length around the PCLMUL block boundaries at every alignment
+        for (size_t offset = 0; offset < 16; ++offset)
+        for (size_t len = 0; len <= 1100; len += (len < 300 ? 1 : 7)) {
+            uint32_t expect = CodecKernels::CRC32(KernelTier::Scalar, buf.data() + offset, len);
+            Check(CodecKernels::CRC32(tier, buf.data() + offset, len) == expect,
+                  "crc32", tier, offset, len);
+        }
+
+        // A run of 0x5A broken at every position, with every cap
+        std::vector<uint8_t> run(600, 0x5A);
+        for (size_t offset = 0; offset < 8; ++offset)
+        for (size_t breakAt = 0; breakAt < 300; ++breakAt) {
+            std::fill(run.begin(), run.end(), 0x5A);
+            run[offset + breakAt] = 0xA5;
+            for (size_t cap : {size_t(1), size_t(17), size_t(64), size_t(255), size_t(600)}) {
+                size_t size = run.size() - offset;
+                size_t expect = CodecKernels::RunLength(KernelTier::Scalar, run.data() + offset, size, cap);
+                Check(CodecKernels::RunLength(tier, run.data() + offset, size, cap) == expect,
+                      "run length", tier, breakAt, cap);
+            }
+        }
+
+        // Dispatched paths: uniform detection and full codec output
+        CodecKernels::SetTier(tier);
+        std::vector<uint8_t> uniform(4096, 7);
+        Check(CodecKernels::IsUniform(uniform.data(), uniform.size()), "uniform", tier, 0, 0);
+        for (size_t pos : {size_t(1), size_t(15), size_t(31), size_t(2048), size_t(4095)}) {
+            uniform[pos] = 8;
+            Check(!CodecKernels::IsUniform(uniform.data(), uniform.size()), "non-uniform", tier, pos, 0);
+            uniform[pos] = 7;
+        }
+
+        std::vector<uint8_t> encoded, reference;
+        std::array<uint8_t, 4096> decoded;
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            const auto& b = chunks[i].blocks;
+            CodecKernels::SetTier(KernelTier::Scalar);
+            ChunkCodecId refId = ChunkCodec::EncodeBest(b.data(), b.size(), reference);
+            CodecKernels::SetTier(tier);
+            ChunkCodecId id = ChunkCodec::EncodeBest(b.data(), b.size(), encoded);
+            Check(id == refId && encoded == reference, "codec output", tier, i, 0);
+            bool ok = ChunkCodec::Decode(id, encoded.data(), encoded.size(), decoded.data(), 4096) &&
+                      decoded == b;
+            Check(ok, "codec round trip", tier, i, 0);
+        }
+    }
+    CodecKernels::SetTier(CodecKernels::GetMaxTier());
+}
+
+// ── Benchmarks ───────────────────────────────────────────────────────
+
+struct TierResult {
+    KernelTier tier;
+    double crcMBps = 0.0;
+    double runScanMBps = 0.0;
+    double saveMBps = 0.0;
+    double loadMBps = 0.0;
+};
+
+static TierResult BenchTier(KernelTier tier, const std::vector<ChunkSaveData>& chunks,
+                            const std::string& regionPath) {
+    TierResult r;
+    r.tier = tier;
+    CodecKernels::SetTier(tier);
+
+    double rawMB = static_cast<double>(chunks.size() * 4096) / (1024.0 * 1024.0);
+    volatile uint32_t sink = 0;
+
+    r.crcMBps = rawMB / TimePasses([&] {
+        for (auto& c : chunks) sink = sink + CodecKernels::CRC32(c.blocks.data(), 4096);
+    });
+
+    // Walk every run of every chunk, as the RLE encoder does
+    r.runScanMBps = rawMB / TimePasses([&] {
+        for (auto& c : chunks) {
+            for (size_t i = 0; i < 4096;)
+                i += CodecKernels::RunLength(c.blocks.data() + i, 4096 - i, 65535);
+        }
+    });
+
+    // RegionFile stores up to 65535 chunks per file — split into batches
+    std::vector<std::vector<ChunkSaveData>> batches;
+    for (size_t i = 0; i < chunks.size(); i += 1024)
+        batches.emplace_back(chunks.begin() + i, chunks.begin() + std::min(i + 1024, chunks.size()));
+
+    r.saveMBps = rawMB / TimePasses([&] {
+        for (size_t b = 0; b < batches.size(); ++b)
+            RegionFile::Save(regionPath + std::to_string(b), batches[b]);
+    });
+
+    std::vector<ChunkSaveData> loaded;
+    r.loadMBps = rawMB / TimePasses([&] {
+        for (size_t b = 0; b < batches.size(); ++b)
+            RegionFile::Load(regionPath + std::to_string(b), loaded);
+    });
+
+    for (size_t b = 0; b < batches.size(); ++b) {
+        std::error_code ec;
+        fs::remove(regionPath + std::to_string(b), ec);
+    }
+    return r;
+}
+
+int main(int argc, char** argv) {
+    std::vector<std::string> worlds;
+    std::string jsonPath;
+    bool verifyOnly = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            jsonPath = argv[++i];
+        else if (std::strcmp(argv[i], "--verify-only") == 0)
+            verifyOnly = true;
+        else
+            worlds.push_back(argv[i]);
+    }
+
+    std::vector<ChunkSaveData> chunks;
+    for (auto& w : worlds) LoadWorldChunks(w, chunks);
+    if (chunks.empty()) MakeSyntheticChunks(chunks);
+
+    std::printf("Max kernel tier: %s\n", CodecKernels::GetTierName(CodecKernels::GetMaxTier()));
+    VerifyKernels(chunks);
+    if (s_failures > 0) {
+        std::fprintf(stderr, "%d kernel mismatches\n", s_failures);
+        return 2;
+    }
+    std::printf("Kernel equivalence: OK (%zu tiers, %zu chunks)\n\n",
+                SupportedTiers().size(), chunks.size());
+    if (verifyOnly) return 0;
+
+    std::string regionPath = (fs::temp_directory_path() / "sleak_kernel_bench_region").string();
+    std::vector<TierResult> results;
+    for (KernelTier tier : SupportedTiers())
+        results.push_back(BenchTier(tier, chunks, regionPath));
+    CodecKernels::SetTier(CodecKernels::GetMaxTier());
+
+    std::printf("%-14s %12s %12s %12s %12s\n", "Tier", "CRC MB/s", "Runs MB/s", "Save MB/s", "Load MB/s");
+    for (auto& r : results)
+        std::printf("%-14s %12.1f %12.1f %12.1f %12.1f\n", CodecKernels::GetTierName(r.tier),
+                    r.crcMBps, r.runScanMBps, r.saveMBps, r.loadMBps);
+
+    if (!jsonPath.empty()) {
+        std::ofstream f(jsonPath);
+        f << "{\n  \"benchmark\": \"codec_kernels\",\n";
+        f << "  \"chunks\": " << chunks.size() << ",\n  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            auto& r = results[i];
+            f << "    {\"tier\": \"" << CodecKernels::GetTierName(r.tier) << "\""
+              << ", \"crc_mbps\": " << r.crcMBps
+              << ", \"run_scan_mbps\": " << r.runScanMBps
+              << ", \"region_save_mbps\": " << r.saveMBps
+              << ", \"region_load_mbps\": " << r.loadMBps << "}"
+              << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        f << "  ]\n}\n";
+    }
+    return 0;
+}
@@ -0,0 +1,1012 @@
+// Microbenchmarks for the world hot paths: noise, terrain generation per
+// biome, chunk meshing on representative chunks, column mesh merging, the
+// region RLE/CRC codec, distance LOD column meshes, horizon tiles, voxel
+// raycasts, player collision, column frustum culling per kernel tier,
+// draw-list sorting, cave culling (chunk face connectivity and the per-frame
+// visibility graph), the occlusion buffer (raster / test per kernel tier, and
+// on terrain) and the mesh heap sub-allocator.
+//
+// All inputs come from fixed seeds (world seed, RNG seeds and the searched
+// sample locations), so numbers are comparable between runs and commits.
+// The culling and occlusion tiers are also checked against the scalar loops,
+// the occlusion buffer against synthetic scenes with known answers, and the
+// mesh heap against a shadow copy of its buffer under random churn; a
+// failure exits with code 2.
+//
+// Usage: SleakMicroBench [--filter <substring>] [--min-time <seconds>] [--json <out.json>]
+//        SleakMicroBench --help     (lists the benchmark groups)
+
+#include "World/Chunk.hpp"
+#include "World/ChunkManager.hpp"
+#include "World/ChunkVisibility.hpp"
+#include "World/ColumnCull.hpp"
+#include "World/HorizonTerrain.hpp"
+#include "World/LodMesher.hpp"
+#include "World/MeshHeap.hpp"
+#include "World/Noise.hpp"
+#include "World/OcclusionBuffer.hpp"
+#include "World/RegionFile.hpp"
+#include "World/WorldGenerator.hpp"
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static constexpr uint32_t WORLD_SEED = 12345;
+static constexpr uint32_t NOISE_SEED = 1337;
+static constexpr uint32_t RNG_SEED = 42;
+
+static double s_minTime = 0.25;
+static std::string s_filter;
+
+// Repeat `fn` until at least `minSeconds` elapsed; returns seconds per pass.
+template <typename Fn>
+static double TimePasses(Fn&& fn, double minSeconds) {
+    int passes = 0;
+    auto start = Clock::now();
+    double elapsed = 0.0;
+    do {
+        fn();
+        ++passes;
+        elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    } while (elapsed < minSeconds);
+    return elapsed / passes;
+}
+
+struct BenchResult {
+    std::string name;
+    double nsPerOp = 0.0;
+    uint64_t opsPerPass = 0;
+    std::string note;
+};
+
+static std::vector<BenchResult> s_results;
+
+static bool Selected(const std::string& name) {
+    return s_filter.empty() || name.find(s_filter) != std::string::npos;
+}
+
+// Time `fn` (which performs `ops` operations per call) and record ns/op
+template <typename Fn>
+static void Bench(const std::string& name, uint64_t ops, Fn&& fn, const std::string& note = {}) {
+    if (!Selected(name) || ops == 0) return;
+    fn();  // warm-up
+    double sec = TimePasses(fn, s_minTime);
+    BenchResult r{name, sec * 1e9 / static_cast<double>(ops), ops, note};
+    std::printf("%-34s %12.1f ns/op %14.0f op/s  %s\n", r.name.c_str(), r.nsPerOp,
+                1e9 / r.nsPerOp, r.note.c_str());
+    std::fflush(stdout);
+    s_results.push_back(std::move(r));
+}
+
+static volatile float s_sinkF = 0.0f;
+static volatile uint32_t s_sinkU = 0;
+
+// ── Sample chunks ────────────────────────────────────────────────────
+
+static const char* BiomeName(Biome b) {
+    switch (b) {
+        case Biome::Plains: return "plains";
+        case Biome::Forest: return "forest";
+        case Biome::Mountains: return "mountains";
+        case Biome::Desert: return "desert";
+        case Biome::Beach: return "beach";
+        case Biome::Ocean: return "ocean";
+    }
+    return "unknown";
+}
+
+// First chunk column (walking outwards from the origin) whose center and
+// corners are all `biome`; false if none within the search radius.
+static bool FindBiomeColumn(const WorldGenerator& gen, Biome biome, int& outCx, int& outCz) {
+    for (int r = 0; r <= 96; ++r)
+    for (int dx = -r; dx <= r; ++dx)
+    for (int dz = -r; dz <= r; ++dz) {
+        if (std::max(std::abs(dx), std::abs(dz)) != r) continue;
+        int wx = dx * Chunk::SIZE, wz = dz * Chunk::SIZE;
+        if (gen.GetBiome(wx + 8, wz + 8) != biome) continue;
+        if (gen.GetBiome(wx, wz) != biome || gen.GetBiome(wx + 15, wz) != biome ||
+            gen.GetBiome(wx, wz + 15) != biome || gen.GetBiome(wx + 15, wz + 15) != biome)
+            continue;
+        outCx = dx;
+        outCz = dz;
+        return true;
+    }
+    return false;
+}
+
+// A generated chunk together with its six generated neighbors, linked, so
+// GenerateMeshData sees real data across every face.
+struct ChunkNeighborhood {
+    std::unique_ptr<Chunk> center;
+    std::array<std::unique_ptr<Chunk>, 6> neighbors;
+
+    ChunkNeighborhood(const WorldGenerator& gen, int cx, int cy, int cz) {
+        static const struct { BlockFace face; int dx, dy, dz; } dirs[] = {
+            {BlockFace::Top, 0, 1, 0},   {BlockFace::Bottom, 0, -1, 0},
+            {BlockFace::North, 0, 0, 1}, {BlockFace::South, 0, 0, -1},
+            {BlockFace::East, 1, 0, 0},  {BlockFace::West, -1, 0, 0},
+        };
+        center = std::make_unique<Chunk>(cx, cy, cz);
+        gen.Generate(center.get());
+        for (auto& d : dirs) {
+            int ny = cy + d.dy;
+            if (ny < WorldGenerator::MIN_CHUNK_Y || ny > WorldGenerator::MAX_CHUNK_Y) continue;
+            auto n = std::make_unique<Chunk>(cx + d.dx, ny, cz + d.dz);
+            gen.Generate(n.get());
+            center->SetNeighbor(d.face, n.get());
+            neighbors[static_cast<int>(d.face)] = std::move(n);
+        }
+    }
+};
+
+static int CountBlocks(const Chunk& chunk, BlockType type) {
+    const uint8_t* data = chunk.GetBlockData();
+    return static_cast<int>(std::count(data, data + Chunk::VOLUME, static_cast<uint8_t>(type)));
+}
+
+// ── Benchmarks ───────────────────────────────────────────────────────
+
+static void BenchNoise() {
+    Noise noise(NOISE_SEED);
+    constexpr int N = 4096;
+    std::vector<float> xs(N), ys(N), zs(N);
+    std::mt19937 rng(RNG_SEED);
+    std::uniform_real_distribution<float> dist(-4096.0f, 4096.0f);
+    for (int i = 0; i < N; ++i) { xs[i] = dist(rng); ys[i] = dist(rng) * 0.03f; zs[i] = dist(rng); }
+
+    for (int octaves : {1, 4, 6}) {
+        Bench("noise.fbm2d.oct" + std::to_string(octaves), N, [&] {
+            float acc = 0.0f;
+            for (int i = 0; i < N; ++i) acc += noise.FBM2D(xs[i] * 0.01f, zs[i] * 0.01f, octaves);
+            s_sinkF = acc;
+        });
+        Bench("noise.fbm3d.oct" + std::to_string(octaves), N, [&] {
+            float acc = 0.0f;
+            for (int i = 0; i < N; ++i) acc += noise.FBM3D(xs[i] * 0.02f, ys[i], zs[i] * 0.02f, octaves);
+            s_sinkF = acc;
+        });
+    }
+}
+
+static void BenchGenerate(const WorldGenerator& gen) {
+    for (Biome biome : {Biome::Plains, Biome::Forest, Biome::Mountains,
+                        Biome::Desert, Biome::Beach, Biome::Ocean}) {
+        std::string name = std::string("generate.") + BiomeName(biome);
+        if (!Selected(name)) continue;
+        int cx, cz;
+        if (!FindBiomeColumn(gen, biome, cx, cz)) {
+            std::printf("%-34s (no %s column near the origin for seed %u)\n",
+                        name.c_str(), BiomeName(biome), WORLD_SEED);
+            continue;
+        }
+        int maxCy = gen.GetMaxFilledChunkY(cx, cz);
+        // Every non-empty chunk of the column, as streaming would generate them
+        uint64_t chunks = static_cast<uint64_t>(maxCy - WorldGenerator::MIN_CHUNK_Y + 1);
+        Bench(name, chunks, [&] {
+            for (int cy = WorldGenerator::MIN_CHUNK_Y; cy <= maxCy; ++cy) {
+                auto chunk = std::make_unique<Chunk>(cx, cy, cz);
+                gen.Generate(chunk.get());
+                s_sinkU = chunk->GetBlockData()[0];
+            }
+        }, "column (" + std::to_string(cx) + ", " + std::to_string(cz) + "), per chunk");
+    }
+}
+
+static void BenchMeshing(const WorldGenerator& gen) {
+    struct Sample {
+        std::string name;
+        int cx, cy, cz;
+        bool found = false;
+    };
+    std::vector<Sample> samples;
+
+    // flat: plains surface chunk
+    {
+        Sample s{"mesh.flat", 0, 0, 0};
+        int cx, cz;
+        if (FindBiomeColumn(gen, Biome::Plains, cx, cz)) {
+            s = {"mesh.flat", cx, gen.GetSurfaceHeight(cx * 16 + 8, cz * 16 + 8) / Chunk::SIZE, cz, true};
+        }
+        samples.push_back(s);
+    }
+    // caves: the underground chunk with the most carved space among the first
+    // columns (caves below sea level are flooded, so water counts too)
+    {
+        Sample s{"mesh.caves", 0, 0, 0};
+        int bestAir = 0;
+        for (int cx = 0; cx < 12; ++cx)
+        for (int cz = 0; cz < 12; ++cz)
+        for (int cy = 1; cy <= 2; ++cy) {
+            Chunk c(cx, cy, cz);
+            gen.Generate(&c);
+            int air = CountBlocks(c, BlockType::Air) + CountBlocks(c, BlockType::Water);
+            if (air > bestAir && air < Chunk::VOLUME / 2) {
+                bestAir = air;
+                s = {"mesh.caves", cx, cy, cz, true};
+            }
+        }
+        samples.push_back(s);
+    }
+    // forest canopy: the chunk with the most leaves in a forest column
+    {
+        Sample s{"mesh.forest", 0, 0, 0};
+        int cx, cz;
+        if (FindBiomeColumn(gen, Biome::Forest, cx, cz)) {
+            int bestLeaves = -1;
+            for (int dx = 0; dx < 4; ++dx)
+            for (int dz = 0; dz < 4; ++dz)
+            for (int cy = 3; cy <= gen.GetMaxFilledChunkY(cx + dx, cz + dz); ++cy) {
+                Chunk c(cx + dx, cy, cz + dz);
+                gen.Generate(&c);
+                int leaves = CountBlocks(c, BlockType::OakLeaves);
+                if (leaves > bestLeaves) {
+                    bestLeaves = leaves;
+                    s = {"mesh.forest", cx + dx, cy, cz + dz, true};
+                }
+            }
+        }
+        samples.push_back(s);
+    }
+    // ocean: the chunk holding the sea surface
+    {
+        Sample s{"mesh.ocean", 0, 0, 0};
+        int cx, cz;
+        if (FindBiomeColumn(gen, Biome::Ocean, cx, cz))
+            s = {"mesh.ocean", cx, (WorldGenerator::SEA_LEVEL - 1) / Chunk::SIZE, cz, true};
+        samples.push_back(s);
+    }
+
+    for (auto& s : samples) {
+        std::string visName = "visibility" + s.name.substr(s.name.find('.'));
+        if (!Selected(s.name) && !Selected(visName)) continue;
+        if (!s.found) {
+            std::printf("%-34s (no sample chunk for seed %u)\n", s.name.c_str(), WORLD_SEED);
+            continue;
+        }
+        ChunkNeighborhood hood(gen, s.cx, s.cy, s.cz);
+        hood.center->GenerateMeshData();
+        size_t verts = hood.center->GetPendingMeshData().vertices.size()
+                     + hood.center->GetPendingWaterMeshData().vertices.size();
+        char note[96];
+        std::snprintf(note, sizeof(note), "chunk (%d, %d, %d), %zu vertices", s.cx, s.cy, s.cz, verts);
+        Bench(s.name, 1, [&] { hood.center->GenerateMeshData(); }, note);
+
+        // Face connectivity flood fill (part of the mesh job above)
+        uint16_t faces = ChunkVisibility::Compute(hood.center->GetBlockData());
+        std::snprintf(note, sizeof(note), "%d of 15 face pairs connected", std::popcount(faces));
+        Bench(visName, 1, [&] { s_sinkU = ChunkVisibility::Compute(hood.center->GetBlockData()); }, note);
+    }
+}
+
+// The merge step of ChunkManager::RebuildColumnMesh: every chunk mesh of a
+// column appended into one buffer. The merged direction ranges are checked:
+// they cover every index, and each holds only faces of its own direction.
+static bool BenchColumnMerge(const WorldGenerator& gen) {
+    if (!Selected("column.merge")) return true;
+    int cx = 0, cz = 0;
+    FindBiomeColumn(gen, Biome::Forest, cx, cz);
+    int maxCy = gen.GetMaxFilledChunkY(cx, cz);
+
+    std::vector<ChunkMeshData> meshes;
+    size_t totalVerts = 0;
+    for (int cy = WorldGenerator::MIN_CHUNK_Y; cy <= maxCy; ++cy) {
+        ChunkNeighborhood hood(gen, cx, cy, cz);
+        hood.center->GenerateMeshData();
+        totalVerts += hood.center->GetPendingMeshData().vertices.size();
+        meshes.push_back(std::move(hood.center->GetPendingMeshData()));
+    }
+
+    ChunkMeshData merged;
+    char note[96];
+    std::snprintf(note, sizeof(note), "%zu chunks, %zu vertices", meshes.size(), totalVerts);
+    Bench("column.merge", 1, [&] {
+        merged.vertices.clear();
+        merged.indices.clear();
+        for (auto& m : meshes) merged.Append(m);
+        s_sinkU = static_cast<uint32_t>(merged.indices.size());
+    }, note);
+    Bench("column.merge.cold", 1, [&] {
+        ChunkMeshData fresh;
+        for (auto& m : meshes) fresh.Append(m);
+        s_sinkU = static_cast<uint32_t>(fresh.indices.size());
+    }, "fresh buffers each rebuild, as RebuildColumnMesh does");
+
+    static constexpr float NORMALS[6][3] = {{0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}, {1, 0, 0}, {-1, 0, 0}};
+    size_t totalIndices = 0;
+    for (auto& m : meshes) totalIndices += m.indices.size();
+    bool ok = merged.HasFaceRanges() && merged.indices.size() == totalIndices;
+    size_t index = 0;
+    for (int face = 0; ok && face < 6; ++face)
+        for (uint32_t i = 0; ok && i < merged.faceIndexCounts[face]; ++i, ++index) {
+            const WorldVertex& v = merged.vertices[merged.indices[index]];
+            ok = v.nx == NORMALS[face][0] && v.ny == NORMALS[face][1] && v.nz == NORMALS[face][2];
+        }
+    if (!ok) std::printf("  column.merge: direction ranges do not match the faces\n");
+    return ok;
+}
+
+// LodMesher::Build per level on a forest and an ocean column, with its mesh
+// size against the column's full-detail mesh
+static void BenchLod(const WorldGenerator& gen) {
+    if (!Selected("lod.build")) return;
+    auto meshBytes = [](const ChunkMeshData& d) {
+        return d.vertices.size() * sizeof(WorldVertex) + d.indices.size() * sizeof(uint32_t);
+    };
+    for (Biome biome : {Biome::Forest, Biome::Ocean}) {
+        int cx = 0, cz = 0;
+        if (!FindBiomeColumn(gen, biome, cx, cz)) continue;
+
+        size_t fullBytes = 0;
+        for (int cy = WorldGenerator::MIN_CHUNK_Y; cy <= gen.GetMaxFilledChunkY(cx, cz); ++cy) {
+            ChunkNeighborhood hood(gen, cx, cy, cz);
+            hood.center->GenerateMeshData();
+            fullBytes += meshBytes(hood.center->GetPendingMeshData()) +
+                         meshBytes(hood.center->GetPendingWaterMeshData());
+        }
+
+        LodMesher::Scratch scratch;
+        ChunkMeshData opaque, water;
+        for (int level = 1; level <= LodMesher::MAX_LEVEL; ++level) {
+            LodMesher::Build(gen, nullptr, cx, cz, level, scratch, opaque, water);
+            size_t bytes = meshBytes(opaque) + meshBytes(water);
+            char name[48], note[112];
+            std::snprintf(name, sizeof(name), "lod.build.%s.L%d", BiomeName(biome), level);
+            std::snprintf(note, sizeof(note), "%zu vertices, %.1f KB (%.1f%% of %.1f KB full detail)",
+                          opaque.vertices.size() + water.vertices.size(), bytes / 1024.0,
+                          100.0 * static_cast<double>(bytes) / static_cast<double>(fullBytes),
+                          fullBytes / 1024.0);
+            Bench(name, 1, [&] {
+                LodMesher::Build(gen, nullptr, cx, cz, level, scratch, opaque, water);
+                s_sinkU = static_cast<uint32_t>(opaque.indices.size());
+            }, note);
+        }
+    }
+}
+
+// One horizon tile per level band: cost and bytes per chunk covered
+static void BenchHorizon(const WorldGenerator& gen) {
+    if (!Selected("horizon.build")) return;
+    ChunkMeshData land, water;
+    for (int level : {0, 2, 4}) {
+        HorizonTerrain::Tile tile{3, -2, level, {}};
+        HorizonTerrain::Build(gen, tile, land, water);
+        size_t bytes = (land.vertices.size() + water.vertices.size()) * sizeof(WorldVertex) +
+                       (land.indices.size() + water.indices.size()) * sizeof(uint32_t);
+        int chunks = HorizonTerrain::GetTileChunks(level) * HorizonTerrain::GetTileChunks(level);
+        char name[48], note[112];
+        std::snprintf(name, sizeof(name), "horizon.build.L%d", level);
+        std::snprintf(note, sizeof(note), "%zu vertices, %.1f KB for %d chunks (%.1f B/chunk)",
+                      land.vertices.size() + water.vertices.size(), bytes / 1024.0, chunks,
+                      static_cast<double>(bytes) / chunks);
+        Bench(name, 1, [&] {
+            HorizonTerrain::Build(gen, tile, land, water);
+            s_sinkU = static_cast<uint32_t>(land.indices.size());
+        }, note);
+    }
+}
+
+static void BenchRegionCodec(const WorldGenerator& gen) {
+    std::vector<std::array<uint8_t, 4096>> chunks;
+    for (int cx = 0; cx < 4; ++cx)
+    for (int cz = 0; cz < 4; ++cz)
+    for (int cy = 0; cy <= gen.GetMaxFilledChunkY(cx, cz); ++cy) {
+        Chunk c(cx, cy, cz);
+        gen.Generate(&c);
+        std::array<uint8_t, 4096> b;
+        std::memcpy(b.data(), c.GetBlockData(), 4096);
+        chunks.push_back(b);
+    }
+    uint64_t n = chunks.size();
+
+    std::vector<std::vector<uint8_t>> encoded(chunks.size());
+    for (size_t i = 0; i < chunks.size(); ++i)
+        encoded[i] = RegionFile::RLEEncode(chunks[i].data(), 4096);
+
+    Bench("region.rle_encode", n, [&] {
+        for (auto& c : chunks) s_sinkU = static_cast<uint32_t>(RegionFile::RLEEncode(c.data(), 4096).size());
+    }, "per 4 KB chunk");
+    std::array<uint8_t, 4096> out;
+    Bench("region.rle_decode", n, [&] {
+        for (auto& e : encoded) RegionFile::RLEDecode(e.data(), e.size(), out.data(), 4096);
+        s_sinkU = out[0];
+    }, "per 4 KB chunk");
+    Bench("region.crc32", n, [&] {
+        uint32_t acc = 0;
+        for (auto& c : chunks) acc ^= RegionFile::CRC32(c.data(), 4096);
+        s_sinkU = acc;
+    }, "per 4 KB chunk");
+}
+
+static void BenchQueries() {
+    if (!Selected("raycast") && !Selected("collision")) return;
+
+    ChunkManager manager;
+    manager.SetSeed(WORLD_SEED);
+    manager.Initialize(nullptr);
+    manager.SetRenderDistance(3);
+    manager.Update(8.0f, 100.0f, 8.0f);
+    manager.FlushPendingChunks();
+
+    const WorldGenerator& gen = manager.GetGenerator();
+    constexpr int N = 1024;
+    std::mt19937 rng(RNG_SEED);
+    std::uniform_real_distribution<float> pos(-24.0f, 40.0f);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    // Eye positions standing on the surface, looking around
+    std::vector<WorldVec3> eyes(N), dirs(N);
+    for (int i = 0; i < N; ++i) {
+        float x = pos(rng), z = pos(rng);
+        float y = static_cast<float>(gen.GetSurfaceHeight(static_cast<int>(std::floor(x)),
+                                                          static_cast<int>(std::floor(z)))) + 2.62f;
+        eyes[i] = {x, y, z};
+        WorldVec3 d{unit(rng), unit(rng) - 0.3f, unit(rng)};
+        float len = std::sqrt(d.x * d.x + d.y * d.y + d.z * d.z);
+        dirs[i] = {d.x / len, d.y / len, d.z / len};
+    }
+
+    for (float dist : {6.0f, 32.0f}) {
+        char name[48];
+        std::snprintf(name, sizeof(name), "raycast.%dm", static_cast<int>(dist));
+        int hits = 0;
+        for (int i = 0; i < N; ++i) hits += manager.VoxelRaycast(eyes[i], dirs[i], dist).hit;
+        char note[48];
+        std::snprintf(note, sizeof(note), "%d%% hit", hits * 100 / N);
+        Bench(name, N, [&] {
+            int h = 0;
+            for (int i = 0; i < N; ++i) h += manager.VoxelRaycast(eyes[i], dirs[i], dist).hit;
+            s_sinkU = static_cast<uint32_t>(h);
+        }, note);
+    }
+
+    // Player box sunk slightly into the ground (the common per-frame case)
+    std::vector<WorldVec3> sunk(N);
+    for (int i = 0; i < N; ++i) sunk[i] = {eyes[i].x, eyes[i].y - 1.05f, eyes[i].z};
+    Bench("collision.resolve", N, [&] {
+        float acc = 0.0f;
+        for (int i = 0; i < N; ++i)
+            acc += manager.ResolveVoxelCollision(sunk[i], 0.3f, 1.8f, 1.62f).correction.y;
+        s_sinkF = acc;
+    }, "player box 0.6 x 1.8");
+}
+
+static std::string LowerTierName(const char* name) {
+    std::string out;
+    for (const char* c = name; *c; ++c) out += static_cast<char>(std::tolower(static_cast<unsigned char>(*c)));
+    return out;
+}
+
+// Frustum culling of every column in a render distance 32 square (one band
+// per column, as the whole Y range fits one band) from the center, for eight
+// yaws. One op is one full cull, the per-frame cost in ChunkManager.
+static bool BenchCulling() {
+    if (!Selected("cull")) return true;
+
+    constexpr int RD = 32;
+    ColumnBounds bounds;
+    for (int x = -RD; x <= RD; ++x)
+    for (int z = -RD; z <= RD; ++z) {
+        float minX = static_cast<float>(x * Chunk::SIZE), minZ = static_cast<float>(z * Chunk::SIZE);
+        bounds.Append({minX, 0.0f, minZ}, {minX + Chunk::SIZE, 128.0f, minZ + Chunk::SIZE});
+    }
+
+    constexpr int VIEWS = 8;
+    const WorldVec3 eye{8.0f, 80.0f, 8.0f};
+    const float drawDist = static_cast<float>(RD * Chunk::SIZE);
+    std::array<WorldFrustum, VIEWS> frusta;
+    for (int v = 0; v < VIEWS; ++v) {
+        float yaw = static_cast<float>(v) * 0.785398f + 0.3f;
+        frusta[v] = WorldFrustum::FromCamera(eye, {std::cos(yaw), -0.25f, std::sin(yaw)},
+                                             70.0f, 16.0f / 9.0f, 0.1f, drawDist * 1.5f);
+    }
+    auto params = [&](int v) {
+        ColumnCull::Params p;
+        p.frustum = &frusta[v];
+        p.camX = eye.x;
+        p.camZ = eye.z;
+        p.drawDistSq = drawDist * drawDist;
+        p.forceDistSq = 48.0f * 48.0f;
+        return p;
+    };
+
+    std::vector<uint32_t> reference(bounds.PaddedSize()), out(bounds.PaddedSize());
+    bool ok = true;
+    for (KernelTier tier : {KernelTier::Scalar, KernelTier::SIMD128, KernelTier::SIMD256}) {
+        if (tier > CodecKernels::GetMaxTier()) break;
+        std::string name = "cull.rd32." + LowerTierName(ColumnCull::GetTierName(tier));
+
+        size_t visible = 0;
+        for (int v = 0; v < VIEWS; ++v) {
+            size_t n = ColumnCull::Cull(KernelTier::Scalar, bounds, params(v), reference.data());
+            size_t m = ColumnCull::Cull(tier, bounds, params(v), out.data());
+            if (n != m || !std::equal(reference.begin(), reference.begin() + n, out.begin())) {
+                std::printf("%-34s MISMATCH on view %d: %zu visible, scalar %zu\n",
+                            name.c_str(), v, m, n);
+                ok = false;
+            }
+            visible += n;
+        }
+        char note[64];
+        std::snprintf(note, sizeof(note), "%zu columns, %zu visible avg", bounds.Size(), visible / VIEWS);
+        Bench(name, VIEWS, [&] {
+            size_t acc = 0;
+            for (int v = 0; v < VIEWS; ++v) acc += ColumnCull::Cull(tier, bounds, params(v), out.data());
+            s_sinkU = static_cast<uint32_t>(acc);
+        }, note);
+    }
+    return ok;
+}
+
+// Idle ChunkManager::Update (dominated by culling) with the camera in a cave
+// and on the surface, with and without the visibility graph
+static void BenchVisibilityGraph() {
+    if (!Selected("cull.graph")) return;
+
+    ChunkManager manager;
+    manager.SetSeed(WORLD_SEED);
+    manager.Initialize(nullptr);
+    manager.SetRenderDistance(6);
+    manager.Update(8.0f, 100.0f, 8.0f);
+    manager.FlushPendingChunks();
+    for (int i = 0; i < 1000 && !manager.IsFullyLoaded(); ++i) manager.Update(8.0f, 100.0f, 8.0f);
+
+    const WorldGenerator& gen = manager.GetGenerator();
+    float surface = static_cast<float>(gen.GetSurfaceHeight(8, 8));
+    struct View { const char* name; float y; };
+    for (View view : {View{"underground", std::max(surface - 40.0f, 6.0f)}, View{"surface", surface + 2.0f}}) {
+        WorldVec3 eye{8.0f, view.y, 8.0f};
+        manager.SetView(eye, WorldFrustum::FromCamera(eye, {1.0f, -0.1f, 0.3f}, 70.0f, 16.0f / 9.0f,
+                                                      0.1f, 1500.0f));
+        for (bool graph : {false, true}) {
+            manager.SetOcclusionCulling(graph);
+            manager.Update(eye.x, eye.y, eye.z);
+            const auto& t = manager.GetTelemetry();
+            char name[48], note[96];
+            std::snprintf(name, sizeof(name), "cull.graph.%s%s", view.name, graph ? "" : ".off");
+            std::snprintf(note, sizeof(note), "y %.0f, %zu of %zu frustum columns occluded",
+                          view.y, t.occludedColumns, t.frustumColumns);
+            Bench(name, 1, [&] { manager.Update(eye.x, eye.y, eye.z); }, note);
+        }
+    }
+}
+
+// Idle Update with the camera still (last frame's draw order reused) and
+// turning a little each frame (lists partly or fully re-sorted)
+static void BenchDrawSort() {
+    if (!Selected("cull.sort")) return;
+
+    ChunkManager manager;
+    manager.SetSeed(WORLD_SEED);
+    manager.Initialize(nullptr);
+    manager.SetRenderDistance(12);
+    manager.Update(8.0f, 100.0f, 8.0f);
+    manager.FlushPendingChunks();
+    for (int i = 0; i < 3000 && !manager.IsFullyLoaded(); ++i) manager.Update(8.0f, 100.0f, 8.0f);
+
+    const WorldVec3 eye{8.0f, 100.0f, 8.0f};
+    for (float turn : {0.0f, 0.05f}) {
+        float yaw = 0.3f;
+        auto frame = [&] {
+            yaw += turn;
+            manager.SetView(eye, WorldFrustum::FromCamera(eye, {std::cos(yaw), -0.3f, std::sin(yaw)},
+                                                          70.0f, 16.0f / 9.0f, 0.1f, 1500.0f));
+            manager.Update(eye.x, eye.y, eye.z);
+        };
+        frame();
+        uint64_t resorts = manager.GetTelemetry().drawListResorts;
+        float sortMs = 0.0f;
+        double drawn = 0.0, skipped = 0.0;
+        constexpr int FRAMES = 64;
+        for (int i = 0; i < FRAMES; ++i) {
+            frame();
+            sortMs += manager.GetTelemetry().drawSortMs;
+            drawn += static_cast<double>(manager.GetTelemetry().drawnTriangles);
+            skipped += static_cast<double>(manager.GetTelemetry().backfaceSkippedTriangles);
+        }
+        char note[128];
+        std::snprintf(note, sizeof(note), "%zu frustum columns, sort %.1f us/frame, %.2f full sorts/frame, %.0f%% backfaces skipped",
+                      manager.GetTelemetry().frustumColumns, sortMs * 1000.0f / FRAMES,
+                      static_cast<double>(manager.GetTelemetry().drawListResorts - resorts) / FRAMES,
+                      drawn + skipped > 0.0 ? skipped * 100.0 / (drawn + skipped) : 0.0);
+        Bench(turn == 0.0f ? "cull.sort.still" : "cull.sort.turning", 1, frame, note);
+    }
+}
+
+// Occlusion buffer on synthetic scenes with known answers: a wall of column
+// slabs with one slab missing, seen head-on. Boxes behind the wall (and
+// behind the seams between its slabs) are hidden; boxes in front of it,
+// above it, beside it or behind the gap are not. Then raster / test
+// throughput per kernel tier on a field of slabs around the camera, with
+// every tier's buffer and answers checked against the scalar loops.
+static bool BenchOcclusion() {
+    if (!Selected("occlusion")) return true;
+
+    const WorldVec3 eye{8.0f, 70.0f, 0.0f};
+    const float aspect = static_cast<float>(OcclusionBuffer::WIDTH) / OcclusionBuffer::HEIGHT;
+    WorldViewProj wall = WorldViewProj::FromCamera(eye, {0.0f, 0.0f, 1.0f}, 70.0f, aspect);
+    auto drawWall = [](OcclusionBuffer& buffer) {
+        for (int x = -32; x < 48; x += Chunk::SIZE) {
+            if (x == 16) continue;  // the gap
+            buffer.DrawOccluder({static_cast<float>(x), 0.0f, 32.0f},
+                                {static_cast<float>(x + Chunk::SIZE), 90.0f, 48.0f});
+        }
+    };
+    struct Case { const char* name; WorldVec3 min, max; bool visible; };
+    const Case cases[] = {
+        {"behind",        {0.0f, 40.0f, 200.0f},   {16.0f, 66.0f, 216.0f},  false},
+        {"behind seam",   {-17.0f, 60.0f, 200.0f}, {-15.0f, 80.0f, 216.0f}, false},
+        {"far below",     {-8.0f, 0.0f, 400.0f},   {8.0f, 20.0f, 416.0f},   false},
+        {"in front",      {0.0f, 40.0f, 16.0f},    {16.0f, 66.0f, 24.0f},   true},
+        {"above",         {0.0f, 205.0f, 200.0f},  {16.0f, 215.0f, 216.0f}, true},
+        {"beside",        {250.0f, 40.0f, 200.0f}, {266.0f, 66.0f, 216.0f}, true},
+        {"behind gap",    {64.0f, 40.0f, 200.0f},  {72.0f, 66.0f, 216.0f},  true},
+        {"peeks over",    {0.0f, 40.0f, 200.0f},   {16.0f, 200.0f, 216.0f}, true},
+        {"touches near",  {0.0f, 60.0f, -4.0f},    {16.0f, 80.0f, 300.0f},  true},
+    };
+
+    // Field: slabs of random height on the 96 nearest columns around a
+    // camera on the ground, and every column of a render distance 32 square
+    // as a test box
+    std::mt19937 rng(RNG_SEED);
+    std::uniform_int_distribution<int> slabTop(50, 90);
+    const WorldVec3 fieldEye{8.0f, 72.0f, 8.0f};
+    std::vector<std::pair<WorldVec3, WorldVec3>> slabs, boxes;
+    for (int x = -5; x <= 5; ++x)
+    for (int z = -5; z <= 5; ++z) {
+        if (x * x + z * z > 30 || (x == 0 && z == 0)) continue;
+        float minX = static_cast<float>(x * Chunk::SIZE), minZ = static_cast<float>(z * Chunk::SIZE);
+        slabs.push_back({{minX, 30.0f, minZ},
+                         {minX + Chunk::SIZE, static_cast<float>(slabTop(rng)), minZ + Chunk::SIZE}});
+    }
+    for (int x = -32; x <= 32; ++x)
+    for (int z = -32; z <= 32; ++z) {
+        float minX = static_cast<float>(x * Chunk::SIZE), minZ = static_cast<float>(z * Chunk::SIZE);
+        boxes.push_back({{minX, 20.0f, minZ}, {minX + Chunk::SIZE, 70.0f, minZ + Chunk::SIZE}});
+    }
+    WorldViewProj field = WorldViewProj::FromCamera(fieldEye, {1.0f, -0.15f, 0.4f}, 70.0f, aspect);
+    auto drawField = [&](OcclusionBuffer& buffer) {
+        buffer.Begin(field);
+        for (const auto& [min, max] : slabs) buffer.DrawOccluder(min, max);
+    };
+
+    bool ok = true;
+    OcclusionBuffer reference, buffer;
+    reference.SetTier(KernelTier::Scalar);
+    reference.Begin(wall);
+    drawWall(reference);
+    std::vector<uint8_t> referenceAnswers;
+    {
+        OcclusionBuffer fieldRef;
+        fieldRef.SetTier(KernelTier::Scalar);
+        drawField(fieldRef);
+        for (const auto& [min, max] : boxes) referenceAnswers.push_back(fieldRef.IsVisible(min, max));
+    }
+    const size_t pixels = static_cast<size_t>(OcclusionBuffer::WIDTH) * OcclusionBuffer::HEIGHT;
+
+    for (KernelTier tier : {KernelTier::Scalar, KernelTier::SIMD128, KernelTier::SIMD256}) {
+        if (tier > CodecKernels::GetMaxTier()) break;
+        std::string suffix = LowerTierName(OcclusionBuffer::GetTierName(tier));
+        buffer.SetTier(tier);
+
+        buffer.Begin(wall);
+        drawWall(buffer);
+        if (!std::equal(buffer.GetDepth(), buffer.GetDepth() + pixels, reference.GetDepth())) {
+            std::printf("%-34s MISMATCH: wall buffer differs from scalar\n", ("occlusion.scene." + suffix).c_str());
+            ok = false;
+        }
+        for (const Case& c : cases) {
+            if (buffer.IsVisible(c.min, c.max) == c.visible) continue;
+            std::printf("%-34s WRONG: box %s should be %s\n", ("occlusion.scene." + suffix).c_str(),
+                        c.name, c.visible ? "visible" : "hidden");
+            ok = false;
+        }
+
+        drawField(buffer);
+        size_t hidden = 0, mismatched = 0;
+        for (size_t i = 0; i < boxes.size(); ++i) {
+            bool visible = buffer.IsVisible(boxes[i].first, boxes[i].second);
+            hidden += !visible;
+            mismatched += visible != (referenceAnswers[i] != 0);
+        }
+        if (mismatched) {
+            std::printf("%-34s MISMATCH: %zu field answers differ from scalar\n",
+                        ("occlusion.test." + suffix).c_str(), mismatched);
+            ok = false;
+        }
+
+        char note[80];
+        std::snprintf(note, sizeof(note), "%zu slabs, %zu px covered", slabs.size(), buffer.CountCovered());
+        Bench("occlusion.raster." + suffix, slabs.size(), [&] { drawField(buffer); }, note);
+        std::snprintf(note, sizeof(note), "%zu boxes, %zu hidden", boxes.size(), hidden);
+        Bench("occlusion.test." + suffix, boxes.size(), [&] {
+            size_t acc = 0;
+            for (const auto& [min, max] : boxes) acc += buffer.IsVisible(min, max);
+            s_sinkU = static_cast<uint32_t>(acc);
+        }, note);
+    }
+    return ok;
+}
+
+// Idle ChunkManager::Update on terrain with a projection (occlusion buffer
+// on) and without one, the camera just above the surface
+static void BenchOcclusionTerrain() {
+    if (!Selected("cull.occlusion")) return;
+
+    ChunkManager manager;
+    manager.SetSeed(WORLD_SEED);
+    manager.Initialize(nullptr);
+    manager.SetRenderDistance(8);
+    manager.Update(8.0f, 100.0f, 8.0f);
+    manager.FlushPendingChunks();
+    for (int i = 0; i < 1000 && !manager.IsFullyLoaded(); ++i) manager.Update(8.0f, 100.0f, 8.0f);
+
+    float surface = static_cast<float>(manager.GetGenerator().GetSurfaceHeight(8, 8));
+    WorldVec3 eye{8.0f, surface + 2.0f, 8.0f};
+    const float aspect = 16.0f / 9.0f;
+    for (float yaw : {0.3f, 2.0f, 3.7f, 5.2f}) {
+        WorldVec3 dir{std::cos(yaw), -0.1f, std::sin(yaw)};
+        WorldFrustum frustum = WorldFrustum::FromCamera(eye, dir, 70.0f, aspect, 0.1f, 1500.0f);
+        for (bool buffer : {false, true}) {
+            if (buffer)
+                manager.SetView(eye, frustum, WorldViewProj::FromCamera(eye, dir, 70.0f, aspect));
+            else
+                manager.SetView(eye, frustum);
+            manager.Update(eye.x, eye.y, eye.z);
+            const auto& t = manager.GetTelemetry();
+            char name[48], note[112];
+            std::snprintf(name, sizeof(name), "cull.occlusion.yaw%.1f%s", yaw, buffer ? "" : ".off");
+            std::snprintf(note, sizeof(note), "%zu occluders, %zu of %zu frustum columns hidden",
+                          buffer ? t.occluderColumns : 0, buffer ? t.occlusionRejectedColumns : 0,
+                          t.frustumColumns);
+            Bench(name, 1, [&] { manager.Update(eye.x, eye.y, eye.z); }, note);
+        }
+    }
+}
+
+// Mesh heap: random churn checked against a shadow buffer (no overlaps,
+// Compact moves land on free space and keep contents), the heap back to
+// one block once emptied, and a streaming arena that stops making pages
+static bool BenchMeshHeap() {
+    if (!Selected("heap")) return true;
+    bool ok = true;
+    auto fail = [&](const char* what) {
+        if (ok) std::printf("%-34s FAILED: %s\n", "heap", what);
+        ok = false;
+    };
+
+    constexpr uint32_t CAPACITY = 1u << 20;
+    constexpr uint32_t FREE = UINT32_MAX;
+    std::mt19937 rng(RNG_SEED);
+    auto randomSize = [&rng]() {
+        // Log-uniform 1 .. 4096
+        return static_cast<uint32_t>(std::exp2(std::uniform_real_distribution<float>(0.0f, 12.0f)(rng)));
+    };
+
+    MeshHeap heap(CAPACITY);
+    std::vector<uint32_t> cells(CAPACITY, FREE);    // handle owning each element
+    std::vector<uint32_t> live;
+    auto fill = [&](uint32_t handle, uint32_t expect, uint32_t value) {
+        uint32_t offset = heap.GetOffset(handle), size = heap.GetSize(handle);
+        for (uint32_t i = offset; i < offset + size; ++i) {
+            if (cells[i] != expect) { fail("allocation overlaps another or lost its contents"); return; }
+            cells[i] = value;
+        }
+    };
+    auto compact = [&] {
+        MeshHeap::Move move;
+        if (!heap.Compact(move)) return false;
+        for (uint32_t i = 0; i < move.size; ++i) {
+            if (cells[move.from + i] != move.handle || cells[move.to + i] != FREE) {
+                fail("Compact moved onto live data or from the wrong range");
+                return false;
+            }
+            cells[move.to + i] = move.handle;
+            cells[move.from + i] = FREE;
+        }
+        return true;
+    };
+
+    int moves = 0;
+    for (int op = 0; op < 200000 && ok; ++op) {
+        bool allocate = live.empty() || (rng() % 100) < (heap.GetUsed() < CAPACITY * 3 / 4 ? 60u : 40u);
+        if (allocate) {
+            uint32_t handle = heap.Allocate(randomSize());
+            if (handle == MeshHeap::INVALID) continue;
+            fill(handle, FREE, handle);
+            live.push_back(handle);
+        } else {
+            size_t i = rng() % live.size();
+            fill(live[i], live[i], FREE);
+            heap.Free(live[i]);
+            live[i] = live.back();
+            live.pop_back();
+        }
+        if (op % 16 == 0 && compact()) ++moves;
+        if (op % 1024 == 0 && !heap.Validate()) fail("heap structure invalid during churn");
+    }
+    while (ok && compact()) ++moves;
+    if (!heap.Validate()) fail("heap structure invalid after compaction");
+    char note[160];
+    std::snprintf(note, sizeof(note), "churn at %.0f%% used: %d compaction moves, %u free blocks, %.0f%% of free space at the tail",
+                  100.0 * heap.GetUsed() / CAPACITY, moves, heap.GetFreeBlockCount(),
+                  100.0 * heap.GetTailFree() / (CAPACITY - heap.GetUsed()));
+    for (uint32_t handle : live) fill(handle, handle, FREE);
+    for (uint32_t handle : live) heap.Free(handle);
+    live.clear();
+    if (!heap.Validate() || heap.GetFreeBlockCount() != 1 || heap.GetTailFree() != CAPACITY)
+        fail("emptied heap is not one free block");
+
+    // Allocate/free pairs at about 3/4 occupancy
+    std::vector<uint32_t> sizes(4096);
+    for (uint32_t& size : sizes) size = randomSize();
+    heap.Reset(CAPACITY);
+    for (size_t i = 0; heap.GetUsed() < CAPACITY * 3 / 4; ++i) {
+        uint32_t handle = heap.Allocate(sizes[i % sizes.size()]);
+        if (handle == MeshHeap::INVALID) break;
+        live.push_back(handle);
+    }
+    size_t cursor = 0;
+    Bench("heap.alloc_free", 1024, [&] {
+        for (int i = 0; i < 1024; ++i) {
+            size_t slot = (cursor * 7919) % live.size();
+            heap.Free(live[slot]);
+            uint32_t handle = heap.Allocate(sizes[cursor % sizes.size()]);
+            live[slot] = handle != MeshHeap::INVALID ? handle : heap.Allocate(1);
+            ++cursor;
+        }
+    }, note);
+
+    // Streaming: column-sized meshes (opaque and water parts together),
+    // the live set held steady while a few are replaced each frame
+    MeshArena arena;
+    std::vector<MeshArena::Allocation> meshes;
+    std::vector<MeshArena::Move> arenaMoves;
+    auto meshVertices = [&rng]() {
+        return static_cast<uint32_t>(std::exp2(std::uniform_real_distribution<float>(10.0f, 15.5f)(rng)));
+    };
+    auto addMesh = [&] {
+        uint32_t vertices = meshVertices();
+        MeshArena::Allocation allocation;
+        if (arena.Allocate(vertices, vertices / 4 * 6, allocation)) meshes.push_back(allocation);
+    };
+    auto streamFrame = [&] {
+        for (int i = 0; i < 2; ++i) {
+            size_t victim = rng() % meshes.size();
+            arena.Free(meshes[victim]);
+            meshes[victim] = meshes.back();
+            meshes.pop_back();
+        }
+        addMesh();
+        addMesh();
+        arenaMoves.clear();
+        arena.Compact(NullChunkRenderBackend::COMPACT_MOVES, arenaMoves);
+    };
+    while (meshes.size() < 2000) addMesh();
+    for (int frame = 0; frame < 2000; ++frame) streamFrame();
+    uint64_t pagesBefore = arena.GetPagesCreated(), movesBefore = arena.GetMoves();
+    constexpr int STREAM_FRAMES = 20000;
+    for (int frame = 0; frame < STREAM_FRAMES; ++frame) streamFrame();
+    uint64_t newPages = arena.GetPagesCreated() - pagesBefore;
+    std::snprintf(note, sizeof(note), "%u pages, %llu made while streaming %d frames, %.2f moves/frame",
+                  arena.GetLivePages(), static_cast<unsigned long long>(newPages), STREAM_FRAMES,
+                  static_cast<double>(arena.GetMoves() - movesBefore) / STREAM_FRAMES);
+    if (newPages * 1000 > STREAM_FRAMES) fail("streaming arena keeps making pages");
+    for (uint32_t page = 0; page < arena.GetPageSlots(); ++page)
+        if (arena.IsPageLive(page) && (!arena.GetVertexHeap(page).Validate() || !arena.GetIndexHeap(page).Validate()))
+            fail("arena page heap invalid");
+    Bench("heap.arena.frame", 1, streamFrame, note);
+    return ok;
+}
+
+static void PrintUsage(FILE* out) {
+    std::fprintf(out,
+        "Usage: SleakMicroBench [--filter <substring>] [--min-time <s>] [--json <out.json>]\n"
+        "\n"
+        "  --filter <substring>  run only benchmarks whose name contains it (e.g. mesh, cull.sort)\n"
+        "  --min-time <s>        minimum time per benchmark (default 0.25)\n"
+        "  --json <out.json>     also write the results as JSON\n"
+        "\n"
+        "Benchmarks (fixed seeds; a failed check exits with code 2):\n"
+        "  noise.*          2D / 3D FBM noise per octave count\n"
+        "  generate.*       terrain generation per biome\n"
+        "  mesh.*           chunk meshing: flat, caves, forest canopy, ocean\n"
+        "  visibility.*     chunk face connectivity of the same chunks\n"
+        "  column.merge*    column mesh merging; direction ranges checked\n"
+        "  lod.build.*      LOD column builds per biome and level, size against full detail\n"
+        "  horizon.build.*  horizon tile builds per level, bytes per chunk covered\n"
+        "  region.*         region RLE encode / decode and CRC32\n"
+        "  raycast.*        voxel raycasts per distance\n"
+        "  collision.*      player collision\n"
+        "  cull.rd32.*      column frustum culling at render distance 32 per SIMD tier\n"
+        "                   (scalar, SSE2 / NEON, AVX2), checked against the scalar loop\n"
+        "  cull.sort.*      draw-list sorting, camera still and turning, backfaces skipped\n"
+        "  cull.graph.*     cave-culling visibility graph, underground / surface, on and off\n"
+        "  occlusion.*      occlusion buffer raster / test per SIMD tier on a synthetic\n"
+        "                   wall scene, checked against the scalar loops and known answers\n"
+        "  cull.occlusion.* occlusion culling on terrain at four headings, on and off\n"
+        "  heap.*           mesh heap churn checked against a shadow buffer, and a\n"
+        "                   streaming arena that must stop creating pages\n");
+}
+
+int main(int argc, char** argv) {
+    std::string jsonPath;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc)
+            jsonPath = argv[++i];
+        else if (std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc)
+            s_filter = argv[++i];
+        else if (std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc)
+            s_minTime = std::atof(argv[++i]);
+        else if (std::strcmp(argv[i], "--help") == 0 || std::strcmp(argv[i], "-h") == 0) {
+            PrintUsage(stdout);
+            return 0;
+        } else {
+            PrintUsage(stderr);
+            return 1;
+        }
+    }
+
+    std::printf("World seed %u, noise seed %u, rng seed %u\n\n", WORLD_SEED, NOISE_SEED, RNG_SEED);
+    WorldGenerator gen(WORLD_SEED);
+
+    BenchNoise();
+    BenchGenerate(gen);
+    BenchMeshing(gen);
+    bool mergeOk = BenchColumnMerge(gen);
+    BenchLod(gen);
+    BenchHorizon(gen);
+    BenchRegionCodec(gen);
+    BenchQueries();
+    bool cullOk = BenchCulling();
+    BenchVisibilityGraph();
+    BenchDrawSort();
+    bool occlusionOk = BenchOcclusion();
+    BenchOcclusionTerrain();
+    bool heapOk = BenchMeshHeap();
+
+    if (!jsonPath.empty()) {
+        std::ofstream f(jsonPath);
+        f << "{\n  \"benchmark\": \"world_micro\",\n";
+        f << "  \"world_seed\": " << WORLD_SEED << ",\n  \"results\": [\n";
+        for (size_t i = 0; i < s_results.size(); ++i) {
+            const auto& r = s_results[i];
+            f << "    {\"name\": \"" << r.name << "\""
+              << ", \"ns_per_op\": " << r.nsPerOp
+              << ", \"ops_per_s\": " << 1e9 / r.nsPerOp
+              << ", \"ops_per_pass\": " << r.opsPerPass
+              << ", \"note\": \"" << r.note << "\"}"
+              << (i + 1 < s_results.size() ? ",\n" : "\n");
+        }
+        f << "  ]\n}\n";
+    }
+    if (!mergeOk) {
+        std::printf("\nFAILED: a merged column mesh lost its direction ranges\n");
+        return 2;
+    }
+    if (!cullOk) {
+        std::printf("\nFAILED: a culling tier disagrees with the scalar reference\n");
+        return 2;
+    }
+    if (!occlusionOk) {
+        std::printf("\nFAILED: the occlusion buffer gave a wrong answer or a tier disagrees with scalar\n");
+        return 2;
+    }
+    if (!heapOk) {
+        std::printf("\nFAILED: the mesh heap broke an allocation or its own structure\n");
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,216 @@
+// Worker-count scaling benchmark — loads the full render distance around a
+// fixed spawn with ChunkManager for each worker count and reports generation
+// and meshing throughput, speedup over one worker, and lock contention on the
+// task queue (m_taskMutex) and ready queue (m_readyMutex).
+//
+// Also prints the startup calibration ChunkManager uses for the automatic
+// pool size, so the two can be compared on the same machine.
+//
+// Usage: SleakScalingBench [--workers 1,2,4,8] [--rd 8] [--repeat 3]
+//                          [--fps 60] [--seed 12345] [--json <out.json>]
+// Default worker sweep: 1, 2, 3, 4, 6, 8, ... up to the hardware thread count.
+
+#include "World/ChunkManager.hpp"
+#include "World/ChunkRenderBackend.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static double Seconds(Clock::time_point a, Clock::time_point b) {
+    return std::chrono::duration<double>(b - a).count();
+}
+
+struct ScalingResult {
+    int workers = 0;
+    double loadSec = 0.0;           // median over repeats
+    uint64_t generated = 0;
+    uint64_t meshed = 0;
+    LockStats taskLock;             // summed over repeats
+    LockStats readyLock;
+    bool timedOut = false;
+};
+
+static LockStats Delta(const LockStats& a, const LockStats& b) {
+    return {b.acquisitions - a.acquisitions, b.contended - a.contended, b.waitNs - a.waitNs};
+}
+
+static void Accumulate(LockStats& into, const LockStats& d) {
+    into.acquisitions += d.acquisitions;
+    into.contended += d.contended;
+    into.waitNs += d.waitNs;
+}
+
+static double ContendedPct(const LockStats& s) {
+    return s.acquisitions ? 100.0 * static_cast<double>(s.contended) / static_cast<double>(s.acquisitions) : 0.0;
+}
+
+// One full load around the spawn point; returns seconds (or -1 on timeout)
+static double LoadOnce(int workers, int rd, double fps, uint32_t seed,
+                       ChunkManager::StreamStats& outDelta) {
+    NullChunkRenderBackend backend;
+    auto manager = std::make_unique<ChunkManager>();
+    manager->SetSeed(seed);
+    manager->Initialize(&backend);
+    manager->SetRenderDistance(rd);
+    manager->SetWorkerCount(workers);
+    manager->SetMultithreaded(true);
+
+    ChunkManager::StreamStats before = manager->GetStreamStats();
+    auto start = Clock::now();
+    double elapsed = 0.0;
+    while (true) {
+        auto frameStart = Clock::now();
+        manager->Update(8.0f, 100.0f, 8.0f);
+        if (manager->IsFullyLoaded()) break;
+        elapsed = Seconds(start, Clock::now());
+        if (elapsed > 120.0) return -1.0;
+        if (fps > 0.0)
+            std::this_thread::sleep_until(frameStart + std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(1.0 / fps)));
+    }
+    elapsed = Seconds(start, Clock::now());
+    ChunkManager::StreamStats after = manager->GetStreamStats();
+
+    outDelta.chunksGenerated = after.chunksGenerated - before.chunksGenerated;
+    outDelta.chunksMeshed = after.chunksMeshed - before.chunksMeshed;
+    outDelta.taskLock = Delta(before.taskLock, after.taskLock);
+    outDelta.readyLock = Delta(before.readyLock, after.readyLock);
+    manager->SetMultithreaded(false);
+    return elapsed;
+}
+
+int main(int argc, char** argv) {
+    std::vector<int> workerCounts;
+    int rd = 8, repeat = 3;
+    double fps = 60.0;
+    uint32_t seed = 12345;
+    std::string jsonPath;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* a = argv[i];
+        const char* v = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if (!v) {
+            std::fprintf(stderr, "Missing value for %s\n", a);
+            return 1;
+        }
+        ++i;
+        if (std::strcmp(a, "--workers") == 0) {
+            for (const char* p = v; *p; ) {
+                workerCounts.push_back(std::atoi(p));
+                while (*p && *p != ',') ++p;
+                if (*p == ',') ++p;
+            }
+        } else if (std::strcmp(a, "--rd") == 0) {
+            rd = std::atoi(v);
+        } else if (std::strcmp(a, "--repeat") == 0) {
+            repeat = std::max(1, std::atoi(v));
+        } else if (std::strcmp(a, "--fps") == 0) {
+            fps = std::atof(v);
+        } else if (std::strcmp(a, "--seed") == 0) {
+            seed = static_cast<uint32_t>(std::strtoul(v, nullptr, 10));
+        } else if (std::strcmp(a, "--json") == 0) {
+            jsonPath = v;
+        } else {
+            std::fprintf(stderr, "Usage: SleakScalingBench [--workers 1,2,4,8] [--rd 8] [--repeat 3] "
+                                 "[--fps 60] [--seed 12345] [--json <out.json>]\n");
+            return 1;
+        }
+    }
+
+    int hw = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+    if (workerCounts.empty()) {
+        for (int n = 1; n <= hw; n = (n < 4) ? n + 1 : n + n / 2)
+            workerCounts.push_back(n);
+        if (workerCounts.back() != hw) workerCounts.push_back(hw);
+    }
+    workerCounts.erase(std::remove_if(workerCounts.begin(), workerCounts.end(),
+                                      [](int n) { return n < 1; }), workerCounts.end());
+
+    // ── Startup calibration (what automatic mode would pick) ──
+    auto c0 = Clock::now();
+    const auto& calib = ChunkManager::CalibrateWorkers();
+    double calibSec = Seconds(c0, Clock::now());
+    std::printf("Hardware threads: %d\n", hw);
+    std::printf("Calibration (%.0f ms): ", calibSec * 1000.0);
+    for (const auto& [n, rate] : calib.chunksPerSec) std::printf("%d:%.0f/s  ", n, rate);
+    std::printf("-> %d workers\n\n", calib.chosen);
+
+    // ── Sweep ──
+    std::printf("Full load at RD %d, seed %u, median of %d, %.0f fps main thread\n", rd, seed, repeat, fps);
+    std::printf("%7s %9s %10s %10s %8s %6s | %10s %9s | %10s %9s\n",
+                "workers", "load s", "gen/s", "mesh/s", "speedup", "eff",
+                "task cont", "task ms", "ready cont", "ready ms");
+
+    std::vector<ScalingResult> results;
+    for (int workers : workerCounts) {
+        ScalingResult r;
+        r.workers = workers;
+        std::vector<double> times;
+        for (int rep = 0; rep < repeat; ++rep) {
+            ChunkManager::StreamStats d;
+            double t = LoadOnce(workers, rd, fps, seed, d);
+            if (t < 0.0) { r.timedOut = true; break; }
+            times.push_back(t);
+            r.generated = d.chunksGenerated;
+            r.meshed = d.chunksMeshed;
+            Accumulate(r.taskLock, d.taskLock);
+            Accumulate(r.readyLock, d.readyLock);
+        }
+        if (r.timedOut) {
+            std::printf("%7d  timed out\n", workers);
+            results.push_back(r);
+            continue;
+        }
+        std::sort(times.begin(), times.end());
+        r.loadSec = times[times.size() / 2];
+        results.push_back(r);
+
+        double base = results.front().timedOut ? 0.0 : results.front().loadSec;
+        double speedup = (base > 0.0) ? base / r.loadSec : 0.0;
+        double eff = (results.front().workers > 0) ? speedup * results.front().workers / workers : 0.0;
+        std::printf("%7d %9.3f %10.0f %10.0f %7.2fx %5.0f%% | %9.2f%% %9.2f | %9.2f%% %9.2f\n",
+                    workers, r.loadSec, r.generated / r.loadSec, r.meshed / r.loadSec,
+                    speedup, eff * 100.0,
+                    ContendedPct(r.taskLock), r.taskLock.waitNs / 1e6 / repeat,
+                    ContendedPct(r.readyLock), r.readyLock.waitNs / 1e6 / repeat);
+        std::fflush(stdout);
+    }
+
+    if (!jsonPath.empty()) {
+        std::ofstream f(jsonPath);
+        f << "{\n  \"benchmark\": \"worker_scaling\",\n";
+        f << "  \"hardware_threads\": " << hw << ",\n  \"render_distance\": " << rd
+          << ",\n  \"seed\": " << seed << ",\n  \"repeat\": " << repeat << ",\n";
+        f << "  \"calibration\": {\"chosen\": " << calib.chosen << ", \"seconds\": " << calibSec
+          << ", \"chunks_per_s\": [";
+        for (size_t i = 0; i < calib.chunksPerSec.size(); ++i)
+            f << (i ? ", " : "") << "[" << calib.chunksPerSec[i].first << ", " << calib.chunksPerSec[i].second << "]";
+        f << "]},\n  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const auto& r = results[i];
+            f << "    {\"workers\": " << r.workers
+              << ", \"load_s\": " << r.loadSec
+              << ", \"chunks_generated_per_s\": " << (r.loadSec > 0 ? r.generated / r.loadSec : 0.0)
+              << ", \"chunks_meshed_per_s\": " << (r.loadSec > 0 ? r.meshed / r.loadSec : 0.0)
+              << ", \"task_lock_acquisitions\": " << r.taskLock.acquisitions / repeat
+              << ", \"task_lock_contended_pct\": " << ContendedPct(r.taskLock)
+              << ", \"task_lock_wait_ms\": " << r.taskLock.waitNs / 1e6 / repeat
+              << ", \"ready_lock_acquisitions\": " << r.readyLock.acquisitions / repeat
+              << ", \"ready_lock_contended_pct\": " << ContendedPct(r.readyLock)
+              << ", \"ready_lock_wait_ms\": " << r.readyLock.waitNs / 1e6 / repeat
+              << ", \"timed_out\": " << (r.timedOut ? "true" : "false") << "}"
+              << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        f << "  ]\n}\n";
+    }
+    return 0;
+}
@@ -0,0 +1,477 @@
+// Headless streaming benchmark — drives ChunkManager::Update along scripted
+// camera paths with the null render backend and reports pipeline throughput,
+// load latency, main-thread Update cost and memory, and how many GPU
+// buffers the mesh heap would have created against the uploads.
+//
+// Scenarios: sprint (straight line at fly-sprint speed), spiral (widening
+// spiral), teleport (long hops, time to reload each), dive (vertical dives
+// through the whole world height while drifting forward).
+//
+// Each run: spawn and wait for full render distance, fly the path for
+// --duration seconds at --fps (0 = unpaced), then stop and wait to settle.
+//
+// Usage: SleakStreamBench [--scenario sprint,spiral,teleport,dive]
+//                         [--rd 8,16] [--workers auto,sync,4]
+//                         [--duration 15] [--fps 60] [--seed 12345]
+//                         [--timeout 60] [--json <out.json>]
+//                         [--trace <trace.json>] [--mesh-budget <MB>]
+//
+// --mesh-budget caps column mesh memory (ChunkManager::SetMeshBudget); the
+// run fails (exit 2) if resident mesh bytes ever pass it.
+// --trace writes the most recent spans of the main thread and the workers
+// (see TraceTimeline) after the last run, for chrome://tracing / Perfetto.
+
+#include "World/ChunkManager.hpp"
+#include "World/ChunkRenderBackend.hpp"
+#include "World/TraceTimeline.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__APPLE__)
+#include <mach/mach.h>
+#else
+#include <unistd.h>
+#endif
+
+using Clock = std::chrono::steady_clock;
+
+static double Seconds(Clock::time_point a, Clock::time_point b) {
+    return std::chrono::duration<double>(b - a).count();
+}
+
+// Resident set size of this process, 0 if unknown
+static size_t CurrentRSSBytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+        return pmc.WorkingSetSize;
+    return 0;
+#elif defined(__APPLE__)
+    mach_task_basic_info info;
+    mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+    if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                  reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS)
+        return info.resident_size;
+    return 0;
+#else
+    FILE* f = std::fopen("/proc/self/statm", "r");
+    if (!f) return 0;
+    unsigned long pages = 0, resident = 0;
+    int n = std::fscanf(f, "%lu %lu", &pages, &resident);
+    std::fclose(f);
+    return (n == 2) ? resident * static_cast<size_t>(sysconf(_SC_PAGESIZE)) : 0;
+#endif
+}
+
+static double Percentile(std::vector<double> v, double p) {
+    if (v.empty()) return 0.0;
+    std::sort(v.begin(), v.end());
+    size_t idx = static_cast<size_t>(p * static_cast<double>(v.size() - 1) + 0.5);
+    return v[std::min(idx, v.size() - 1)];
+}
+
+// ── Camera paths ─────────────────────────────────────────────────────
+
+struct PathPoint {
+    float x, y, z;
+    int hop;    // teleport hop index (0 for continuous paths)
+};
+
+static constexpr float SPRINT_SPEED = 25.0f;    // fly speed 10 * sprint 2.5
+static constexpr float CRUISE_Y = 100.0f;
+static constexpr double HOP_INTERVAL = 4.0;
+static constexpr float HOP_DISTANCE = 4096.0f;
+
+static PathPoint Sprint(double t) {
+    return {static_cast<float>(SPRINT_SPEED * t), CRUISE_Y, 8.0f, 0};
+}
+
+// Archimedean spiral at constant tangential speed: r = r0 + k t,
+// dθ/dt = v / r  =>  θ = (v / k) ln(r / r0)
+static PathPoint Spiral(double t) {
+    const double r0 = 48.0, k = 3.0;
+    double r = r0 + k * t;
+    double theta = (SPRINT_SPEED / k) * std::log(r / r0);
+    return {static_cast<float>(r * std::cos(theta)), CRUISE_Y,
+            static_cast<float>(r * std::sin(theta)), 0};
+}
+
+static PathPoint Teleport(double t) {
+    int hop = static_cast<int>(t / HOP_INTERVAL);
+    return {8.0f + hop * HOP_DISTANCE, CRUISE_Y, 8.0f + hop * HOP_DISTANCE * 0.5f, hop};
+}
+
+// From above the terrain down to the bottom of the world and back every 8 s
+static PathPoint Dive(double t) {
+    const double pi = 3.14159265358979;
+    float y = static_cast<float>(72.0 + 64.0 * std::cos(2.0 * pi * t / 8.0));
+    return {static_cast<float>(5.0 * t), y, 8.0f, 0};
+}
+
+struct Scenario {
+    const char* name;
+    PathPoint (*path)(double);
+};
+
+static const Scenario SCENARIOS[] = {
+    {"sprint", Sprint},
+    {"spiral", Spiral},
+    {"teleport", Teleport},
+    {"dive", Dive},
+};
+
+// ── Runs ─────────────────────────────────────────────────────────────
+
+struct RunConfig {
+    const Scenario* scenario;
+    int renderDistance;
+    int workers;        // -1 = synchronous, 0 = automatic
+    double duration;
+    double fps;
+    double timeout;
+    uint32_t seed;
+    size_t meshBudget;  // bytes, 0 = unlimited
+};
+
+struct RunResult {
+    RunConfig config;
+    int workerThreads = 0;
+    double initialLoadSec = 0.0;
+    uint64_t initialChunks = 0;
+    double pathSec = 0.0;
+    int frames = 0;
+    uint64_t generated = 0;
+    uint64_t meshed = 0;
+    uint64_t columns = 0;
+    double updateP50 = 0.0, updateP99 = 0.0, updateMax = 0.0;  // ms
+    std::vector<double> hopLoadSec;
+    double settleSec = 0.0;
+    size_t peakRSS = 0;         // process RSS, so later runs may inherit allocator slack
+    size_t peakMeshBytes = 0;
+    uint64_t peakUploadFrameBytes = 0;
+    double visibleP50 = 0.0, visibleP95 = 0.0, visibleMax = 0.0;  // ms, request -> first draw
+    float meshesPerChunk = 0.0f;
+    uint64_t evictedColumns = 0;
+    int budgetDetailCap = 0;
+    uint64_t pathUploads = 0;           // CreateMesh calls while flying the path
+    uint64_t pathBuffers = 0;           // GPU buffers the arena made meanwhile
+    uint32_t heapPages = 0;
+    uint64_t heapMoves = 0;
+    bool overBudget = false;
+    bool timedOut = false;
+};
+
+static std::string WorkersLabel(int workers) {
+    if (workers < 0) return "sync";
+    if (workers == 0) return "auto";
+    return std::to_string(workers);
+}
+
+static RunResult Run(const RunConfig& cfg) {
+    RunResult r;
+    r.config = cfg;
+
+    NullChunkRenderBackend backend;
+    auto manager = std::make_unique<ChunkManager>();
+    manager->SetSeed(cfg.seed);
+    manager->Initialize(&backend);
+    manager->SetRenderDistance(cfg.renderDistance);
+    manager->SetMeshBudget(cfg.meshBudget);
+    if (cfg.workers >= 0) {
+        manager->SetWorkerCount(cfg.workers);
+        manager->SetMultithreaded(true);
+    }
+    r.workerThreads = manager->GetWorkerCount();
+
+    auto sample = [&] {
+        r.peakRSS = std::max(r.peakRSS, CurrentRSSBytes());
+        r.peakMeshBytes = std::max(r.peakMeshBytes, backend.GetLiveBytes());
+        if (cfg.meshBudget != 0 && backend.GetLiveBytes() > cfg.meshBudget) r.overBudget = true;
+        r.peakUploadFrameBytes = std::max(r.peakUploadFrameBytes,
+                                          manager->GetTelemetry().uploadBytesLastFrame);
+    };
+    auto frameEnd = [&](Clock::time_point frameStart) {
+        manager->RenderColumns();
+        manager->RenderWater();
+        sample();
+        if (cfg.fps > 0.0)
+            std::this_thread::sleep_until(frameStart + std::chrono::duration_cast<Clock::duration>(
+                std::chrono::duration<double>(1.0 / cfg.fps)));
+    };
+    // Hold position until everything in range is loaded; seconds taken
+    auto waitLoaded = [&](const PathPoint& p) {
+        auto start = Clock::now();
+        while (true) {
+            auto frameStart = Clock::now();
+            manager->Update(p.x, p.y, p.z);
+            frameEnd(frameStart);
+            if (manager->IsFullyLoaded()) break;
+            if (Seconds(start, Clock::now()) > cfg.timeout) {
+                r.timedOut = true;
+                break;
+            }
+        }
+        return Seconds(start, Clock::now());
+    };
+
+    // 1. Spawn
+    r.initialLoadSec = waitLoaded(cfg.scenario->path(0.0));
+    r.initialChunks = manager->GetActiveChunkCount();
+
+    // 2. Fly the path
+    ChunkManager::StreamStats before = manager->GetStreamStats();
+    uint64_t uploadsBefore = backend.GetUploadCount(), buffersBefore = backend.GetBuffersCreated();
+    std::vector<double> updateMs;
+    int currentHop = 0;
+    Clock::time_point hopStart;
+    bool hopPending = false;
+
+    auto pathStart = Clock::now();
+    PathPoint p = cfg.scenario->path(0.0);
+    while (true) {
+        auto frameStart = Clock::now();
+        double t = Seconds(pathStart, frameStart);
+        if (t >= cfg.duration) break;
+        p = cfg.scenario->path(t);
+        if (p.hop != currentHop) {
+            if (hopPending) r.hopLoadSec.push_back(-1.0);  // never finished loading
+            currentHop = p.hop;
+            hopStart = frameStart;
+            hopPending = true;
+        }
+
+        auto u0 = Clock::now();
+        manager->Update(p.x, p.y, p.z);
+        auto u1 = Clock::now();
+        updateMs.push_back(Seconds(u0, u1) * 1000.0);
+        ++r.frames;
+
+        if (hopPending && manager->IsFullyLoaded()) {
+            r.hopLoadSec.push_back(Seconds(hopStart, Clock::now()));
+            hopPending = false;
+        }
+        frameEnd(frameStart);
+    }
+    r.pathSec = Seconds(pathStart, Clock::now());
+    if (hopPending) r.hopLoadSec.push_back(-1.0);
+    ChunkManager::StreamStats after = manager->GetStreamStats();
+    r.generated = after.chunksGenerated - before.chunksGenerated;
+    r.meshed = after.chunksMeshed - before.chunksMeshed;
+    r.columns = after.columnsBuilt - before.columnsBuilt;
+    r.pathUploads = backend.GetUploadCount() - uploadsBefore;
+    r.pathBuffers = backend.GetBuffersCreated() - buffersBefore;
+    r.updateP50 = Percentile(updateMs, 0.50);
+    r.updateP99 = Percentile(updateMs, 0.99);
+    r.updateMax = updateMs.empty() ? 0.0 : *std::max_element(updateMs.begin(), updateMs.end());
+
+    // 3. Stop and let the pipeline catch up
+    r.settleSec = waitLoaded(p);
+
+    const ChunkPipelineTelemetry& t = manager->GetTelemetry();
+    r.visibleP50 = t.timeToVisible.Percentile(0.50);
+    r.visibleP95 = t.timeToVisible.Percentile(0.95);
+    r.visibleMax = t.timeToVisible.GetMaxMs();
+    r.meshesPerChunk = t.meshesPerChunkAvg;
+    r.evictedColumns = t.evictedColumns;
+    r.budgetDetailCap = t.budgetDetailCap;
+    r.heapPages = backend.GetArena().GetLivePages();
+    r.heapMoves = backend.GetArena().GetMoves();
+
+    manager->SetMultithreaded(false);
+    return r;
+}
+
+// ── Main ─────────────────────────────────────────────────────────────
+
+static std::vector<std::string> SplitList(const char* arg) {
+    std::vector<std::string> out;
+    std::string cur;
+    for (const char* c = arg; ; ++c) {
+        if (*c == ',' || *c == '\0') {
+            if (!cur.empty()) out.push_back(cur);
+            cur.clear();
+            if (*c == '\0') break;
+        } else {
+            cur += *c;
+        }
+    }
+    return out;
+}
+
+int main(int argc, char** argv) {
+    std::vector<const Scenario*> scenarios;
+    std::vector<int> renderDistances;
+    std::vector<int> workerCounts;
+    double duration = 15.0, fps = 60.0, timeout = 60.0;
+    uint32_t seed = 12345;
+    std::string jsonPath;
+    std::string tracePath;
+    size_t meshBudget = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        const char* a = argv[i];
+        const char* v = (i + 1 < argc) ? argv[i + 1] : nullptr;
+        if (!v) {
+            std::fprintf(stderr, "Missing value for %s\n", a);
+            return 1;
+        }
+        ++i;
+        if (std::strcmp(a, "--scenario") == 0) {
+            for (auto& name : SplitList(v)) {
+                const Scenario* found = nullptr;
+                for (auto& s : SCENARIOS)
+                    if (name == s.name) found = &s;
+                if (!found) {
+                    std::fprintf(stderr, "Unknown scenario '%s'\n", name.c_str());
+                    return 1;
+                }
+                scenarios.push_back(found);
+            }
+        } else if (std::strcmp(a, "--rd") == 0) {
+            for (auto& s : SplitList(v)) renderDistances.push_back(std::max(1, std::atoi(s.c_str())));
+        } else if (std::strcmp(a, "--workers") == 0) {
+            for (auto& s : SplitList(v))
+                workerCounts.push_back(s == "sync" ? -1 : s == "auto" ? 0 : std::max(1, std::atoi(s.c_str())));
+        } else if (std::strcmp(a, "--duration") == 0) {
+            duration = std::atof(v);
+        } else if (std::strcmp(a, "--fps") == 0) {
+            fps = std::atof(v);
+        } else if (std::strcmp(a, "--timeout") == 0) {
+            timeout = std::atof(v);
+        } else if (std::strcmp(a, "--seed") == 0) {
+            seed = static_cast<uint32_t>(std::strtoul(v, nullptr, 10));
+        } else if (std::strcmp(a, "--json") == 0) {
+            jsonPath = v;
+        } else if (std::strcmp(a, "--trace") == 0) {
+            tracePath = v;
+        } else if (std::strcmp(a, "--mesh-budget") == 0) {
+            meshBudget = static_cast<size_t>(std::max(0.0, std::atof(v)) * 1024.0 * 1024.0);
+        } else {
+            std::fprintf(stderr, "Unknown option %s\n", a);
+            return 1;
+        }
+    }
+    if (scenarios.empty())
+        for (auto& s : SCENARIOS) scenarios.push_back(&s);
+    if (renderDistances.empty()) renderDistances = {8, 16};
+    if (workerCounts.empty()) workerCounts = {0};
+    if (!tracePath.empty() && !TraceTimeline::IsCompiledIn()) {
+        std::fprintf(stderr, "--trace: tracing is compiled out (configure with -DSLEAK_TRACE=ON)\n");
+        return 1;
+    }
+    SLEAK_TRACE_THREAD("Main");
+
+    std::printf("Hardware threads: %u, seed %u, %.0f s per path at %.0f fps\n\n",
+                std::thread::hardware_concurrency(), seed, duration, fps);
+    std::printf("%-9s %4s %7s %9s %9s %9s %9s %8s %8s %8s %9s %8s %8s\n",
+                "Scenario", "RD", "Workers", "Load s", "Gen/s", "Mesh/s", "Cols/s",
+                "p50 ms", "p99 ms", "max ms", "Settle s", "RSS MB", "Mesh MB");
+
+    std::vector<RunResult> results;
+    for (const Scenario* scenario : scenarios)
+    for (int rd : renderDistances)
+    for (int workers : workerCounts) {
+        RunConfig cfg{scenario, rd, workers, duration, fps, timeout, seed, meshBudget};
+        RunResult r = Run(cfg);
+        std::printf("%-9s %4d %7s %9.2f %9.0f %9.0f %9.0f %8.2f %8.2f %8.2f %9.2f %8.0f %8.0f%s\n",
+                    scenario->name, rd, WorkersLabel(workers).c_str(), r.initialLoadSec,
+                    r.generated / r.pathSec, r.meshed / r.pathSec, r.columns / r.pathSec,
+                    r.updateP50, r.updateP99, r.updateMax, r.settleSec,
+                    r.peakRSS / (1024.0 * 1024.0), r.peakMeshBytes / (1024.0 * 1024.0),
+                    r.timedOut ? "  (timed out)" : "");
+        if (!r.hopLoadSec.empty()) {
+            std::printf("          hops:");
+            for (double h : r.hopLoadSec) {
+                if (h < 0.0) std::printf(" --");
+                else std::printf(" %.2fs", h);
+            }
+            std::printf("\n");
+        }
+        std::printf("          time to visible p50 %.0f / p95 %.0f / max %.0f ms, "
+                    "upload peak %.0f KB/frame, %.2f meshes/chunk\n",
+                    r.visibleP50, r.visibleP95, r.visibleMax,
+                    r.peakUploadFrameBytes / 1024.0, r.meshesPerChunk);
+        std::printf("          mesh heap %u pages, %llu defrag moves; on the path %.1f uploads/s, %.2f buffer creations/s\n",
+                    r.heapPages, static_cast<unsigned long long>(r.heapMoves),
+                    r.pathUploads / r.pathSec, r.pathBuffers / r.pathSec);
+        if (meshBudget != 0) {
+            std::printf("          mesh budget %.0f MB: %llu columns evicted", meshBudget / (1024.0 * 1024.0),
+                        static_cast<unsigned long long>(r.evictedColumns));
+            if (r.budgetDetailCap > 0) std::printf(", full detail cut to %d chunks", r.budgetDetailCap);
+            std::printf("%s\n", r.overBudget ? "  (OVER BUDGET)" : "");
+        }
+        std::fflush(stdout);
+        results.push_back(std::move(r));
+    }
+
+    if (!jsonPath.empty()) {
+        std::ofstream f(jsonPath);
+        f << "{\n  \"benchmark\": \"stream_flythrough\",\n";
+        f << "  \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+        f << "  \"seed\": " << seed << ",\n  \"duration_s\": " << duration
+          << ",\n  \"fps\": " << fps << ",\n  \"results\": [\n";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const auto& r = results[i];
+            f << "    {\"scenario\": \"" << r.config.scenario->name << "\""
+              << ", \"render_distance\": " << r.config.renderDistance
+              << ", \"workers\": \"" << WorkersLabel(r.config.workers) << "\""
+              << ", \"worker_threads\": " << r.workerThreads
+              << ", \"time_to_full_rd_s\": " << r.initialLoadSec
+              << ", \"initial_chunks\": " << r.initialChunks
+              << ", \"path_s\": " << r.pathSec
+              << ", \"frames\": " << r.frames
+              << ", \"chunks_generated_per_s\": " << r.generated / r.pathSec
+              << ", \"chunks_meshed_per_s\": " << r.meshed / r.pathSec
+              << ", \"columns_built_per_s\": " << r.columns / r.pathSec
+              << ", \"update_ms_p50\": " << r.updateP50
+              << ", \"update_ms_p99\": " << r.updateP99
+              << ", \"update_ms_max\": " << r.updateMax
+              << ", \"settle_s\": " << r.settleSec
+              << ", \"hop_load_s\": [";
+            for (size_t h = 0; h < r.hopLoadSec.size(); ++h)
+                f << (h ? ", " : "") << r.hopLoadSec[h];
+            f << "]"
+              << ", \"peak_rss_bytes\": " << r.peakRSS
+              << ", \"peak_mesh_bytes\": " << r.peakMeshBytes
+              << ", \"peak_upload_frame_bytes\": " << r.peakUploadFrameBytes
+              << ", \"visible_ms_p50\": " << r.visibleP50
+              << ", \"visible_ms_p95\": " << r.visibleP95
+              << ", \"visible_ms_max\": " << r.visibleMax
+              << ", \"meshes_per_chunk\": " << r.meshesPerChunk
+              << ", \"uploads_per_s\": " << r.pathUploads / r.pathSec
+              << ", \"buffer_creations_per_s\": " << r.pathBuffers / r.pathSec
+              << ", \"heap_pages\": " << r.heapPages
+              << ", \"heap_moves\": " << r.heapMoves
+              << ", \"mesh_budget_bytes\": " << r.config.meshBudget
+              << ", \"evicted_columns\": " << r.evictedColumns
+              << ", \"over_budget\": " << (r.overBudget ? "true" : "false")
+              << ", \"timed_out\": " << (r.timedOut ? "true" : "false") << "}"
+              << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+        f << "  ]\n}\n";
+    }
+
+    if (!tracePath.empty()) {
+        if (!TraceTimeline::WriteChromeTrace(tracePath)) {
+            std::fprintf(stderr, "Failed to write %s\n", tracePath.c_str());
+            return 1;
+        }
+        std::printf("\nTrace written to %s\n", tracePath.c_str());
+    }
+
+    bool failed = false;
+    for (auto& r : results) failed |= r.timedOut || r.overBudget;
+    return failed ? 2 : 0;
+}
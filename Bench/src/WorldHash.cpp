@@ -0,0 +1,417 @@
+// Golden world-hash determinism harness.
+//
+// Generates a fixed set of chunks for a list of seeds through
+// WorldGenerator::Generate, meshes them with their real neighbors, and hashes
+// the block data plus the opaque and water mesh output. The hashes are
+// compared with a recorded golden file; any mismatch exits with code 2.
+//
+// Mesh hashes are order-independent (a multiset hash over triangles with
+// quantized vertex attributes), so reordering vertices, splitting buffers or
+// changing emission order does not trip the check -- changing the geometry,
+// UVs, AO or triangulation does.
+//
+// Usage: SleakWorldHash --golden <file> [--record] [--dump <dir>] [--diff <dir>]
+//   --record      write the current hashes to the golden file
+//   --dump <dir>  save block data + per-column vertex counts of every chunk
+//                 (run on a known-good build to create a diff reference)
+//   --diff <dir>  on mismatch, draw per-chunk diffs against a --dump reference
+
+#include "World/Chunk.hpp"
+#include "World/WorldGenerator.hpp"
+#include <algorithm>
+#include <array>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+// Seeds and chunk columns covered by the golden file. Changing either list
+// requires re-recording with --record.
+static const uint32_t SEEDS[] = {12345, 0, 42, 2654435769u};
+static const struct { int cx, cz; } SITES[] = {
+    {0, 0}, {37, -21}, {-500, 812}, {40001, -39998},
+};
+
+// ── Hashing ──────────────────────────────────────────────────────────
+
+static constexpr uint64_t FNV_OFFSET = 0xcbf29ce484222325ull;
+static constexpr uint64_t FNV_PRIME = 0x100000001b3ull;
+
+static uint64_t Fnv1a(const void* data, size_t size, uint64_t h = FNV_OFFSET) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < size; ++i) { h ^= p[i]; h *= FNV_PRIME; }
+    return h;
+}
+
+// Final avalanche (splitmix64) so summed triangle hashes stay well mixed
+static uint64_t Mix(uint64_t h) {
+    h ^= h >> 30; h *= 0xbf58476d1ce4e5b9ull;
+    h ^= h >> 27; h *= 0x94d049bb133111ebull;
+    return h ^ (h >> 31);
+}
+
+// Vertex attributes quantized to 1/4096 so the hash does not depend on the
+// last bit of float rounding
+static uint64_t HashVertex(const WorldVertex& v) {
+    const float attrs[] = {v.x, v.y, v.z, v.nx, v.ny, v.nz, v.u, v.v, v.r, v.g, v.b, v.a};
+    int32_t q[12];
+    for (int i = 0; i < 12; ++i) q[i] = static_cast<int32_t>(std::lround(attrs[i] * 4096.0f));
+    return Fnv1a(q, sizeof(q));
+}
+
+// Sum + xor of per-triangle hashes; each triangle is rotated to start at its
+// smallest vertex hash so winding is kept but the start vertex is not
+static uint64_t HashMesh(const ChunkMeshData& mesh) {
+    std::vector<uint64_t> vh(mesh.vertices.size());
+    for (size_t i = 0; i < vh.size(); ++i) vh[i] = HashVertex(mesh.vertices[i]);
+
+    uint64_t sum = 0, x = 0;
+    for (size_t i = 0; i + 2 < mesh.indices.size(); i += 3) {
+        uint64_t t[3] = {vh[mesh.indices[i]], vh[mesh.indices[i + 1]], vh[mesh.indices[i + 2]]};
+        int first = static_cast<int>(std::min_element(t, t + 3) - t);
+        uint64_t rot[3] = {t[first], t[(first + 1) % 3], t[(first + 2) % 3]};
+        uint64_t h = Mix(Fnv1a(rot, sizeof(rot)));
+        sum += h;
+        x ^= Mix(h + 0x9e3779b97f4a7c15ull);
+    }
+    return Mix(sum ^ (x * FNV_PRIME) ^ mesh.indices.size());
+}
+
+// ── Chunk records ────────────────────────────────────────────────────
+
+struct ChunkKey {
+    uint32_t seed;
+    int cx, cy, cz;
+    bool operator<(const ChunkKey& o) const {
+        return std::tie(seed, cx, cy, cz) < std::tie(o.seed, o.cx, o.cy, o.cz);
+    }
+};
+
+struct ChunkRecord {
+    uint64_t blockHash = 0, meshHash = 0, waterHash = 0;
+    uint32_t nonAir = 0, vertices = 0, waterVertices = 0;
+};
+
+// Per-chunk reference data written by --dump and read by --diff
+struct ChunkDump {
+    std::array<uint8_t, Chunk::VOLUME> blocks{};
+    std::array<uint32_t, 256> columnVerts{};       // opaque vertices per (x, z) column
+    std::array<uint32_t, 256> columnWaterVerts{};
+};
+
+static std::string DumpName(const ChunkKey& k) {
+    return "s" + std::to_string(k.seed) + "_" + std::to_string(k.cx) + "_" +
+           std::to_string(k.cy) + "_" + std::to_string(k.cz) + ".bin";
+}
+
+// Vertex counts per column: each quad is attributed to the block it belongs
+// to (quad center pushed half a block against its normal)
+static void CountColumnVertices(const ChunkMeshData& mesh, int cx, int cz,
+                                std::array<uint32_t, 256>& out) {
+    out.fill(0);
+    for (size_t i = 0; i + 3 < mesh.vertices.size(); i += 4) {
+        float sx = 0, sz = 0;
+        for (int k = 0; k < 4; ++k) { sx += mesh.vertices[i + k].x; sz += mesh.vertices[i + k].z; }
+        const WorldVertex& v = mesh.vertices[i];
+        int x = static_cast<int>(std::floor(sx * 0.25f - v.nx * 0.5f)) - cx * Chunk::SIZE;
+        int z = static_cast<int>(std::floor(sz * 0.25f - v.nz * 0.5f)) - cz * Chunk::SIZE;
+        x = std::clamp(x, 0, Chunk::SIZE - 1);
+        z = std::clamp(z, 0, Chunk::SIZE - 1);
+        out[z * Chunk::SIZE + x] += 4;
+    }
+}
+
+static bool WriteDump(const fs::path& path, const ChunkDump& d) {
+    std::ofstream f(path, std::ios::binary);
+    if (!f) return false;
+    f.write(reinterpret_cast<const char*>(d.blocks.data()), d.blocks.size());
+    f.write(reinterpret_cast<const char*>(d.columnVerts.data()), sizeof(d.columnVerts));
+    f.write(reinterpret_cast<const char*>(d.columnWaterVerts.data()), sizeof(d.columnWaterVerts));
+    return static_cast<bool>(f);
+}
+
+static bool ReadDump(const fs::path& path, ChunkDump& d) {
+    std::ifstream f(path, std::ios::binary);
+    if (!f) return false;
+    f.read(reinterpret_cast<char*>(d.blocks.data()), d.blocks.size());
+    f.read(reinterpret_cast<char*>(d.columnVerts.data()), sizeof(d.columnVerts));
+    f.read(reinterpret_cast<char*>(d.columnWaterVerts.data()), sizeof(d.columnWaterVerts));
+    return static_cast<bool>(f);
+}
+
+// ── Generation ───────────────────────────────────────────────────────
+
+// Generate the 3x3 columns around a site, link all neighbors, then record
+// the center column (blocks + meshes see real data across every face)
+static void ProcessSite(uint32_t seed, int scx, int scz,
+                        std::map<ChunkKey, ChunkRecord>& records,
+                        std::map<ChunkKey, ChunkDump>& dumps) {
+    WorldGenerator gen(seed);
+    constexpr int YS = WorldGenerator::MAX_CHUNK_Y - WorldGenerator::MIN_CHUNK_Y + 1;
+    std::unique_ptr<Chunk> grid[3][YS][3];
+
+    for (int dx = 0; dx < 3; ++dx)
+    for (int dz = 0; dz < 3; ++dz)
+    for (int y = 0; y < YS; ++y) {
+        grid[dx][y][dz] = std::make_unique<Chunk>(scx + dx - 1, WorldGenerator::MIN_CHUNK_Y + y, scz + dz - 1);
+        gen.Generate(grid[dx][y][dz].get());
+    }
+
+    auto at = [&](int dx, int y, int dz) -> Chunk* {
+        if (dx < 0 || dx > 2 || dz < 0 || dz > 2 || y < 0 || y >= YS) return nullptr;
+        return grid[dx][y][dz].get();
+    };
+
+    for (int y = 0; y < YS; ++y) {
+        Chunk* c = at(1, y, 1);
+        c->SetNeighbor(BlockFace::Top, at(1, y + 1, 1));
+        c->SetNeighbor(BlockFace::Bottom, at(1, y - 1, 1));
+        c->SetNeighbor(BlockFace::North, at(1, y, 2));
+        c->SetNeighbor(BlockFace::South, at(1, y, 0));
+        c->SetNeighbor(BlockFace::East, at(2, y, 1));
+        c->SetNeighbor(BlockFace::West, at(0, y, 1));
+        c->GenerateMeshData();
+
+        const uint8_t* blocks = c->GetBlockData();
+        const ChunkMeshData& mesh = c->GetPendingMeshData();
+        const ChunkMeshData& water = c->GetPendingWaterMeshData();
+
+        ChunkKey key{seed, scx, c->GetChunkY(), scz};
+        ChunkRecord r;
+        r.blockHash = Fnv1a(blocks, Chunk::VOLUME);
+        r.nonAir = static_cast<uint32_t>(Chunk::VOLUME - std::count(blocks, blocks + Chunk::VOLUME, 0));
+        r.meshHash = HashMesh(mesh);
+        r.vertices = static_cast<uint32_t>(mesh.vertices.size());
+        r.waterHash = HashMesh(water);
+        r.waterVertices = static_cast<uint32_t>(water.vertices.size());
+        records[key] = r;
+
+        ChunkDump& d = dumps[key];
+        std::memcpy(d.blocks.data(), blocks, Chunk::VOLUME);
+        CountColumnVertices(mesh, scx, scz, d.columnVerts);
+        CountColumnVertices(water, scx, scz, d.columnWaterVerts);
+    }
+}
+
+// ── Golden file ──────────────────────────────────────────────────────
+
+static bool WriteGolden(const std::string& path, const std::map<ChunkKey, ChunkRecord>& records) {
+    std::ofstream f(path);
+    if (!f) return false;
+    f << "# SleakWorldHash golden file -- regenerate with: SleakWorldHash --golden <this file> --record\n";
+    f << "# seed cx cy cz block_hash non_air mesh_hash vertices water_hash water_vertices\n";
+    char line[160];
+    for (const auto& [k, r] : records) {
+        std::snprintf(line, sizeof(line),
+                      "%u %d %d %d %016" PRIx64 " %u %016" PRIx64 " %u %016" PRIx64 " %u\n",
+                      k.seed, k.cx, k.cy, k.cz, r.blockHash, r.nonAir,
+                      r.meshHash, r.vertices, r.waterHash, r.waterVertices);
+        f << line;
+    }
+    return static_cast<bool>(f);
+}
+
+static bool ReadGolden(const std::string& path, std::map<ChunkKey, ChunkRecord>& records) {
+    std::ifstream f(path);
+    if (!f) return false;
+    std::string line;
+    while (std::getline(f, line)) {
+        if (line.empty() || line[0] == '#') continue;
+        ChunkKey k{};
+        ChunkRecord r;
+        if (std::sscanf(line.c_str(),
+                        "%u %d %d %d %" SCNx64 " %u %" SCNx64 " %u %" SCNx64 " %u",
+                        &k.seed, &k.cx, &k.cy, &k.cz, &r.blockHash, &r.nonAir,
+                        &r.meshHash, &r.vertices, &r.waterHash, &r.waterVertices) != 10)
+            return false;
+        records[k] = r;
+    }
+    return true;
+}
+
+// ── Diff visualizer ──────────────────────────────────────────────────
+
+static char BlockChar(uint8_t t) {
+    static const char CHARS[] = " gdsclkpPbnvLw";  // indexed by BlockType
+    return t < sizeof(CHARS) - 1 ? CHARS[t] : '?';
+}
+
+static char CountChar(uint32_t n) {
+    if (n == 0) return '.';
+    if (n < 10) return static_cast<char>('0' + n);
+    return '#';
+}
+
+static void PrintBlockDiff(const ChunkDump& ref, const ChunkDump& cur) {
+    auto idx = [](int x, int y, int z) { return x + z * Chunk::SIZE + y * Chunk::SIZE * Chunk::SIZE; };
+
+    int count = 0, layerMost = 0, layerMostCount = 0;
+    int minX = 16, minY = 16, minZ = 16, maxX = -1, maxY = -1, maxZ = -1;
+    std::map<std::pair<uint8_t, uint8_t>, int> changes;
+    uint32_t columns[256] = {};
+    for (int y = 0; y < Chunk::SIZE; ++y) {
+        int layer = 0;
+        for (int z = 0; z < Chunk::SIZE; ++z)
+        for (int x = 0; x < Chunk::SIZE; ++x) {
+            uint8_t a = ref.blocks[idx(x, y, z)], b = cur.blocks[idx(x, y, z)];
+            if (a == b) continue;
+            ++count; ++layer;
+            ++columns[z * Chunk::SIZE + x];
+            ++changes[{a, b}];
+            minX = std::min(minX, x); maxX = std::max(maxX, x);
+            minY = std::min(minY, y); maxY = std::max(maxY, y);
+            minZ = std::min(minZ, z); maxZ = std::max(maxZ, z);
+        }
+        if (layer > layerMostCount) { layerMostCount = layer; layerMost = y; }
+    }
+
+    std::printf("    %d blocks differ, local box (%d,%d,%d)-(%d,%d,%d)\n",
+                count, minX, minY, minZ, maxX, maxY, maxZ);
+    for (const auto& [c, n] : changes)
+        std::printf("      '%c' -> '%c'  x%d\n", BlockChar(c.first), BlockChar(c.second), n);
+
+    std::printf("    differing blocks per column (top view, x right, z down), then layer y=%d\n", layerMost);
+    std::printf("      %-16s   %-16s   %-16s   %s\n", "per column", "reference", "current", "changed");
+    for (int z = 0; z < Chunk::SIZE; ++z) {
+        std::string colRow, refRow, curRow, maskRow;
+        for (int x = 0; x < Chunk::SIZE; ++x) {
+            uint8_t a = ref.blocks[idx(x, layerMost, z)], b = cur.blocks[idx(x, layerMost, z)];
+            colRow += CountChar(columns[z * Chunk::SIZE + x]);
+            refRow += BlockChar(a);
+            curRow += BlockChar(b);
+            maskRow += (a == b) ? '.' : 'x';
+        }
+        std::printf("      %s   %s   %s   %s\n", colRow.c_str(), refRow.c_str(), curRow.c_str(), maskRow.c_str());
+    }
+    std::printf("      blocks: ' ' air  g grass  d dirt  s stone  c cobble  l/k/p logs  P planks  "
+                "b bricks  n sand  v gravel  L leaves  w water\n");
+}
+
+static void PrintMeshDiff(const char* label, const std::array<uint32_t, 256>& ref,
+                          const std::array<uint32_t, 256>& cur) {
+    int cols = 0;
+    for (int i = 0; i < 256; ++i) cols += ref[i] != cur[i];
+    if (cols == 0) {
+        std::printf("    %s: same vertex count in every column (attributes/triangulation changed)\n", label);
+        return;
+    }
+    std::printf("    %s: %d columns with a different vertex count (+ more, - fewer, . same)\n", label, cols);
+    for (int z = 0; z < Chunk::SIZE; ++z) {
+        std::printf("      ");
+        for (int x = 0; x < Chunk::SIZE; ++x) {
+            uint32_t a = ref[z * Chunk::SIZE + x], b = cur[z * Chunk::SIZE + x];
+            std::putchar(a == b ? '.' : (b > a ? '+' : '-'));
+        }
+        std::printf("\n");
+    }
+}
+
+static void PrintChunkDiff(const ChunkKey& k, const ChunkRecord& golden, const ChunkRecord& cur,
+                           const ChunkDump& curDump, const std::string& diffDir) {
+    std::printf("  seed %u chunk (%d, %d, %d):", k.seed, k.cx, k.cy, k.cz);
+    if (golden.blockHash != cur.blockHash)
+        std::printf(" blocks (non-air %u -> %u)", golden.nonAir, cur.nonAir);
+    if (golden.meshHash != cur.meshHash)
+        std::printf(" mesh (vertices %u -> %u)", golden.vertices, cur.vertices);
+    if (golden.waterHash != cur.waterHash)
+        std::printf(" water (vertices %u -> %u)", golden.waterVertices, cur.waterVertices);
+    std::printf("\n");
+
+    if (diffDir.empty()) return;
+    ChunkDump ref;
+    if (!ReadDump(fs::path(diffDir) / DumpName(k), ref)) {
+        std::printf("    (no reference dump %s)\n", DumpName(k).c_str());
+        return;
+    }
+    if (golden.blockHash != cur.blockHash) PrintBlockDiff(ref, curDump);
+    if (golden.meshHash != cur.meshHash) PrintMeshDiff("mesh", ref.columnVerts, curDump.columnVerts);
+    if (golden.waterHash != cur.waterHash) PrintMeshDiff("water", ref.columnWaterVerts, curDump.columnWaterVerts);
+}
+
+int main(int argc, char** argv) {
+    std::string goldenPath, dumpDir, diffDir;
+    bool record = false;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--golden") == 0 && i + 1 < argc)
+            goldenPath = argv[++i];
+        else if (std::strcmp(argv[i], "--record") == 0)
+            record = true;
+        else if (std::strcmp(argv[i], "--dump") == 0 && i + 1 < argc)
+            dumpDir = argv[++i];
+        else if (std::strcmp(argv[i], "--diff") == 0 && i + 1 < argc)
+            diffDir = argv[++i];
+        else {
+            goldenPath.clear();
+            break;
+        }
+    }
+    if (goldenPath.empty()) {
+        std::fprintf(stderr, "Usage: SleakWorldHash --golden <file> [--record] [--dump <dir>] [--diff <dir>]\n");
+        return 1;
+    }
+
+    std::map<ChunkKey, ChunkRecord> records;
+    std::map<ChunkKey, ChunkDump> dumps;
+    for (uint32_t seed : SEEDS)
+        for (const auto& site : SITES)
+            ProcessSite(seed, site.cx, site.cz, records, dumps);
+    std::printf("Hashed %zu chunks (%zu seeds x %zu columns)\n",
+                records.size(), std::size(SEEDS), std::size(SITES));
+
+    if (!dumpDir.empty()) {
+        fs::create_directories(dumpDir);
+        for (const auto& [k, d] : dumps) {
+            if (!WriteDump(fs::path(dumpDir) / DumpName(k), d)) {
+                std::fprintf(stderr, "Failed to write dump to %s\n", dumpDir.c_str());
+                return 1;
+            }
+        }
+        std::printf("Dumped reference chunks to %s\n", dumpDir.c_str());
+    }
+
+    if (record) {
+        if (!WriteGolden(goldenPath, records)) {
+            std::fprintf(stderr, "Failed to write %s\n", goldenPath.c_str());
+            return 1;
+        }
+        std::printf("Recorded %s\n", goldenPath.c_str());
+        return 0;
+    }
+
+    std::map<ChunkKey, ChunkRecord> golden;
+    if (!ReadGolden(goldenPath, golden)) {
+        std::fprintf(stderr, "Failed to read %s\n", goldenPath.c_str());
+        return 1;
+    }
+
+    int mismatched = 0, missing = 0;
+    for (const auto& [k, g] : golden) {
+        auto it = records.find(k);
+        if (it == records.end()) { ++missing; continue; }
+        const ChunkRecord& r = it->second;
+        if (g.blockHash == r.blockHash && g.meshHash == r.meshHash && g.waterHash == r.waterHash)
+            continue;
+        if (mismatched == 0) std::printf("\nMismatched chunks:\n");
+        ++mismatched;
+        PrintChunkDiff(k, g, r, dumps[k], diffDir);
+    }
+    missing += static_cast<int>(records.size()) - static_cast<int>(golden.size() - missing);
+
+    if (mismatched == 0 && missing == 0) {
+        std::printf("All %zu chunks match %s\n", golden.size(), goldenPath.c_str());
+        return 0;
+    }
+    std::printf("\nFAIL: %d mismatched, %d missing/extra chunks\n", mismatched, missing);
+    if (mismatched && diffDir.empty())
+        std::printf("Rerun with --diff <dir> against a reference made by --dump on a known-good build.\n");
+    return 2;
+}
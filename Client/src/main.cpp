@@ -24,6 +24,7 @@ static void PrintHelp(const char* exe) {
         << "  -world <name>      Load world if save exists, create new otherwise\n"
         << "  -seed <n>          Seed for new world (default: random)\n"
         << "  -rd <n>            Initial render distance in chunks (default: 8)\n"
+        << "  -workers <n>       Chunk worker threads (default: calibrated at startup)\n"
         << "\nGraphics\n"
         << "  -msaa <n>          MSAA sample count: 1, 2, 4, 8\n"
         << "  --vsync            Enable VSync on launch\n"
@@ -32,6 +33,7 @@ static void PrintHelp(const char* exe) {
         << "  --bench            Start benchmark recording immediately\n"
         << "\nDebug\n"
         << "  --validate         Enable Vulkan validation layer\n"
+        << "  -trace <file>      Write a Chrome trace of the last few seconds on exit (F9: any time)\n"
         << "\nMisc\n"
         << "  --help             Show this message\n\n";
 }
@@ -9,6 +9,7 @@
 #include <array>
 #include <Debug/SystemMetrics.hpp>
 #include "World/ChunkManager.hpp"
+#include "World/MeshBatchRenderBackend.hpp"
 #include "World/Block.hpp"
 #include "World/SaveManager.hpp"
 #include "World/BlockEffects.hpp"
@@ -33,6 +34,8 @@ private:
     void SetupMaterial();
     void SetupSkybox();
     void SetupLighting();
+    void UpdateSunDirection();
+    void UpdateFogDistance();
     void RenderUI();
 
     void OnMousePressed(const Sleak::Events::Input::MouseButtonPressedEvent& e);
@@ -42,6 +45,7 @@ private:
     void RenderHotbar();
 
     void LoadGame();
+    void DumpTrace();
 
     std::string m_savePath;
     std::string m_worldName;
@@ -50,6 +54,7 @@ private:
 
     Sleak::RefPtr<Sleak::Material> m_blockMaterial;
     Sleak::RefPtr<Sleak::Material> m_waterMaterial;
+    MeshBatchRenderBackend m_chunkRenderer;  // must outlive m_chunkManager
     ChunkManager m_chunkManager;
     BlockEffects m_blockEffects;
     SaveManager m_saveManager;
@@ -64,6 +69,9 @@ private:
     std::array<uint64_t, HOTBAR_SLOTS> m_hotbarTextures = {};
     bool m_hotbarTexturesLoaded = false;
     bool m_multithreadedLoading = true;
+    bool m_deltaSaves = true;
+    bool m_caveCulling = true;
+    bool m_occlusionBuffer = true;
     bool m_vsync = false;
 
     // UI state
@@ -77,6 +85,30 @@ private:
     float m_saveMessageTimer = 0.0f;
     std::string m_saveMessage;
 
+    // Chrome trace written on exit (-trace <file>)
+    std::string m_tracePath;
+
+    // Render distance cap (chunks); past the LOD start, columns are LOD meshes
+    static constexpr int MAX_RENDER_DISTANCE = 48;
+    // Heightmap horizon past the render distance (chunks, 0 = off, -horizon
+    // on the command line). The camera's far plane is sized at startup to
+    // reach the corners of that horizon (or of the largest render distance),
+    // so the settings slider cannot go past it.
+    static constexpr int DEFAULT_HORIZON_DISTANCE = 128;
+    static constexpr int MAX_HORIZON_DISTANCE = 256;
+    int m_horizonLimit = DEFAULT_HORIZON_DISTANCE;
+    float m_cameraFar = 0.0f;
+    // Near plane corners stay inside the player's 0.3 collision sphere
+    static constexpr float CAMERA_NEAR = 0.2f;
+    // Column mesh memory budget (MB, 0 = unlimited, -mesh-budget on the
+    // command line)
+    static constexpr int DEFAULT_MESH_BUDGET_MB = 1024;
+    // Sun shadow map reach (world units); the chunk manager sweeps caster
+    // columns toward the view over at most the far plane
+    static constexpr float SHADOW_DISTANCE = 160.0f;
+    static constexpr float SHADOW_FAR = 500.0f;
+    static constexpr int MAX_MESH_BUDGET_MB = 8192;
+
     // Auto-save
     float m_autoSaveTimer = 0.0f;
     static constexpr float AUTO_SAVE_INTERVAL = 120.0f;
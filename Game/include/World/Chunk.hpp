@@ -2,20 +2,51 @@
 #define _CHUNK_HPP_
 
 #include "Block.hpp"
+#include "ChunkVisibility.hpp"
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
-#include <Runtime/MeshData.hpp>
-#include <Memory/RefPtr.h>
-
-namespace Sleak {
-    class Material;
-    class GameObject;
-    class SceneBase;
-}
+#include <iterator>
+#include <vector>
+
+// CPU-side vertex produced by the mesher. Positions are in world space;
+// the color carries per-vertex AO. The render backend converts it to
+// whatever its GPU vertex format is.
+struct WorldVertex {
+    float x = 0.0f, y = 0.0f, z = 0.0f;
+    float nx = 0.0f, ny = 0.0f, nz = 0.0f;
+    float u = 0.0f, v = 0.0f;
+    float r = 1.0f, g = 1.0f, b = 1.0f, a = 1.0f;
+
+    WorldVertex() = default;
+    WorldVertex(float px, float py, float pz, float pnx, float pny, float pnz, float pu, float pv)
+        : x(px), y(py), z(pz), nx(pnx), ny(pny), nz(pnz), u(pu), v(pv) {}
+
+    void SetColor(float cr, float cg, float cb, float ca) { r = cr; g = cg; b = cb; a = ca; }
+};
 
 struct ChunkMeshData {
-    Sleak::VoxelVertexGroup vertices;
-    Sleak::IndexGroup indices;
+    static constexpr uint8_t ALL_FACES = 0x3F;      // one bit per BlockFace
+
+    std::vector<WorldVertex> vertices;
+    std::vector<uint32_t> indices;
+    // Indices per BlockFace direction. When they add up to indices.size(),
+    // the indices are grouped by direction in BlockFace order, so a renderer
+    // can leave out the directions facing away from the camera; otherwise
+    // (water, LOD and horizon meshes) the mesh is a single range.
+    uint32_t faceIndexCounts[6] = {};
+
+    bool HasFaceRanges() const;
+
+    // Append `src`, rebasing its indices past the current vertices. Two
+    // meshes with direction ranges merge range by range.
+    void Append(const ChunkMeshData& src);
+
+    void release() {
+        std::vector<WorldVertex>().swap(vertices);
+        std::vector<uint32_t>().swap(indices);
+        std::fill(std::begin(faceIndexCounts), std::end(faceIndexCounts), 0u);
+    }
 };
 
 class Chunk {
@@ -24,32 +55,51 @@ public:
     static constexpr int VOLUME = SIZE * SIZE * SIZE;
 
     Chunk(int cx, int cy, int cz);
-    ~Chunk();
+
+    // Reinitializes a recycled chunk as a fresh, all-air chunk at (cx, cy, cz)
+    void Reset(int cx, int cy, int cz);
 
     void SetBlock(int x, int y, int z, BlockType type);
     BlockType GetBlock(int x, int y, int z) const;
 
     void SetNeighbor(BlockFace face, Chunk* chunk);
 
-    void BuildMesh(const Sleak::RefPtr<Sleak::Material>& material);
+    // Buffers the mesher builds into (one index list per direction, joined
+    // on commit); a caller meshing many chunks keeps one so they stay sized
+    struct MeshScratch {
+        std::vector<WorldVertex> vertices;
+        std::vector<uint32_t> faceIndices[6];
+        std::vector<WorldVertex> waterVertices;
+        std::vector<uint32_t> waterIndices;
+    };
+
+    // GenerateMeshData builds into `scratch` (or one of its own) and moves the
+    // result into the pending meshes. BuildMeshData + CommitMeshData let a
+    // caller hand the chunk pending buffers that fit the built mesh in
+    // between; the commit copies into those instead.
     void GenerateMeshData();
-    void UploadMesh(const Sleak::RefPtr<Sleak::Material>& material);
-    void AddToScene(Sleak::SceneBase* scene);
-    void RemoveFromScene(Sleak::SceneBase* scene);
+    void GenerateMeshData(MeshScratch& scratch);
+    void BuildMeshData(MeshScratch& scratch);
+    void CommitMeshData(MeshScratch& scratch);
 
     int GetChunkX() const { return m_cx; }
     int GetChunkY() const { return m_cy; }
     int GetChunkZ() const { return m_cz; }
 
     bool IsMeshBuilt() const { return m_meshBuilt; }
+    // ChunkVisibility face pairs, refreshed by GenerateMeshData (ALL before)
+    uint16_t GetFaceConnectivity() const { return m_faceConnectivity; }
     bool HasPendingMesh() const { return m_hasPendingMesh; }
     void ClearPendingMesh() { m_hasPendingMesh = false; }
     bool IsInFlight() const { return m_inFlight; }
     void SetInFlight(bool v) { m_inFlight = v; }
-    Sleak::GameObject* GetGameObject() const { return m_gameObject; }
 
     bool IsDirty() const { return m_dirty; }
     void SetDirty(bool d) { m_dirty = d; }
+    // Blocks differ from the generator's (edited or restored from a save);
+    // unlike the dirty flag this survives saving
+    bool IsEdited() const { return m_edited; }
+    void SetEdited(bool e) { m_edited = e; }
     const uint8_t* GetBlockData() const { return m_blocks; }
 
     bool HasAllNeighbors() const {
@@ -68,6 +118,10 @@ public:
     bool NeedsGeneration() const { return m_needsGeneration; }
     void SetNeedsGeneration(bool v) { m_needsGeneration = v; }
 
+    // Mesh jobs run for this chunk (telemetry: more than one = remeshed)
+    uint16_t GetMeshCount() const { return m_meshCount; }
+    void CountMesh() { if (m_meshCount < UINT16_MAX) ++m_meshCount; }
+
     int GetActiveIndex() const { return m_activeIndex; }
     void SetActiveIndex(int idx) { m_activeIndex = idx; }
 
@@ -87,17 +141,18 @@ private:
     uint8_t m_blocks[VOLUME];
     Chunk* m_neighbors[6] = {};
     int m_cx, m_cy, m_cz;
-    Sleak::GameObject* m_gameObject = nullptr;
     bool m_meshBuilt = false;
-    bool m_addedToScene = false;
+    uint16_t m_faceConnectivity = ChunkVisibility::ALL;
     ChunkMeshData m_pendingMesh;
     ChunkMeshData m_pendingWaterMesh;
     bool m_hasPendingMesh = false;
     bool m_hasPendingWaterMesh = false;
     bool m_inFlight = false;
     bool m_dirty = false;
+    bool m_edited = false;
     bool m_needsRebuild = false;
     bool m_needsGeneration = true;
+    uint16_t m_meshCount = 0;
     int m_activeIndex = -1;
 };
 
@@ -0,0 +1,56 @@
+#ifndef _CHUNK_CODEC_HPP_
+#define _CHUNK_CODEC_HPP_
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Per-chunk payload encodings stored in region files (v2+). The id is
+// written in front of every chunk so the codec can be picked per chunk.
+enum class ChunkCodecId : uint8_t {
+    Raw = 0,        // block bytes verbatim
+    RLE = 1,        // u16 count + u8 value runs (the only codec in v1 files)
+    Palette = 2,    // palette + bit-packed palette indices
+    PaletteLZ = 3,  // palette stage followed by LZ
+    LZ = 4,         // LZ directly over the block bytes
+    Delta = 5,      // sparse edits against the procedurally generated chunk
+    COUNT
+};
+
+class ChunkCodec {
+public:
+    // Encode with every codec and keep the smallest payload.
+    static ChunkCodecId EncodeBest(const uint8_t* data, size_t size,
+                                   std::vector<uint8_t>& out);
+
+    static bool Encode(ChunkCodecId codec, const uint8_t* data, size_t size,
+                       std::vector<uint8_t>& out);
+    static bool Decode(ChunkCodecId codec, const uint8_t* encoded, size_t encodedSize,
+                       uint8_t* output, size_t expectedSize);
+
+    static const char* GetName(ChunkCodecId codec);
+
+    // Stage 1: palette extraction + bit packing.
+    // Format: count-1(1) palette(count) indices(ceil(size * bits / 8))
+    static void PaletteEncode(const uint8_t* data, size_t size, std::vector<uint8_t>& out);
+    static bool PaletteDecode(const uint8_t* encoded, size_t encodedSize,
+                              uint8_t* output, size_t expectedSize);
+
+    // Stage 2: byte-oriented LZ77 (LZ4-style token/literal/offset sequences).
+    static void LZCompress(const uint8_t* data, size_t size, std::vector<uint8_t>& out);
+    static bool LZDecompress(const uint8_t* encoded, size_t encodedSize,
+                             uint8_t* output, size_t expectedSize);
+
+    // Sparse delta against a regenerated base chunk. The generator version is
+    // stored so a delta is never applied to terrain from a different generator.
+    // Format: baseVersion(2) count(2) then count * (index(2) value(1))
+    static void DeltaEncode(const uint8_t* data, const uint8_t* base, size_t size,
+                            uint16_t baseVersion, std::vector<uint8_t>& out);
+    static bool DeltaDecode(const uint8_t* encoded, size_t encodedSize,
+                            const uint8_t* base, uint16_t baseVersion,
+                            uint8_t* output, size_t expectedSize);
+    // Generator version a delta payload was encoded against
+    static bool DeltaBaseVersion(const uint8_t* encoded, size_t encodedSize, uint16_t& version);
+};
+
+#endif
@@ -0,0 +1,47 @@
+#ifndef _CHUNK_KEY_HPP_
+#define _CHUNK_KEY_HPP_
+
+#include <cstdint>
+
+// Collision-free 64-bit chunk key: x and z keep 28 bits each (two's
+// complement), y the low 8. That covers every chunk addressable with int32
+// block coordinates (|cx|, |cz| < 2^27) and chunk Y in [-128, 127], so no two
+// chunks in any reachable world share a key. Keys are plain integers, so
+// FlatHashMap hashes and compares them in a couple of instructions.
+class ChunkKey {
+public:
+    static constexpr int XZ_BITS = 28;
+    static constexpr int Y_BITS = 8;
+    static constexpr int32_t XZ_MIN = -(1 << (XZ_BITS - 1));
+    static constexpr int32_t XZ_MAX = (1 << (XZ_BITS - 1)) - 1;
+    static constexpr int32_t Y_MIN = -(1 << (Y_BITS - 1));
+    static constexpr int32_t Y_MAX = (1 << (Y_BITS - 1)) - 1;
+
+    static constexpr uint64_t Pack(int32_t cx, int32_t cy, int32_t cz) {
+        return ((static_cast<uint64_t>(static_cast<uint32_t>(cx)) & XZ_MASK) << (XZ_BITS + Y_BITS))
+             | ((static_cast<uint64_t>(static_cast<uint32_t>(cz)) & XZ_MASK) << Y_BITS)
+             |  (static_cast<uint64_t>(static_cast<uint32_t>(cy)) & Y_MASK);
+    }
+
+    static constexpr int32_t UnpackX(uint64_t key) { return SignExtend(key >> (XZ_BITS + Y_BITS), XZ_BITS); }
+    static constexpr int32_t UnpackY(uint64_t key) { return SignExtend(key, Y_BITS); }
+    static constexpr int32_t UnpackZ(uint64_t key) { return SignExtend(key >> Y_BITS, XZ_BITS); }
+
+private:
+    static constexpr uint64_t XZ_MASK = (1ull << XZ_BITS) - 1;
+    static constexpr uint64_t Y_MASK = (1ull << Y_BITS) - 1;
+
+    static constexpr int32_t SignExtend(uint64_t v, int bits) {
+        uint32_t u = static_cast<uint32_t>(v & ((1ull << bits) - 1));
+        uint32_t sign = 1u << (bits - 1);
+        return static_cast<int32_t>((u ^ sign) - sign);
+    }
+};
+
+static_assert(ChunkKey::UnpackX(ChunkKey::Pack(-40001, 3, 39998)) == -40001, "ChunkKey x round trip");
+static_assert(ChunkKey::UnpackY(ChunkKey::Pack(-40001, -3, 39998)) == -3, "ChunkKey y round trip");
+static_assert(ChunkKey::UnpackZ(ChunkKey::Pack(ChunkKey::XZ_MAX, 0, ChunkKey::XZ_MIN)) == ChunkKey::XZ_MIN,
+              "ChunkKey z round trip");
+static_assert(ChunkKey::Pack(0, 0, 65536) != ChunkKey::Pack(0, 0, 0), "ChunkKey keeps z beyond 16 bits");
+
+#endif
@@ -3,11 +3,20 @@
 
 #include "Chunk.hpp"
 #include "WorldGenerator.hpp"
-#include <Math/Vector.hpp>
-#include <Memory/RefPtr.h>
-#include <Runtime/MeshBatch.hpp>
-#include <unordered_map>
-#include <unordered_set>
+#include "ColumnStore.hpp"
+#include "ChunkRenderBackend.hpp"
+#include "WorldMath.hpp"
+#include "CountingMutex.hpp"
+#include "ChunkTelemetry.hpp"
+#include "FlatHashMap.hpp"
+#include "ChunkKey.hpp"
+#include "SavedChunkMap.hpp"
+#include "ColumnCull.hpp"
+#include "OcclusionBuffer.hpp"
+#include "HorizonTerrain.hpp"
+#include "LodMesher.hpp"
+#include <memory>
+#include <string>
 #include <vector>
 #include <functional>
 #include <climits>
@@ -16,11 +25,7 @@
 #include <condition_variable>
 #include <atomic>
 #include <array>
-
-namespace Sleak {
-    class Material;
-    class SceneBase;
-}
+#include <chrono>
 
 struct ChunkCoord {
     int x, y, z;
@@ -28,7 +33,7 @@ struct ChunkCoord {
 };
 
 struct VoxelCollisionResult {
-    Sleak::Math::Vector3D correction{0.0f, 0.0f, 0.0f};
+    WorldVec3 correction{0.0f, 0.0f, 0.0f};
     bool onGround = false;
     bool hitCeiling = false;
     bool hitWall = false;
@@ -41,13 +46,10 @@ struct VoxelRaycastResult {
     BlockType blockType = BlockType::Air;
 };
 
+// Injective (see ChunkKey); FlatHashMap mixes the bits itself
 struct ChunkCoordHash {
     size_t operator()(const ChunkCoord& c) const {
-        size_t h = 0;
-        h ^= std::hash<int>()(c.x) + 0x9e3779b9 + (h << 6) + (h >> 2);
-        h ^= std::hash<int>()(c.y) + 0x9e3779b9 + (h << 6) + (h >> 2);
-        h ^= std::hash<int>()(c.z) + 0x9e3779b9 + (h << 6) + (h >> 2);
-        return h;
+        return static_cast<size_t>(ChunkKey::Pack(c.x, c.y, c.z));
     }
 };
 
@@ -56,36 +58,129 @@ public:
     ChunkManager();
     ~ChunkManager();
 
-    void Initialize(Sleak::SceneBase* scene, const Sleak::RefPtr<Sleak::Material>& material);
+    // Column meshes are uploaded and drawn through `backend`; nullptr runs
+    // headless (meshes are built on the CPU and only their sizes are kept).
+    void Initialize(ChunkRenderBackend* backend);
     void Update(float playerX, float playerY, float playerZ);
 
+    // Camera for culling column meshes. Without one (headless), every column
+    // within draw distance of the player is visible. The projection enables
+    // the occlusion buffer.
+    void SetView(const WorldVec3& cameraPos, const WorldFrustum& frustum);
+    void SetView(const WorldVec3& cameraPos, const WorldFrustum& frustum,
+                 const WorldViewProj& viewProj);
+    // Directional light for shadow caster culling. `direction` is the way
+    // the light travels; receivers are what the view holds within
+    // `shadowDistance` blocks, and their casters are searched up to
+    // `maxSweep` blocks back toward the light. A light at or below the
+    // horizon (direction.y >= 0) casts nothing.
+    void SetShadowLight(const WorldVec3& direction, float shadowDistance, float maxSweep);
+
     void FlushPendingChunks();
     void SetRenderDistance(int chunks);
 
     int GetRenderDistance() const { return m_renderDistance; }
 
+    // Distance LOD: chunks are loaded out to the first distance (or the
+    // render distance, if nearer); columns beyond it keep no chunks and are
+    // drawn from LodMesher meshes at level 1, 2 past the second distance and
+    // 3 past the third, out to the render distance.
+    void SetLodDistances(int level1, int level2, int level3);
+    const std::array<int, 3>& GetLodDistances() const { return m_lodDistances; }
+    int GetDetailDistance() const { return m_detailDistance; }
+
+    // Horizon: heightmap-only terrain (HorizonTerrain) from the render
+    // distance out to `chunks` (0 = off, capped at HorizonTerrain::MAX_DISTANCE)
+    void SetHorizonDistance(int chunks);
+    int GetHorizonDistance() const { return m_horizonDistance; }
+    // How far terrain is drawn, in blocks: the horizon when it reaches past
+    // the render distance, else the draw distance (for fog)
+    float GetVisibleDistance() const;
+
+    // Column mesh memory budget in bytes (0 = unlimited). An upload that
+    // would pass it first evicts the columns out of view for longest
+    // (farthest first among equals) down to EVICT_TARGET of the budget;
+    // evicted columns rebuild when they come back into view. When only
+    // columns in view are left, the next Update lowers the detail distance
+    // so LOD columns take over, and only at MIN_BUDGET_DETAIL does the
+    // upload fail (and retry). Setting the budget, render distance or LOD
+    // distances lifts that cap.
+    void SetMeshBudget(size_t bytes);
+    size_t GetMeshBudget() const { return m_meshBudget; }
+
     void SetMultithreaded(bool enabled);
     bool IsMultithreaded() const { return m_multithreaded; }
 
+    // Worker threads used when multithreaded (0 = automatic: the count picked
+    // by CalibrateWorkers). Restarts running workers.
+    void SetWorkerCount(int count);
+    int GetWorkerCount() const { return static_cast<int>(m_workers.size()); }
+
+    // Startup calibration for the automatic pool size: generates + meshes
+    // chunks on 1..(hardware threads - 1) threads for a few ms each and picks
+    // the smallest count within 90% of the best throughput. Runs once per
+    // process; later calls return the cached result.
+    struct WorkerCalibration {
+        int chosen = 1;
+        std::vector<std::pair<int, double>> chunksPerSec;   // (threads, chunks/s)
+    };
+    static const WorkerCalibration& CalibrateWorkers();
+
+    // Cumulative pipeline counters, for tools and benchmarks
+    struct StreamStats {
+        uint64_t chunksGenerated = 0;
+        uint64_t chunksMeshed = 0;
+        uint64_t columnsBuilt = 0;
+        uint64_t chunksRemeshed = 0;    // mesh jobs for chunks meshed before
+        uint64_t lodColumnsBuilt = 0;
+        uint64_t horizonTilesBuilt = 0;
+        LockStats taskLock;     // m_taskMutex: main thread dispatch vs workers stealing
+        LockStats readyLock;    // m_readyMutex: workers publishing vs main thread draining
+    };
+    StreamStats GetStreamStats() const;
+    // True once every chunk within the detail distance is generated, meshed
+    // and its column uploaded, and every LOD column and horizon tile beyond
+    // it is built.
+    // O(active chunks) — for tools, not per-frame use.
+    bool IsFullyLoaded() const;
+    size_t GetActiveChunkCount() const { return m_activeChunks.size(); }
+
+    // Live pipeline metrics for the debug panel / benchmark recorder
+    const ChunkPipelineTelemetry& GetTelemetry() const { return m_telemetry; }
+    void ResetTimeToVisible() { m_telemetry.timeToVisible.Reset(); }
+
     void SetDrawDistance(float dist) { m_drawDistance = dist; m_drawDistSq = dist * dist; }
     float GetDrawDistance() const { return m_drawDistance; }
 
-    void SetSeed(uint32_t seed) { m_generator.SetSeed(seed); }
+    // Cave culling: skip columns in the frustum that no line of sight from
+    // the camera chunk can reach through open chunk faces (needs SetView)
+    void SetOcclusionCulling(bool enabled) { m_occlusionCulling = enabled; }
+    bool IsOcclusionCullingEnabled() const { return m_occlusionCulling; }
+
+    // Occlusion buffer: rasterize the solid lower parts of the nearest columns
+    // into an OcclusionBuffer and skip columns hidden behind them (needs
+    // SetView with a projection)
+    void SetOcclusionBuffer(bool enabled) { m_occlusionBufferEnabled = enabled; }
+    bool IsOcclusionBufferEnabled() const { return m_occlusionBufferEnabled; }
+
+    void SetSeed(uint32_t seed);
     uint32_t GetSeed() const { return m_generator.GetSeed(); }
     const WorldGenerator& GetGenerator() const { return m_generator; }
 
-    // Render all visible column meshes via MeshBatch (call from scene Update)
+    // Draw all visible column meshes through the backend (call from scene Update)
     void RenderColumns();
     void RenderWater();
-
-    void SetWaterMaterial(const Sleak::RefPtr<Sleak::Material>& material) { m_waterMaterial = material; }
+    // Columns outside the view that cast shadows into it (needs SetView,
+    // SetShadowLight and a backend with a caster pass); the view's own
+    // columns are in RenderColumns
+    void RenderShadowCasters();
 
     BlockType GetBlockAt(int worldX, int worldY, int worldZ) const;
     bool SetBlockAt(int worldX, int worldY, int worldZ, BlockType type);
-    VoxelRaycastResult VoxelRaycast(const Sleak::Math::Vector3D& origin,
-                                     const Sleak::Math::Vector3D& direction,
+    VoxelRaycastResult VoxelRaycast(const WorldVec3& origin,
+                                     const WorldVec3& direction,
                                      float maxDist) const;
-    VoxelCollisionResult ResolveVoxelCollision(const Sleak::Math::Vector3D& eyePos,
+    VoxelCollisionResult ResolveVoxelCollision(const WorldVec3& eyePos,
                                                 float halfWidth, float height,
                                                 float eyeOffset) const;
 
@@ -96,13 +191,14 @@ public:
     };
     std::vector<DirtyChunkInfo> GetDirtyChunks() const;
     void ClearDirtyFlags();
-    void LoadChunkData(const std::unordered_map<int64_t, std::array<uint8_t, 4096>>& data);
+    void LoadChunkData(SavedChunkMap data);
     void ForceReload();
 
-    // Heightmap cache — persists m_columnMaxCyCache across sessions so
-    // GetMaxFilledChunkY() noise evaluations are skipped on reload.
-    void SaveHeightmapCache(const std::string& path) const;
-    void LoadHeightmapCache(const std::string& path);
+    // Column store — per-column surface heights, biomes and maxCy persisted
+    // with the world, so reopening skips the 2D noise for visited columns.
+    void OpenColumnStore(const std::string& path);
+    void FlushColumnStore();
+    const ColumnStore& GetColumnStore() const { return m_columnStore; }
 
 private:
     void LinkNeighbors(const ChunkCoord& coord, Chunk* chunk);
@@ -115,6 +211,11 @@ private:
     void StopWorkers();
     void WorkerThread();
 
+    // Generate / mesh a chunk and count it in the stream stats. Workers pass
+    // their own mesh scratch; the main thread also lends pooled buffers.
+    void GenerateChunk(Chunk* chunk);
+    void MeshChunk(Chunk* chunk, Chunk::MeshScratch* workerScratch = nullptr);
+
     // Column mesh management — merges all Y chunks per XZ column into one mesh
     static constexpr int BAND_SIZE = 8; // chunks per band (full Y column)
     struct ColumnKey {
@@ -123,34 +224,284 @@ private:
     };
     struct ColumnKeyHash {
         size_t operator()(const ColumnKey& c) const {
-            size_t h = std::hash<int>()(c.x);
-            h ^= std::hash<int>()(c.yBand) + 0x9e3779b9 + (h << 6) + (h >> 2);
-            h ^= std::hash<int>()(c.z) + 0x9e3779b9 + (h << 6) + (h >> 2);
-            return h;
+            return static_cast<size_t>(ChunkKey::Pack(c.x, c.yBand, c.z));
         }
     };
     struct ColumnMesh {
-        Sleak::MeshHandle mesh;
-        Sleak::MeshHandle waterMesh;
-        bool visible = true;
+        ChunkMeshId mesh = 0;
+        ChunkMeshId waterMesh = 0;
+        size_t bytes = 0;                   // uploaded opaque + water bytes
+        bool awaitingFirstDraw = false;     // time-to-visible not recorded yet
+        uint8_t lodLevel = 0;               // LodMesher level, 0 for columns built from chunks
+        bool horizon = false;               // HorizonTerrain tile
+        // Meshes dropped for the budget; rebuilt once back in view
+        bool evicted = false;
+        bool reloadQueued = false;          // LOD / horizon rebuild requested
+        uint32_t lastVisibleFrame = 0;      // m_meshFrame when last drawn
+        // Opaque indices per BlockFace direction (all 0 when the mesh is a
+        // single range) and the directions the camera pass draws
+        uint32_t indexCount = 0;
+        uint32_t faceIndices[6] = {};
+        uint8_t drawFaces = ChunkMeshData::ALL_FACES;
+        // Place in the last sorted opaque / water draw list, valid while
+        // sortGen matches m_sortGen of that pass
+        uint32_t drawRank[2] = {0, 0};
+        uint32_t sortGen[2] = {0, 0};
+        // Occluder: the longest run of layers opaque in every block of the
+        // column, [occluderBottom, occluderTop) (none when empty)
+        float occluderBottom = 0.0f;
+        float occluderTop = 0.0f;
+        std::chrono::steady_clock::time_point requested;
     };
     void RebuildColumnMesh(int cx, int yBand, int cz, bool allowDefer = true);
-    // Max number of column meshes before we consider VRAM exhausted.
-    // At ~1.1 MB per column (96 bytes/vertex * ~12000 vertices), 800
-    // columns ≈ 880 MB mesh VRAM — conservative for a 6 GB GPU with
-    // other allocations (textures, framebuffers, etc.).
-    static constexpr int MAX_COLUMN_MESHES = 800;
+    // Free the backend meshes of a column (the entry itself stays)
+    void ReleaseColumnMeshes(ColumnMesh& col);
+    ColumnMesh* FindColumn(const ColumnKey& key);
+    // Existing column, or a new empty one
+    ColumnMesh& InsertColumn(const ColumnKey& key);
+    void EraseColumn(const ColumnKey& key);
+    void EraseColumnSlot(uint32_t slot);
+    void ClearColumns();
+
+    // ── Mesh budget ──
+    static constexpr float EVICT_TARGET = 0.9f;
+    static constexpr int MIN_BUDGET_DETAIL = 4;         // detail distance floor under pressure
+    static constexpr int BUDGET_DETAIL_STEP = 2;
+    // Makes room for `bytes` more; false when only columns in view are left
+    bool ReserveMeshBytes(size_t bytes);
+    void EvictColumns(size_t targetBytes);
+    void EvictColumn(uint32_t slot);
+    // Requests the rebuild of an evicted column that came into view
+    void ReloadEvictedColumn(uint32_t slot);
+    void ApplyBudgetDetailCap();
+    size_t m_meshBudget = 0;
+    uint32_t m_meshFrame = 0;
+    int m_budgetDetailCap = INT_MAX;
+    bool m_budgetCapPending = false;
+    uint64_t m_evictedColumns = 0;
+    struct EvictCandidate {
+        uint32_t lastVisibleFrame;
+        float distSq;
+        uint32_t slot;
+        // Longest out of view first, then farthest
+        bool operator<(const EvictCandidate& o) const {
+            if (lastVisibleFrame != o.lastVisibleFrame) return lastVisibleFrame < o.lastVisibleFrame;
+            return distSq > o.distSq;
+        }
+    };
+    std::vector<EvictCandidate> m_evictScratch;
 
     // Floor-division: negative cy must map downward (e.g. cy=-1 → band -1, not 0)
     static int ChunkYToBand(int cy) {
         return (cy >= 0) ? cy / BAND_SIZE : (cy - BAND_SIZE + 1) / BAND_SIZE;
     }
-    std::unordered_map<ColumnKey, ColumnMesh, ColumnKeyHash> m_columns;
-    std::unordered_set<ColumnKey, ColumnKeyHash> m_dirtyColumns;
-    std::unordered_set<ChunkCoord, ChunkCoordHash> m_chunksNeedingRemesh;
+    // Dense column table: m_columnSlots maps a key to its slot in the
+    // parallel arrays below; erasing moves the last slot into the hole.
+    // Bounds are stored as SoA so FrustumCull tests 8 columns per step.
+    FlatHashMap<ColumnKey, uint32_t, ColumnKeyHash> m_columnSlots;
+    std::vector<ColumnKey> m_columnKeys;
+    std::vector<ColumnMesh> m_columnMeshes;
+    ColumnBounds m_columnBounds;
+
+    // Slots drawn this frame, compacted by FrustumCull. Slots move when
+    // columns are added or erased, so that marks the lists stale and the
+    // next Render* call culls again.
+    std::vector<uint32_t> m_visibleSlots;
+    std::vector<uint32_t> m_opaqueDrawList;
+    std::vector<uint32_t> m_waterDrawList;
+    bool m_drawListsStale = false;
+
+    // Draw order: opaque near to far (for early-Z), water far to near (for
+    // blending). A list starts from its last sorted order and only does
+    // the work the camera's motion calls for: kept as is when still in
+    // order, a few strays inserted, otherwise radix sorted on quantized
+    // distance.
+    static constexpr float SORT_KEY_SCALE = 4.0f;       // key steps per block
+    static constexpr int SORT_INSERTION_MAX = 256;      // moves before radix sorting instead
+    struct DrawItem {
+        uint32_t key;
+        uint32_t slot;
+    };
+    void SortDrawList(std::vector<uint32_t>& list, int pass);
+    uint32_t DrawSortKey(uint32_t slot, int pass) const;
+    std::vector<DrawItem> m_sortItems;
+    std::vector<DrawItem> m_sortFresh;
+    std::vector<DrawItem> m_sortScratch;
+    std::vector<uint32_t> m_sortByRank;
+    uint32_t m_sortGen[2] = {1, 1};
+    uint32_t m_sortedCount[2] = {0, 0};
+    WorldVec3 m_sortEye;
+    uint64_t m_drawListResorts = 0;
+    FlatHashSet<ColumnKey, ColumnKeyHash> m_dirtyColumns;
+    FlatHashSet<ChunkCoord, ChunkCoordHash> m_chunksNeedingRemesh;
+
+    // Per-frame scratch. Update() clears and refills these instead of
+    // building locals, so once their capacity has settled a frame that
+    // streams over already-visited terrain allocates nothing.
+    FlatHashSet<ColumnKey, ColumnKeyHash> m_unloadedColumns;
+    FlatHashSet<ColumnKey, ColumnKeyHash> m_syncDirtyColumns;
+    std::vector<Chunk*> m_readyScratch;     // swapped with m_readyQueue
+    std::vector<Chunk*> m_dispatchBatch;
+    std::vector<ChunkCoord> m_deferredLoads;
+    std::vector<ChunkCoord> m_deferredUnloads;
+    std::vector<Chunk*> m_remeshBatch;
+    std::vector<ColumnKey> m_rebuildBatch;
+    ChunkMeshData m_mergeScratch;
+    ChunkMeshData m_mergeWaterScratch;
+
+    // Mesh buffers taken back from merged or unloaded chunks while meshing is
+    // synchronous (up to MESH_BUFFER_POOL_MAX each, sorted by capacity). The
+    // main thread lends a chunk the smallest one that fits its built mesh, so
+    // it stops allocating once the pools hold what a walk needs at once.
+    static constexpr size_t MESH_BUFFER_POOL_MAX = 64;
+    Chunk::MeshScratch m_meshScratch;
+    std::vector<ChunkMeshData> m_meshBufferPool;
+    std::vector<ChunkMeshData> m_waterBufferPool;
+    void LendMeshBuffers(ChunkMeshData& data, size_t vertexCount, std::vector<ChunkMeshData>& pool);
+    void ReturnMeshBuffers(ChunkMeshData& data, std::vector<ChunkMeshData>& pool);
+
+    // Unloaded chunks are reset and reused instead of freed (up to
+    // CHUNK_POOL_MAX), so walking back and forth never hits the heap.
+    static constexpr size_t CHUNK_POOL_MAX = 1024;
+    std::vector<Chunk*> m_chunkPool;
+    Chunk* AcquireChunk(const ChunkCoord& coord);
+    void RecycleChunk(Chunk* chunk);
+    void EvictChunk(Chunk* stale);
 
     void FrustumCull();
+    // LOD columns inside the detail distance only fill in until the
+    // chunks' column there has a mesh
+    bool IsLodCovered(const ColumnKey& key, int centerX, int centerZ) const;
     void BuildLoadSpiral();
+
+    // ── Shadow casters ──
+    // Light-space cull: the view frustum, cut at the shadow distance, with
+    // each plane moved out by how far the light sweep carries along it
+    void CullShadowCasters();
+    bool m_shadowCasting = false;
+    WorldVec3 m_shadowLightDir;         // normalized, the way light travels
+    uint8_t m_shadowLitFaces = 0;       // BlockFace bits facing the sun
+    float m_shadowDistance = 0.0f;
+    float m_shadowSweep = 0.0f;
+    std::vector<uint32_t> m_shadowSlots;
+    std::vector<uint32_t> m_shadowDrawList;
+
+    // ── Distance LOD ──
+    // LOD columns live in the column table under yBand LOD_BAND. They cover
+    // the ring from LOD_HYSTERESIS inside the detail distance out to the
+    // render distance; where the ring overlaps the chunks, a LOD column is
+    // drawn only until the detail column has a mesh. A column changes level
+    // only once it is LOD_HYSTERESIS chunks past the boundary, so walking
+    // along a ring edge does not rebuild it back and forth.
+    static constexpr int LOD_BAND = -1;
+    static_assert(LOD_BAND < WorldGenerator::MIN_CHUNK_Y / BAND_SIZE, "LOD keys must not collide with bands");
+    static constexpr int LOD_HYSTERESIS = 2;
+    static constexpr size_t MAX_LOD_JOBS = 64;          // builds in flight (multithreaded)
+    static constexpr size_t SYNC_LOD_BUILDS = 2;        // builds per frame (synchronous)
+    static constexpr size_t LOD_UPLOADS_PER_FRAME = 16;
+    struct LodRequest { int cx, cz, level; };
+    // A build travels main thread -> worker -> main thread and back to the
+    // pool, so its mesh buffers keep their capacity. Horizon tiles use the
+    // same builds (cx, cz are then tile coordinates).
+    struct LodBuild {
+        int cx = 0, cz = 0, level = 0;
+        bool horizon = false;
+        HorizonTerrain::Rect hole;
+        ChunkMeshData opaque;
+        ChunkMeshData water;
+    };
+    void ApplyDetailDistance();
+    bool IsInLodRange(int dist) const {
+        return m_detailDistance < m_renderDistance &&
+               dist >= m_detailDistance - LOD_HYSTERESIS && dist <= m_renderDistance;
+    }
+    int GetLodLevel(int dist) const;
+    // Level for a column at `dist` now drawn at `current` (0: none)
+    int ChooseLodLevel(int dist, int current) const;
+    void ScanLodColumns(int centerX, int centerZ);
+    void UpdateLod(int centerX, int centerZ);
+    void BuildLodColumn(LodBuild& build, LodMesher::Scratch& scratch);
+    void FinishLodBuild(LodBuild& build, int centerX, int centerZ);
+    void UploadLodColumn(const LodBuild& build);
+    LodBuild* AcquireLodBuild();
+    std::array<int, 3> m_lodDistances{16, 24, 32};
+    int m_detailDistance = 8;
+    bool m_lodRescan = true;
+    std::vector<LodRequest> m_lodRequests;              // nearest at the back
+    FlatHashMap<ColumnKey, int, ColumnKeyHash> m_lodPending;   // building: key -> level
+    std::vector<std::unique_ptr<LodBuild>> m_lodBuilds; // owns every build
+    std::vector<LodBuild*> m_lodBuildPool;
+    std::vector<LodBuild*> m_lodBatch;
+    std::unique_ptr<LodMesher::Scratch> m_lodScratch;   // synchronous builds
+    size_t m_lodColumnCount = 0;
+    size_t m_lodColumnBytes = 0;
+
+    // ── Horizon ──
+    // Tiles live in the column table under yBand HORIZON_BAND - level and
+    // share the LOD builds, pending map and worker queues; LOD requests go
+    // first. A tile is requested when it enters the layout or its hole no
+    // longer matches the one it was built with (the render distance edge
+    // moved across it). Edits to saved chunks do not show out there.
+    static constexpr int HORIZON_BAND = LOD_BAND - 1;
+    static_assert(HORIZON_BAND - HorizonTerrain::MAX_LEVELS >= ChunkKey::Y_MIN, "horizon bands must fit a chunk key");
+    static ColumnKey HorizonKey(int tx, int tz, int level) { return {tx, HORIZON_BAND - level, tz}; }
+    void ScanHorizon(int centerX, int centerZ);
+    void FinishHorizonBuild(LodBuild& build);
+    int m_horizonDistance = 0;
+    std::vector<HorizonTerrain::Tile> m_horizonLayout;
+    FlatHashMap<ColumnKey, HorizonTerrain::Rect, ColumnKeyHash> m_horizonWanted;    // key -> hole
+    FlatHashMap<ColumnKey, HorizonTerrain::Rect, ColumnKeyHash> m_horizonResident;  // hole built with
+    std::vector<LodRequest> m_horizonRequests;          // nearest at the back
+    size_t m_horizonTileCount = 0;
+    size_t m_horizonTileBytes = 0;
+
+    // Visibility graph: a BFS over chunks from the camera chunk that leaves
+    // each chunk only through faces connected to the one it entered by
+    // (Chunk::GetFaceConnectivity), never heads back against a direction it
+    // already moved in and drops chunks outside the frustum. Chunks it
+    // reaches get this frame's stamp; one extra layer above the world lets
+    // lines of sight pass over the terrain.
+    struct VisNode {
+        int cx, cy, cz;
+        uint8_t entry;      // BlockFace entered through, VIS_NO_FACE at the camera
+        uint8_t dirs;       // directions moved so far (bit per BlockFace)
+    };
+    static constexpr uint8_t VIS_NO_FACE = 6;
+    void TraverseVisibility();
+    int GetVisIndex(int cx, int cy, int cz) const;
+    bool IsColumnReachable(const ColumnKey& key) const;
+    bool m_occlusionCulling = true;
+    bool m_visTraversed = false;        // stamps are valid for FrustumCull
+    uint32_t m_visFrame = 0;
+    std::vector<uint32_t> m_visStamp;   // per grid cell (+ sky layer)
+    std::vector<VisNode> m_visQueue;
+
+    // Occlusion buffer: the occluders of up to MAX_OCCLUDERS of the nearest
+    // columns in view, drawn front to back each cull. Off while the camera
+    // is below the generated surface (inside what occluders take as solid).
+    static constexpr size_t MAX_OCCLUDERS = 32;
+    static constexpr float OCCLUDER_DIST = 128.0f;
+    void DrawOccluders(size_t visible);
+    bool m_occlusionBufferEnabled = true;
+    bool m_hasViewProj = false;
+    WorldViewProj m_viewProj;
+    OcclusionBuffer m_occlusionBuffer;
+    std::vector<std::pair<float, uint32_t>> m_occluderScratch;     // (XZ distance², slot)
+
+    // Telemetry
+    void UpdateTelemetry();
+    void RecordFirstDraw(ColumnMesh& col);
+    ChunkPipelineTelemetry m_telemetry;
+    // Columns waiting for their first mesh: key -> time they were requested
+    FlatHashMap<ColumnKey, std::chrono::steady_clock::time_point, ColumnKeyHash> m_columnRequests;
+    size_t m_columnMeshCount = 0;
+    size_t m_columnMeshBytes = 0;
+    uint64_t m_frameUploadBytes = 0;
+    uint64_t m_windowUploadBytes = 0;
+    uint64_t m_windowPeakUpload = 0;
+    int m_windowFrames = 0;
+    std::chrono::steady_clock::time_point m_windowStart{};
+    StreamStats m_windowStats;
     void ForceUnloadChunk(Chunk* chunk);
 
     std::vector<Chunk*> m_chunkGrid;
@@ -162,11 +513,12 @@ private:
     std::vector<std::pair<int, int>> m_loadSpiral;
 
     std::vector<ChunkCoord> m_pendingLoad;
-    std::unordered_set<ChunkCoord, ChunkCoordHash> m_pendingSet;
     std::vector<ChunkCoord> m_pendingUnload;
-    Sleak::SceneBase* m_scene = nullptr;
-    Sleak::RefPtr<Sleak::Material> m_material;
-    Sleak::RefPtr<Sleak::Material> m_waterMaterial;
+    NullChunkRenderBackend m_nullBackend;
+    ChunkRenderBackend* m_backend = &m_nullBackend;
+    bool m_hasView = false;
+    WorldVec3 m_viewPos;
+    WorldFrustum m_viewFrustum;
     int m_renderDistance = 8;
     int m_chunksPerFrame = 32;
     int m_uploadsPerFrame = 8;   // Base uploads/frame; adaptive logic in Update() can double this
@@ -180,24 +532,36 @@ private:
     float m_lastPlayerZ = 0.0f;
     bool m_oomThisFrame = false;
     WorldGenerator m_generator;
+    ColumnStore m_columnStore;
 
     // Multithreading
     bool m_multithreaded = false;
+    int m_workerCount = 0;
     std::vector<std::thread> m_workers;
-    std::mutex m_taskMutex;
-    std::condition_variable m_taskCV;
+    CountingMutex m_taskMutex;
+    std::condition_variable_any m_taskCV;
     std::vector<Chunk*> m_taskQueue;
-    std::mutex m_readyMutex;
+    CountingMutex m_readyMutex;
     std::vector<Chunk*> m_readyQueue;
+    std::vector<LodBuild*> m_lodTaskQueue;      // under m_taskMutex
+    std::vector<LodBuild*> m_lodReadyQueue;     // under m_readyMutex
     std::atomic<bool> m_shutdown{false};
 
+    std::atomic<uint64_t> m_statGenerated{0};
+    std::atomic<uint64_t> m_statMeshed{0};
+    std::atomic<uint64_t> m_statRemeshed{0};
+    std::atomic<uint64_t> m_statLodBuilt{0};
+    std::atomic<uint64_t> m_statHorizonBuilt{0};
+    uint64_t m_statColumnsBuilt = 0;
+
     // Saved block data for chunk restoration
-    std::unordered_map<int64_t, std::array<uint8_t, 4096>> m_savedBlockData;
-    static int64_t PackCoord(int32_t cx, int32_t cy, int32_t cz);
+    SavedChunkMap m_savedBlockData;
+    // Copies saved blocks into `chunk`; false if the chunk was never saved
+    bool RestoreSavedBlocks(Chunk* chunk) const;
 
     // Per-column max filled chunk-Y cache. Terrain is deterministic so entries
     // never go stale. Eliminates repeated noise evaluation for the same column.
-    std::unordered_map<uint64_t, int> m_columnMaxCyCache;
+    FlatHashMap<uint64_t, int> m_columnMaxCyCache;
     int GetCachedColumnMaxCy(int cx, int cz);
     static uint64_t PackColumnXZ(int cx, int cz) {
         return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32)
@@ -0,0 +1,181 @@
+#ifndef _CHUNK_RENDER_BACKEND_HPP_
+#define _CHUNK_RENDER_BACKEND_HPP_
+
+#include "Chunk.hpp"
+#include "FlatHashMap.hpp"
+#include "MeshHeap.hpp"
+#include <cstdint>
+#include <vector>
+
+// Handle to an uploaded column mesh. 0 = no mesh.
+using ChunkMeshId = uint32_t;
+
+enum class ChunkRenderPass : uint8_t {
+    Opaque,
+    Water,
+    ShadowCaster        // opaque meshes only the shadow map needs
+};
+
+// Everything ChunkManager needs from the renderer: upload/free merged column
+// meshes and draw them per pass. The engine implementation lives in SleakGame
+// (MeshBatchRenderBackend); the world core only talks to this interface, so
+// it builds and runs without a GPU.
+class ChunkRenderBackend {
+public:
+    virtual ~ChunkRenderBackend() = default;
+
+    // Returns 0 when the mesh could not be allocated (out of memory)
+    virtual ChunkMeshId CreateMesh(const ChunkMeshData& data) = 0;
+    virtual void DestroyMesh(ChunkMeshId id) = 0;
+    // Called once per ChunkManager::Update after the uploads; backends that
+    // sub-allocate meshes from shared buffers defragment a little here
+    virtual void Compact() {}
+
+    virtual void BeginPass(ChunkRenderPass pass) = 0;
+    virtual void Draw(ChunkMeshId id) = 0;
+    // Only the BlockFace directions set in `faces` (bit 1 << face) of a mesh
+    // created with direction ranges, as index sub-ranges of its one index
+    // buffer. Backends that cannot draw ranges draw it whole, and report so
+    // below so that ChunkManager does not count directions as skipped.
+    virtual void DrawFaces(ChunkMeshId id, uint8_t faces) {
+        (void)faces;
+        Draw(id);
+    }
+    virtual bool DrawsFaceRanges() const { return false; }
+    virtual void EndPass() = 0;
+    // Whether ShadowCaster draws reach only the shadow map. Without such a
+    // pass ChunkManager submits no casters, since they would also land in
+    // the view.
+    virtual bool HasShadowCasterPass() const { return false; }
+
+protected:
+    struct IndexRange {
+        uint32_t first;
+        uint32_t count;
+    };
+    static constexpr int MAX_FACE_RANGES = 3;
+
+    // The directions in `faces` as index ranges of a mesh whose indices are
+    // grouped by direction (counts = ChunkMeshData::faceIndexCounts).
+    // Neighbouring directions merge, so there are at most 3. Returns the count.
+    static int FaceRanges(const uint32_t counts[6], uint8_t faces, IndexRange out[MAX_FACE_RANGES]) {
+        int ranges = 0;
+        uint32_t first = 0;
+        bool open = false;
+        for (int face = 0; face < 6; ++face) {
+            uint32_t count = counts[face];
+            if (!(faces & (1u << face))) {
+                if (count > 0) open = false;
+            } else if (count > 0) {
+                if (open) out[ranges - 1].count += count;
+                else out[ranges++] = {first, count};
+                open = true;
+            }
+            first += count;
+        }
+        return ranges;
+    }
+};
+
+// Headless backend: keeps only sizes, so tools and benchmarks can run the
+// full streaming pipeline and still see what would have been uploaded.
+// Meshes are placed in a MeshArena as a backend with shared vertex and index
+// buffers would lay them out, so its page (buffer) creations and
+// defragmentation moves can be measured too. MeshBatchRenderBackend does
+// not do this: MeshBatch has no offset uploads.
+class NullChunkRenderBackend : public ChunkRenderBackend {
+public:
+    static constexpr int COMPACT_MOVES = 8;     // per Compact call
+
+    // Simulated memory limit for uploads (0 = unlimited)
+    void SetBudgetBytes(size_t bytes) { m_budgetBytes = bytes; }
+
+    ChunkMeshId CreateMesh(const ChunkMeshData& data) override {
+        size_t bytes = data.vertices.size() * sizeof(WorldVertex)
+                     + data.indices.size() * sizeof(uint32_t);
+        if (m_budgetBytes != 0 && m_liveBytes + bytes > m_budgetBytes) return 0;
+        MeshArena::Allocation allocation;
+        if (!m_arena.Allocate(static_cast<uint32_t>(data.vertices.size()),
+                              static_cast<uint32_t>(data.indices.size()), allocation))
+            return 0;
+        ChunkMeshId id = ++m_nextId;
+        if (id == 0) id = ++m_nextId;
+        Mesh& mesh = m_meshes[id];
+        mesh = {bytes, allocation, static_cast<uint32_t>(data.indices.size()), {}, data.HasFaceRanges()};
+        if (mesh.ranged)
+            std::copy(std::begin(data.faceIndexCounts), std::end(data.faceIndexCounts), mesh.faceIndices);
+        m_liveBytes += bytes;
+        m_uploadedBytes += bytes;
+        ++m_uploads;
+        return id;
+    }
+
+    void DestroyMesh(ChunkMeshId id) override {
+        auto it = m_meshes.find(id);
+        if (it == m_meshes.end()) return;
+        m_liveBytes -= it->second.bytes;
+        m_arena.Free(it->second.allocation);
+        m_meshes.erase(it);
+    }
+
+    // Handles survive the moves, so there is nothing to copy or patch
+    void Compact() override {
+        m_compactMoves.clear();
+        m_arena.Compact(COMPACT_MOVES, m_compactMoves);
+    }
+
+    void BeginPass(ChunkRenderPass) override {}
+    void Draw(ChunkMeshId id) override {
+        ++m_draws;
+        auto it = m_meshes.find(id);
+        if (it != m_meshes.end()) m_drawnIndices += it->second.indices;
+    }
+
+    void DrawFaces(ChunkMeshId id, uint8_t faces) override {
+        auto it = m_meshes.find(id);
+        if (it == m_meshes.end() || !it->second.ranged) {
+            Draw(id);
+            return;
+        }
+        // One draw per range, as a GPU backend issues them
+        IndexRange ranges[MAX_FACE_RANGES];
+        int count = FaceRanges(it->second.faceIndices, faces, ranges);
+        m_draws += count;
+        for (int i = 0; i < count; ++i) m_drawnIndices += ranges[i].count;
+    }
+    void EndPass() override {}
+    bool HasShadowCasterPass() const override { return true; }
+    bool DrawsFaceRanges() const override { return true; }
+
+    size_t GetLiveMeshCount() const { return m_meshes.size(); }
+    size_t GetLiveBytes() const { return m_liveBytes; }
+    uint64_t GetUploadedBytes() const { return m_uploadedBytes; }
+    uint64_t GetUploadCount() const { return m_uploads; }
+    uint64_t GetDrawCount() const { return m_draws; }
+    uint64_t GetDrawnIndices() const { return m_drawnIndices; }
+    // One vertex and one index buffer per arena page
+    uint64_t GetBuffersCreated() const { return m_arena.GetPagesCreated() * 2; }
+    const MeshArena& GetArena() const { return m_arena; }
+
+private:
+    struct Mesh {
+        size_t bytes;
+        MeshArena::Allocation allocation;
+        uint32_t indices;
+        uint32_t faceIndices[6];
+        bool ranged;
+    };
+
+    FlatHashMap<ChunkMeshId, Mesh> m_meshes;
+    MeshArena m_arena;
+    std::vector<MeshArena::Move> m_compactMoves;
+    ChunkMeshId m_nextId = 0;
+    size_t m_budgetBytes = 0;
+    size_t m_liveBytes = 0;
+    uint64_t m_uploadedBytes = 0;
+    uint64_t m_uploads = 0;
+    uint64_t m_draws = 0;
+    uint64_t m_drawnIndices = 0;
+};
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef _CHUNK_TELEMETRY_HPP_
+#define _CHUNK_TELEMETRY_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+// Fixed log2 histogram of latencies in milliseconds. Bucket 0 is [0, 1) ms,
+// bucket i is [2^(i-1), 2^i) ms, the last bucket is open-ended (>= 16 s).
+class LatencyHistogram {
+public:
+    static constexpr int BUCKETS = 16;
+
+    void Record(double ms) {
+        int b = 0;
+        while (b < BUCKETS - 1 && ms >= BucketUpperMs(b)) ++b;
+        ++m_buckets[b];
+        ++m_count;
+        m_sumMs += ms;
+        if (ms > m_maxMs) m_maxMs = ms;
+    }
+
+    void Reset() { *this = LatencyHistogram(); }
+
+    uint64_t GetCount() const { return m_count; }
+    uint64_t GetBucket(int i) const { return m_buckets[i]; }
+    double GetMeanMs() const { return m_count ? m_sumMs / static_cast<double>(m_count) : 0.0; }
+    double GetMaxMs() const { return m_maxMs; }
+
+    // Upper edge of bucket i (the last bucket reports the observed max)
+    static double BucketUpperMs(int i) { return static_cast<double>(1u << i); }
+
+    // Upper edge of the bucket holding the p-quantile (0..1), capped at the max
+    double Percentile(double p) const {
+        if (m_count == 0) return 0.0;
+        uint64_t target = static_cast<uint64_t>(p * static_cast<double>(m_count - 1)) + 1;
+        uint64_t seen = 0;
+        for (int b = 0; b < BUCKETS; ++b) {
+            seen += m_buckets[b];
+            if (seen >= target)
+                return (b == BUCKETS - 1 || BucketUpperMs(b) > m_maxMs) ? m_maxMs : BucketUpperMs(b);
+        }
+        return m_maxMs;
+    }
+
+private:
+    uint64_t m_buckets[BUCKETS] = {};
+    uint64_t m_count = 0;
+    double m_sumMs = 0.0;
+    double m_maxMs = 0.0;
+};
+
+// Live chunk pipeline metrics published by ChunkManager. Queue depths and the
+// per-frame upload figure are refreshed every Update; rates and per-chunk
+// remesh figures once per second.
+struct ChunkPipelineTelemetry {
+    // Queue depths
+    size_t pendingLoad = 0;
+    size_t pendingUnload = 0;
+    size_t taskQueue = 0;
+    size_t readyQueue = 0;
+    size_t dirtyColumns = 0;
+    size_t remeshSet = 0;
+
+    // Jobs per second over the last window
+    float generatedPerSec = 0.0f;
+    float meshedPerSec = 0.0f;       // all mesh jobs, including remeshes
+    float remeshedPerSec = 0.0f;     // mesh jobs for chunks that were meshed before
+    float columnsBuiltPerSec = 0.0f;
+
+    // Remeshing: mesh jobs per active chunk (1.0 = every chunk meshed once)
+    float meshesPerChunkAvg = 0.0f;
+    uint32_t meshesPerChunkMax = 0;
+
+    // Column mesh uploads (merged WorldVertex + index bytes)
+    uint64_t uploadBytesLastFrame = 0;
+    uint64_t uploadBytesPeakFrame = 0;   // within the last window
+    float uploadBytesPerFrameAvg = 0.0f;
+
+    // Resident column meshes
+    size_t columnMeshes = 0;
+    size_t columnMeshBytes = 0;
+    size_t lodColumns = 0;              // of those, LOD columns (LodMesher)
+    size_t lodColumnBytes = 0;
+    size_t lodQueue = 0;                // LOD columns requested, or builds in flight
+    size_t horizonTiles = 0;            // of those, horizon tiles (HorizonTerrain)
+    size_t horizonTileBytes = 0;
+    size_t horizonQueue = 0;            // horizon tiles requested (building: in lodQueue)
+
+    // Mesh budget (0 = unlimited), columns evicted to stay under it so
+    // far, and the detail distance it forced down to (0 = none)
+    size_t meshBudgetBytes = 0;
+    uint64_t evictedColumns = 0;
+    int budgetDetailCap = 0;
+
+    // Last cull: columns passing the distance and frustum tests, those of
+    // them dropped by the cave-culling visibility graph, and those hidden
+    // behind the occluders in the occlusion buffer
+    size_t frustumColumns = 0;
+    size_t occludedColumns = 0;
+    size_t occlusionRejectedColumns = 0;
+    size_t occluderColumns = 0;         // columns drawn into the buffer
+    // Columns casting shadows into the view (light-space cull), and those
+    // of them outside the view, drawn in the shadow caster pass only
+    size_t shadowCasterColumns = 0;
+    size_t shadowOnlyColumns = 0;
+    // Opaque triangles the camera pass draws, and of those it leaves out for
+    // facing away from the camera (whole directions per column) the ones no
+    // pass draws and the ones facing the sun, which the caster pass draws
+    size_t drawnTriangles = 0;
+    size_t backfaceSkippedTriangles = 0;
+    size_t shadowFaceTriangles = 0;
+
+    // Time spent ordering the last cull's draw lists, and how many lists
+    // so far needed a full radix sort (the rest reused last frame's order)
+    float drawSortMs = 0.0f;
+    uint64_t drawListResorts = 0;
+
+    // From a column entering the load queue to its first draw call
+    LatencyHistogram timeToVisible;
+};
+
+#endif
@@ -0,0 +1,37 @@
+#ifndef _CHUNK_VISIBILITY_HPP_
+#define _CHUNK_VISIBILITY_HPP_
+
+#include "Block.hpp"
+#include <cstdint>
+
+// Face-to-face connectivity of a chunk through non-opaque blocks, for cave
+// culling: a line of sight that enters a chunk through one face can only
+// leave it through a face connected to the first. Stored as one bit per
+// unordered pair of the six BlockFaces (15 bits).
+class ChunkVisibility {
+public:
+    static constexpr uint16_t NONE = 0;
+    static constexpr uint16_t ALL = 0x7FFF;
+
+    // Flood fills the non-opaque blocks of a chunk (Chunk block layout)
+    // from its boundary. Blocks outside the chunk are not consulted.
+    static uint16_t Compute(const uint8_t* blocks);
+
+    static uint16_t PairBit(BlockFace a, BlockFace b) {
+        int i = static_cast<int>(a), j = static_cast<int>(b);
+        if (i > j) { int t = i; i = j; j = t; }
+        // Row-major index into the upper triangle of the 6x6 pair matrix
+        return static_cast<uint16_t>(1u << (i * 6 - i * (i + 1) / 2 + (j - i - 1)));
+    }
+
+    // A face always connects to itself
+    static bool Connected(uint16_t set, BlockFace a, BlockFace b) {
+        return a == b || (set & PairBit(a, b)) != 0;
+    }
+
+    static BlockFace Opposite(BlockFace face) {
+        return static_cast<BlockFace>(static_cast<int>(face) ^ 1);
+    }
+};
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef _CODEC_KERNELS_HPP_
+#define _CODEC_KERNELS_HPP_
+
+#include <cstdint>
+#include <cstddef>
+
+// Hot loops of the region codec (checksum, run scanning, uniform detection)
+// with one implementation per tier. The best tier the CPU supports is picked
+// at startup; SetTier can force a lower one for equivalence checks/benchmarks.
+enum class KernelTier : uint8_t {
+    Scalar = 0,   // byte at a time (reference)
+    Portable = 1, // slicing-by-8 CRC, 64-bit word compares
+    SIMD128 = 2,  // SSE4.1 + PCLMUL / NEON + ARMv8 CRC
+    SIMD256 = 3,  // AVX2 scanning (CRC stays on PCLMUL)
+    COUNT
+};
+
+class CodecKernels {
+public:
+    static KernelTier GetTier();
+    static KernelTier GetMaxTier();
+    // Clamped to GetMaxTier(). Returns the tier actually selected.
+    static KernelTier SetTier(KernelTier tier);
+    static const char* GetTierName(KernelTier tier);
+
+    // Standard CRC-32 (IEEE, reflected, as in zlib)
+    static uint32_t CRC32(const uint8_t* data, size_t size);
+
+    // Length of the run of data[0] at the start of data, capped at maxRun.
+    // Returns 0 when size == 0.
+    static size_t RunLength(const uint8_t* data, size_t size, size_t maxRun);
+
+    // True when every byte equals data[0] (and for size == 0)
+    static bool IsUniform(const uint8_t* data, size_t size);
+
+    // Per-tier entry points, bypassing dispatch (the tier must be supported)
+    static uint32_t CRC32(KernelTier tier, const uint8_t* data, size_t size);
+    static size_t RunLength(KernelTier tier, const uint8_t* data, size_t size, size_t maxRun);
+};
+
+#endif
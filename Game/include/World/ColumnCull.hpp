@@ -0,0 +1,70 @@
+#ifndef _COLUMN_CULL_HPP_
+#define _COLUMN_CULL_HPP_
+
+#include "CodecKernels.hpp"
+#include "WorldMath.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Axis-aligned boxes as structure-of-arrays. The arrays are padded to a
+// multiple of LANES with boxes that are never visible, so the culling
+// kernels always run whole blocks. Removal moves the last box into the hole.
+class ColumnBounds {
+public:
+    static constexpr size_t LANES = 8;
+
+    size_t Size() const { return m_size; }
+    size_t PaddedSize() const { return m_minX.size(); }
+
+    // Returns the index of the new box
+    size_t Append(const WorldVec3& min, const WorldVec3& max);
+    void Set(size_t i, const WorldVec3& min, const WorldVec3& max);
+    // Moves the last box into slot i
+    void SwapRemove(size_t i);
+    void Reserve(size_t count);
+    void Clear();
+
+    const float* MinX() const { return m_minX.data(); }
+    const float* MinY() const { return m_minY.data(); }
+    const float* MinZ() const { return m_minZ.data(); }
+    const float* MaxX() const { return m_maxX.data(); }
+    const float* MaxY() const { return m_maxY.data(); }
+    const float* MaxZ() const { return m_maxZ.data(); }
+
+private:
+    void Resize(size_t count);
+    void SetEmpty(size_t i);
+
+    std::vector<float> m_minX, m_minY, m_minZ;
+    std::vector<float> m_maxX, m_maxY, m_maxZ;
+    size_t m_size = 0;
+};
+
+// Per-frame visibility of column boxes: a horizontal (XZ) draw distance, a
+// radius around the camera that is always visible, then the view frustum.
+// Each tier tests ColumnBounds::LANES boxes per step (AVX2: one 8-wide
+// register, SSE2 / NEON: two 4-wide) and writes the visible indices compacted
+// and ascending. Every tier returns exactly what the scalar loop returns.
+class ColumnCull {
+public:
+    struct Params {
+        const WorldFrustum* frustum = nullptr;  // nullptr: no plane test
+        float camX = 0.0f;
+        float camZ = 0.0f;
+        float drawDistSq = 0.0f;    // farther (XZ) is never visible
+        float forceDistSq = 0.0f;   // this close is visible outside the frustum
+    };
+
+    // `out` must hold bounds.PaddedSize() indices. Returns the visible count.
+    // Dispatches on CodecKernels::GetTier().
+    static size_t Cull(const ColumnBounds& bounds, const Params& params, uint32_t* out);
+
+    // Bypasses dispatch (the tier must be supported). Portable runs the
+    // scalar loop.
+    static size_t Cull(KernelTier tier, const ColumnBounds& bounds, const Params& params,
+                       uint32_t* out);
+    static const char* GetTierName(KernelTier tier);
+};
+
+#endif
@@ -0,0 +1,98 @@
+#ifndef _COLUMN_STORE_HPP_
+#define _COLUMN_STORE_HPP_
+
+#include <cstdint>
+#include <string>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+// Per-column terrain metadata produced by the 2D noise pass of WorldGenerator.
+// Stored verbatim in the memory-mapped file (little-endian).
+struct ColumnRecord {
+    uint64_t key;           // ColumnStore::PackKey(cx, cz)
+    uint8_t maxCy;          // highest chunk Y that can hold blocks
+    uint8_t reserved[7];
+    uint8_t heights[256];   // surface height, index x + z * 16
+    uint8_t biomes[256];    // Biome, same index
+};
+static_assert(sizeof(ColumnRecord) == 528, "ColumnRecord is a file format");
+
+// Seed-keyed, memory-mapped column store (columns.dat in the save directory).
+//
+// File: header, then records. The first `sortedCount` records are sorted by
+// key and found by binary search; records appended since the last compaction
+// follow and are indexed in memory. New columns stay in memory until Flush,
+// which appends them (or rewrites the file sorted once the tail grows).
+// A seed or generator version mismatch discards the file contents.
+//
+// Thread-safe: lookups and inserts may come from worker threads.
+class ColumnStore {
+public:
+    static constexpr uint32_t MAGIC = 0x434B4C53; // "SLKC"
+    static constexpr uint16_t CURRENT_VERSION = 1;
+
+    ColumnStore() = default;
+    ~ColumnStore();
+    ColumnStore(const ColumnStore&) = delete;
+    ColumnStore& operator=(const ColumnStore&) = delete;
+
+    // Drop everything and start an in-memory store for `seed` (no file)
+    void Reset(uint32_t seed);
+    // Map `path` if it exists and matches seed/generator; Flush writes there
+    bool Open(const std::string& path, uint32_t seed);
+    // Persist columns added since the last flush
+    bool Flush();
+
+    uint32_t GetSeed() const { return m_seed; }
+    size_t GetColumnCount() const;
+
+    bool Find(int cx, int cz, ColumnRecord& out) const;
+    bool FindMaxCy(int cx, int cz, int& maxCy) const;
+    bool FindSurface(int worldX, int worldZ, uint8_t& height, uint8_t& biome) const;
+    void Insert(const ColumnRecord& record);
+
+    static uint64_t PackKey(int cx, int cz) {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(cx)) << 32)
+             |  static_cast<uint64_t>(static_cast<uint32_t>(cz));
+    }
+
+private:
+    struct Header {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t recordSize;
+        uint32_t seed;
+        uint16_t generatorVersion;
+        uint16_t reserved0;
+        uint32_t sortedCount;
+        uint32_t reserved[3];
+    };
+    static_assert(sizeof(Header) == 32, "ColumnStore header is a file format");
+
+    const ColumnRecord* FindLocked(uint64_t key) const;
+    bool MapLocked();
+    void UnmapLocked();
+    bool RewriteLocked();
+
+    mutable std::shared_mutex m_mutex;
+    std::string m_path;
+    uint32_t m_seed = 0;
+
+    // Mapped file
+    void* m_mapping = nullptr;
+    size_t m_mappedSize = 0;
+#ifdef _WIN32
+    void* m_fileHandle = nullptr;
+    void* m_mapHandle = nullptr;
+#endif
+    const ColumnRecord* m_records = nullptr;
+    size_t m_sortedCount = 0;
+    size_t m_recordCount = 0;
+    std::unordered_map<uint64_t, size_t> m_tailIndex;  // appended, unsorted records
+
+    // Not yet written
+    std::unordered_map<uint64_t, ColumnRecord> m_pending;
+};
+
+#endif
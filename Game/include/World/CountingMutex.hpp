@@ -0,0 +1,57 @@
+#ifndef _COUNTING_MUTEX_HPP_
+#define _COUNTING_MUTEX_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+// Contention snapshot of a CountingMutex. All counters are cumulative.
+struct LockStats {
+    uint64_t acquisitions = 0;
+    uint64_t contended = 0;     // acquisitions that found the lock held
+    uint64_t waitNs = 0;        // total time spent blocked in contended acquisitions
+};
+
+// std::mutex that counts how often it is taken and how long callers block.
+// The uncontended path is a try_lock plus one relaxed increment; the clock
+// is only read when the lock is already held. Works with lock_guard /
+// unique_lock; pair it with std::condition_variable_any.
+class CountingMutex {
+public:
+    void lock() {
+        m_acquisitions.fetch_add(1, std::memory_order_relaxed);
+        if (m_mutex.try_lock()) return;
+        auto start = std::chrono::steady_clock::now();
+        m_mutex.lock();
+        auto waited = std::chrono::steady_clock::now() - start;
+        m_contended.fetch_add(1, std::memory_order_relaxed);
+        m_waitNs.fetch_add(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(waited).count()),
+            std::memory_order_relaxed);
+    }
+
+    bool try_lock() {
+        if (!m_mutex.try_lock()) return false;
+        m_acquisitions.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void unlock() { m_mutex.unlock(); }
+
+    LockStats GetStats() const {
+        LockStats s;
+        s.acquisitions = m_acquisitions.load(std::memory_order_relaxed);
+        s.contended = m_contended.load(std::memory_order_relaxed);
+        s.waitNs = m_waitNs.load(std::memory_order_relaxed);
+        return s;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::atomic<uint64_t> m_acquisitions{0};
+    std::atomic<uint64_t> m_contended{0};
+    std::atomic<uint64_t> m_waitNs{0};
+};
+
+#endif
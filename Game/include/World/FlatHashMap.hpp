@@ -0,0 +1,264 @@
+#ifndef _FLAT_HASH_MAP_HPP_
+#define _FLAT_HASH_MAP_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// Open-addressing hash containers (linear probing over one slot array) for
+// the per-frame chunk bookkeeping. Unlike std::unordered_*, inserting into a
+// table that has room never allocates and clear() keeps the capacity, so a
+// steady working set runs without touching the heap; the table only grows
+// (doubling) past half full of live entries.
+//
+// Erase leaves a tombstone, so erasing through an iterator keeps the others
+// valid (as with std::unordered_*). Tombstones are swept in place, without
+// allocating, when they crowd the table. Inserting may move entries and
+// invalidates iterators. Keys and values must be default-constructible.
+template <typename Key, typename Slot, typename Hash, typename KeyOf>
+class FlatHashTable {
+protected:
+    enum Ctrl : uint8_t { EMPTY = 0, FULL = 1, TOMBSTONE = 2, MOVING = 3 };
+
+public:
+    template <bool Const>
+    class Iterator {
+    public:
+        using Owner = std::conditional_t<Const, const FlatHashTable, FlatHashTable>;
+        using Ref = std::conditional_t<Const, const Slot&, Slot&>;
+        using Ptr = std::conditional_t<Const, const Slot*, Slot*>;
+
+        Iterator() = default;
+        Iterator(Owner* table, size_t index) : m_table(table), m_index(index) { SkipFree(); }
+        // iterator -> const_iterator
+        template <bool C, typename = std::enable_if_t<Const && !C>>
+        Iterator(const Iterator<C>& o) : m_table(o.m_table), m_index(o.m_index) {}
+
+        Ref operator*() const { return m_table->m_slots[m_index]; }
+        Ptr operator->() const { return &m_table->m_slots[m_index]; }
+        Iterator& operator++() { ++m_index; SkipFree(); return *this; }
+        bool operator==(const Iterator& o) const { return m_index == o.m_index; }
+        bool operator!=(const Iterator& o) const { return m_index != o.m_index; }
+
+    private:
+        friend class FlatHashTable;
+        template <bool> friend class Iterator;
+        void SkipFree() {
+            while (m_index < m_table->m_ctrl.size() && m_table->m_ctrl[m_index] != FULL) ++m_index;
+        }
+        Owner* m_table = nullptr;
+        size_t m_index = 0;
+    };
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+    size_t capacity() const { return m_slots.size(); }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, m_slots.size()); }
+    const_iterator begin() const { return const_iterator(this, 0); }
+    const_iterator end() const { return const_iterator(this, m_slots.size()); }
+
+    iterator find(const Key& key) {
+        size_t i = FindIndex(key);
+        return (i == NPOS) ? end() : iterator(this, i);
+    }
+    const_iterator find(const Key& key) const {
+        size_t i = FindIndex(key);
+        return (i == NPOS) ? end() : const_iterator(this, i);
+    }
+    size_t count(const Key& key) const { return FindIndex(key) != NPOS ? 1 : 0; }
+    bool contains(const Key& key) const { return FindIndex(key) != NPOS; }
+
+    size_t erase(const Key& key) {
+        size_t i = FindIndex(key);
+        if (i == NPOS) return 0;
+        EraseAt(i);
+        return 1;
+    }
+    // Returns the iterator following `it`
+    template <bool Const>
+    Iterator<Const> erase(Iterator<Const> it) {
+        EraseAt(it.m_index);
+        return Iterator<Const>(this, it.m_index + 1);
+    }
+
+    // Empties the table, keeping its capacity
+    void clear() {
+        for (size_t i = 0; i < m_ctrl.size(); ++i) {
+            if (m_ctrl[i] != EMPTY) m_slots[i] = Slot{};
+            m_ctrl[i] = EMPTY;
+        }
+        m_size = 0;
+        m_tombstones = 0;
+    }
+
+    // Grows so that `count` entries fit without another allocation
+    void reserve(size_t count) {
+        size_t cap = MIN_CAPACITY;
+        while (cap < count * 2) cap *= 2;
+        if (cap > capacity()) Rehash(cap);
+    }
+
+protected:
+    static constexpr size_t NPOS = ~size_t(0);
+    static constexpr size_t MIN_CAPACITY = 16;
+
+    // Fibonacci hashing on top of Hash, so weak hashes (identity ints) still
+    // spread over the power-of-two table
+    size_t Home(const Key& key) const {
+        uint64_t h = static_cast<uint64_t>(Hash{}(key)) * 0x9E3779B97F4A7C15ull;
+        return static_cast<size_t>(h >> m_shift);
+    }
+
+    size_t FindIndex(const Key& key) const {
+        if (m_slots.empty()) return NPOS;
+        size_t mask = m_slots.size() - 1;
+        for (size_t i = Home(key);; i = (i + 1) & mask) {
+            if (m_ctrl[i] == EMPTY) return NPOS;
+            if (m_ctrl[i] == FULL && KeyOf::Get(m_slots[i]) == key) return i;
+        }
+    }
+
+    // Slot holding `key` (second = true) or a claimed free slot for it
+    std::pair<size_t, bool> FindOrClaim(const Key& key) {
+        size_t found = FindIndex(key);
+        if (found != NPOS) return {found, true};
+
+        // Keep at least 1/8 of the slots empty so probes terminate
+        if ((m_size + m_tombstones + 1) * 8 > capacity() * 7) {
+            if ((m_size + 1) * 2 > capacity())
+                Rehash(std::max(MIN_CAPACITY, capacity() * 2));
+            else
+                RehashInPlace();
+        }
+        size_t mask = m_slots.size() - 1;
+        for (size_t i = Home(key);; i = (i + 1) & mask) {
+            if (m_ctrl[i] == FULL) continue;
+            if (m_ctrl[i] == TOMBSTONE) --m_tombstones;
+            m_ctrl[i] = FULL;
+            ++m_size;
+            return {i, false};
+        }
+    }
+
+    void EraseAt(size_t i) {
+        m_slots[i] = Slot{};
+        m_ctrl[i] = TOMBSTONE;
+        --m_size;
+        ++m_tombstones;
+    }
+
+    void Rehash(size_t newCapacity) {
+        std::vector<Slot> oldSlots = std::exchange(m_slots, std::vector<Slot>(newCapacity));
+        std::vector<uint8_t> oldCtrl = std::exchange(m_ctrl, std::vector<uint8_t>(newCapacity, EMPTY));
+        m_shift = 64;
+        for (size_t c = newCapacity; c > 1; c >>= 1) --m_shift;
+        m_tombstones = 0;
+
+        size_t mask = newCapacity - 1;
+        for (size_t j = 0; j < oldCtrl.size(); ++j) {
+            if (oldCtrl[j] != FULL) continue;
+            size_t i = Home(KeyOf::Get(oldSlots[j]));
+            while (m_ctrl[i] == FULL) i = (i + 1) & mask;
+            m_slots[i] = std::move(oldSlots[j]);
+            m_ctrl[i] = FULL;
+        }
+    }
+
+    // Drops the tombstones at the same capacity. Every live entry is marked
+    // MOVING, then placed at the first non-FULL slot of its probe sequence
+    // (swapping with a MOVING entry found there, which is then placed next).
+    // FULL slots never move again, so no probe path is ever broken.
+    void RehashInPlace() {
+        for (auto& c : m_ctrl) c = (c == FULL) ? MOVING : EMPTY;
+        m_tombstones = 0;
+
+        size_t mask = m_slots.size() - 1;
+        for (size_t i = 0; i < m_slots.size(); ++i) {
+            while (m_ctrl[i] == MOVING) {
+                size_t p = Home(KeyOf::Get(m_slots[i]));
+                while (m_ctrl[p] == FULL) p = (p + 1) & mask;
+                if (p == i) {
+                    m_ctrl[i] = FULL;
+                } else if (m_ctrl[p] == EMPTY) {
+                    m_slots[p] = std::move(m_slots[i]);
+                    m_slots[i] = Slot{};
+                    m_ctrl[p] = FULL;
+                    m_ctrl[i] = EMPTY;
+                } else {
+                    std::swap(m_slots[i], m_slots[p]);
+                    m_ctrl[p] = FULL;
+                }
+            }
+        }
+    }
+
+    std::vector<Slot> m_slots;
+    std::vector<uint8_t> m_ctrl;
+    size_t m_size = 0;
+    size_t m_tombstones = 0;
+    int m_shift = 64;
+};
+
+struct FlatMapKeyOf {
+    template <typename Pair>
+    static const auto& Get(const Pair& p) { return p.first; }
+};
+
+struct FlatSetKeyOf {
+    template <typename Key>
+    static const Key& Get(const Key& k) { return k; }
+};
+
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class FlatHashMap : public FlatHashTable<Key, std::pair<Key, Value>, Hash, FlatMapKeyOf> {
+    using Base = FlatHashTable<Key, std::pair<Key, Value>, Hash, FlatMapKeyOf>;
+
+public:
+    using value_type = std::pair<Key, Value>;
+    using typename Base::iterator;
+
+    // Inserts Value(args...) unless the key exists; never overwrites
+    template <typename... Args>
+    std::pair<iterator, bool> try_emplace(const Key& key, Args&&... args) {
+        auto [i, found] = this->FindOrClaim(key);
+        if (!found) this->m_slots[i] = value_type(key, Value(std::forward<Args>(args)...));
+        return {iterator(this, i), !found};
+    }
+    template <typename... Args>
+    std::pair<iterator, bool> emplace(const Key& key, Args&&... args) {
+        return try_emplace(key, std::forward<Args>(args)...);
+    }
+    std::pair<iterator, bool> insert(const value_type& v) { return try_emplace(v.first, v.second); }
+
+    Value& operator[](const Key& key) { return try_emplace(key).first->second; }
+};
+
+template <typename Key, typename Hash = std::hash<Key>>
+class FlatHashSet : public FlatHashTable<Key, Key, Hash, FlatSetKeyOf> {
+    using Base = FlatHashTable<Key, Key, Hash, FlatSetKeyOf>;
+
+public:
+    using value_type = Key;
+    using typename Base::const_iterator;
+    using iterator = const_iterator;   // keys are immutable
+
+    const_iterator begin() const { return Base::begin(); }
+    const_iterator end() const { return Base::end(); }
+    const_iterator find(const Key& key) const { return Base::find(key); }
+
+    std::pair<const_iterator, bool> insert(const Key& key) {
+        auto [i, found] = this->FindOrClaim(key);
+        if (!found) this->m_slots[i] = key;
+        return {const_iterator(this, i), !found};
+    }
+};
+
+#endif
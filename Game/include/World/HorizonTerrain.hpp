@@ -0,0 +1,68 @@
+#ifndef _HORIZON_TERRAIN_HPP_
+#define _HORIZON_TERRAIN_HPP_
+
+#include "Chunk.hpp"
+#include "WorldGenerator.hpp"
+#include <vector>
+
+// Far-field terrain past the render distance: a clipmap of heightmap tiles
+// sampled from the generator's surface height and biome alone, so no
+// chunk or block array is ever made for it.
+//
+// A level-L tile is TILE_CELLS cells wide and a cell is (1 << L) chunks.
+// Level L covers RING_TILES of its tiles either side of the player's chunk
+// snapped to level L+1's tile grid, which makes each level's area whole
+// tiles of the next one: level L+1 only fills the ring around it, and
+// level 0 always reaches at least MIN_LEVEL0_REACH chunks out. Tiles
+// beyond the horizon distance are left out, and so are cells within the
+// render distance (chunks and LOD columns draw those). A tile therefore
+// only needs rebuilding when it enters the layout or the render distance
+// edge crosses it.
+//
+// Cells are smooth quads between the surface heights at their corners,
+// textured with a single texel of their biome's surface block (the flat
+// shader takes its color from the atlas). Cells below sea level get a
+// water quad at the water's surface height. Skirts hang from every edge
+// with no neighbor cell in the tile, hiding cracks against other levels
+// and the LOD columns.
+class HorizonTerrain {
+public:
+    static constexpr int TILE_CELLS = 8;
+    static constexpr int RING_TILES = 8;                // even, >= 4 for the nesting to hold
+    static constexpr int MAX_LEVELS = 5;
+    static constexpr int MIN_LEVEL0_REACH = (RING_TILES - 2) * TILE_CELLS;
+    static constexpr int MAX_DISTANCE = ((RING_TILES - 2) * TILE_CELLS) << (MAX_LEVELS - 1);
+
+    // Inclusive chunk rectangle; empty when min > max
+    struct Rect {
+        int minX = 0, minZ = 0, maxX = -1, maxZ = -1;
+        bool IsEmpty() const { return minX > maxX || minZ > maxZ; }
+        bool operator==(const Rect& o) const {
+            return (IsEmpty() && o.IsEmpty()) ||
+                   (minX == o.minX && minZ == o.minZ && maxX == o.maxX && maxZ == o.maxZ);
+        }
+        bool operator!=(const Rect& o) const { return !(*this == o); }
+    };
+
+    struct Tile {
+        int tx, tz, level;      // tile coordinates in tiles of its level
+        Rect hole;              // chunks inside the render distance
+    };
+
+    static int GetTileChunks(int level) { return TILE_CELLS << level; }
+    // Levels whose guaranteed reach covers `distance` chunks (at most MAX_LEVELS)
+    static int GetLevelCount(int distance);
+
+    // Tiles around chunk (cx, cz) with something between `innerChunks` and
+    // `distance` chunks (Chebyshev) away, with their holes
+    static void Layout(int cx, int cz, int innerChunks, int distance, std::vector<Tile>& out);
+    // Whether Layout would hold the tile, and its hole if so
+    static bool IsInLayout(int cx, int cz, int innerChunks, int distance,
+                           int tx, int tz, int level, Rect& hole);
+
+    // Meshes `tile` into `land` and `water` (cleared first)
+    static void Build(const WorldGenerator& generator, const Tile& tile,
+                      ChunkMeshData& land, ChunkMeshData& water);
+};
+
+#endif
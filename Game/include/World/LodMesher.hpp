@@ -0,0 +1,54 @@
+#ifndef _LOD_MESHER_HPP_
+#define _LOD_MESHER_HPP_
+
+#include "Chunk.hpp"
+#include "ColumnStore.hpp"
+#include "SavedChunkMap.hpp"
+#include "WorldGenerator.hpp"
+#include <cstdint>
+#include <vector>
+
+// Downsampled meshes of whole chunk columns for distant terrain. Level L
+// merges 2^L blocks per axis into one cell (1: 2x, 2: 4x, 3: 8x). A cell is
+// solid when at least half of its blocks are, and takes the type of its
+// highest solid block; otherwise it is water when it holds more water than
+// air. Faces go between solid and open cells as in Chunk meshing, stretched
+// to the cell size and without AO; water gets its top surface only.
+//
+// Blocks are generated (or taken from saved chunks) into a scratch chunk one
+// at a time and dropped after counting, so nothing outlives the build.
+// Cells a whole cell below the lowest surface block of their footprint are
+// solid whatever the generator carved: caves cannot be seen from afar and
+// would only add faces. Chunks holding nothing but such cells are skipped.
+//
+// Seams: a cell outside the column counts as solid up to SKIRT_DEPTH blocks
+// below the lowest surface block of the neighbor column next to it, and as
+// open above. A column therefore walls itself off down past wherever a
+// neighbor drawn at another level (or at full detail) could end, and the
+// walls hide behind that neighbor where it is higher.
+class LodMesher {
+public:
+    static constexpr int MAX_LEVEL = 3;
+    static constexpr int SKIRT_DEPTH = 8;
+
+    // Per-thread working memory, reused from build to build
+    struct Scratch {
+        Chunk chunk{0, 0, 0};
+        std::vector<uint8_t> cells;         // BlockType per cell
+        std::vector<uint8_t> waterTop;      // highest water block in a cell (0..scale-1)
+        std::vector<uint16_t> counts;       // solid / water blocks while counting
+        ColumnRecord column;
+        ColumnRecord neighbor;
+    };
+
+    static int GetScale(int level) { return 1 << level; }
+
+    // Meshes column (cx, cz) at `level` (1..MAX_LEVEL) into `opaque` and
+    // `water` (cleared first). `saved` (may be null) replaces generated
+    // chunks that were edited.
+    static void Build(const WorldGenerator& generator, const SavedChunkMap* saved,
+                      int cx, int cz, int level, Scratch& scratch,
+                      ChunkMeshData& opaque, ChunkMeshData& water);
+};
+
+#endif
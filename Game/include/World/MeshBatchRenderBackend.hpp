@@ -0,0 +1,43 @@
+#ifndef _MESH_BATCH_RENDER_BACKEND_HPP_
+#define _MESH_BATCH_RENDER_BACKEND_HPP_
+
+#include "ChunkRenderBackend.hpp"
+#include <Memory/RefPtr.h>
+#include <Runtime/MeshBatch.hpp>
+#include <vector>
+
+namespace Sleak {
+    class Material;
+}
+
+// ChunkRenderBackend on top of the engine's MeshBatch: one MeshHandle per
+// column mesh, drawn with the block material (opaque pass) or the water
+// material (water pass). Shadow-only casters need the caster material; until
+// one is set there is no caster pass and ChunkManager submits none.
+// MeshBatch only uploads and draws whole handles, so each mesh is its own
+// buffer and DrawFaces draws the whole mesh.
+class MeshBatchRenderBackend : public ChunkRenderBackend {
+public:
+    void SetMaterial(const Sleak::RefPtr<Sleak::Material>& material) { m_material = material; }
+    void SetWaterMaterial(const Sleak::RefPtr<Sleak::Material>& material) { m_waterMaterial = material; }
+    void SetShadowCasterMaterial(const Sleak::RefPtr<Sleak::Material>& material) { m_casterMaterial = material; }
+
+    ChunkMeshId CreateMesh(const ChunkMeshData& data) override;
+    void DestroyMesh(ChunkMeshId id) override;
+
+    void BeginPass(ChunkRenderPass pass) override;
+    void Draw(ChunkMeshId id) override;
+    void EndPass() override;
+    bool HasShadowCasterPass() const override { return m_casterMaterial.get() != nullptr; }
+
+private:
+    // Slot index + 1 is the mesh id; freed slots are reused
+    std::vector<Sleak::MeshHandle> m_meshes;
+    std::vector<ChunkMeshId> m_freeIds;
+    Sleak::RefPtr<Sleak::Material> m_material;
+    Sleak::RefPtr<Sleak::Material> m_waterMaterial;
+    Sleak::RefPtr<Sleak::Material> m_casterMaterial;
+    bool m_passActive = false;
+};
+
+#endif
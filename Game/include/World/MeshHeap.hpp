@@ -0,0 +1,161 @@
+#ifndef _MESH_HEAP_HPP_
+#define _MESH_HEAP_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Two-level segregated fit (TLSF) allocator over a range of `capacity`
+// elements, for placing meshes inside one large GPU buffer. It only hands
+// out offsets; the buffer itself belongs to the render backend.
+//
+// Free blocks sit in size bins: a power-of-two class (first level) split
+// SL_COUNT ways (second level), with a bitmap per level. Allocate rounds
+// the request up to the next bin start, so any block in the first
+// non-empty bin at or above it fits, and Free merges with free neighbors:
+// both are O(1). Allocations are named by handles that stay valid when
+// Compact moves them.
+class MeshHeap {
+public:
+    static constexpr uint32_t INVALID = UINT32_MAX;
+
+    // A Compact step: the caller copies `size` elements from `from` to `to`
+    struct Move {
+        uint32_t handle;
+        uint32_t from, to, size;
+    };
+
+    explicit MeshHeap(uint32_t capacity = 0) { Reset(capacity); }
+
+    // Drops every allocation; the heap becomes one free block
+    void Reset(uint32_t capacity);
+
+    // Returns a handle, or INVALID when size is 0 or no free block fits
+    uint32_t Allocate(uint32_t size);
+    void Free(uint32_t handle);
+
+    uint32_t GetOffset(uint32_t handle) const { return m_blocks[m_handles[handle]].offset; }
+    uint32_t GetSize(uint32_t handle) const { return m_blocks[m_handles[handle]].size; }
+
+    // One defragmentation step: moves the highest allocation into a free
+    // block below it, when the bins hold one that fits. The two ranges
+    // never overlap; the old one is free as soon as this returns.
+    bool Compact(Move& move);
+
+    uint32_t GetCapacity() const { return m_capacity; }
+    uint32_t GetUsed() const { return m_used; }
+    uint32_t GetAllocationCount() const { return m_allocations; }
+    uint32_t GetFreeBlockCount() const { return m_freeBlocks; }
+    // Free elements past the highest allocation (what Compact grows)
+    uint32_t GetTailFree() const;
+
+    // Walks every block and checks the tiling, merging, bins and counters
+    bool Validate() const;
+
+private:
+    static constexpr int SL_LOG2 = 4;
+    static constexpr int SL_COUNT = 1 << SL_LOG2;
+    static constexpr int FL_COUNT = 32 - SL_LOG2 + 1;
+    static constexpr int COMPACT_SCAN = 8;     // same-bin blocks Compact looks at
+
+    struct Block {
+        uint32_t offset = 0, size = 0;
+        uint32_t prevPhys = INVALID, nextPhys = INVALID;
+        uint32_t prevFree = INVALID, nextFree = INVALID;
+        uint32_t handle = INVALID;      // INVALID while free
+    };
+
+    static void Mapping(uint32_t size, int& fl, int& sl);
+    uint32_t FindFree(uint32_t size) const;
+    void InsertFree(uint32_t block);
+    void RemoveFree(uint32_t block);
+    // Takes `size` elements from the front of free block `block` (already
+    // out of the bins), returning the remainder to them
+    void Split(uint32_t block, uint32_t size);
+    // Returns a used block to the bins, merged with its free neighbors
+    void Release(uint32_t block);
+    uint32_t NewBlock();
+    uint32_t NewHandle(uint32_t block);
+
+    std::vector<Block> m_blocks;
+    std::vector<uint32_t> m_spareBlocks;
+    std::vector<uint32_t> m_handles;        // handle -> block
+    std::vector<uint32_t> m_spareHandles;
+    uint32_t m_bins[FL_COUNT][SL_COUNT];
+    uint32_t m_slBitmap[FL_COUNT];
+    uint32_t m_flBitmap = 0;
+    uint32_t m_first = INVALID, m_last = INVALID;
+    uint32_t m_capacity = 0;
+    uint32_t m_used = 0;
+    uint32_t m_allocations = 0;
+    uint32_t m_freeBlocks = 0;
+};
+
+// Meshes packed into pages of one vertex heap and one index heap each, the
+// way a backend lays them out in a few large GPU buffers. A mesh goes to
+// the first page with room for both parts; a new page (a buffer creation)
+// is only made when none has, and one bigger than the usual page for a
+// mesh that could not fit an empty one. Emptied pages are released past
+// one spare, so streaming in place neither creates nor destroys buffers.
+class MeshArena {
+public:
+    static constexpr uint32_t INVALID = MeshHeap::INVALID;
+    static constexpr uint32_t DEFAULT_PAGE_VERTICES = 1u << 20;
+    static constexpr uint32_t DEFAULT_PAGE_INDICES = 3u << 19;
+
+    struct Allocation {
+        uint32_t page = INVALID;
+        uint32_t vertices = INVALID;    // MeshHeap handles
+        uint32_t indices = INVALID;
+    };
+
+    struct Move {
+        uint32_t page;
+        bool indexHeap;
+        MeshHeap::Move move;
+    };
+
+    explicit MeshArena(uint32_t pageVertices = DEFAULT_PAGE_VERTICES,
+                       uint32_t pageIndices = DEFAULT_PAGE_INDICES)
+        : m_pageVertices(pageVertices), m_pageIndices(pageIndices) {}
+
+    // False only when both counts are 0
+    bool Allocate(uint32_t vertexCount, uint32_t indexCount, Allocation& out);
+    void Free(const Allocation& allocation);
+
+    // Up to `maxMoves` Compact steps, round robin over the pages' heaps;
+    // appends them to `moves` for the backend to copy
+    int Compact(int maxMoves, std::vector<Move>& moves);
+
+    const MeshHeap& GetVertexHeap(uint32_t page) const { return m_pages[page].vertices; }
+    const MeshHeap& GetIndexHeap(uint32_t page) const { return m_pages[page].indices; }
+    bool IsPageLive(uint32_t page) const { return m_pages[page].live; }
+
+    size_t GetPageSlots() const { return m_pages.size(); }
+    uint32_t GetLivePages() const { return m_livePages; }
+    uint64_t GetPagesCreated() const { return m_pagesCreated; }
+    uint64_t GetPagesReleased() const { return m_pagesReleased; }
+    uint64_t GetMoves() const { return m_moves; }
+    // Summed over live pages, in elements
+    uint64_t GetVertexCapacity() const;
+    uint64_t GetIndexCapacity() const;
+
+private:
+    struct Page {
+        MeshHeap vertices, indices;
+        bool live = false;
+    };
+
+    bool TryPage(uint32_t page, uint32_t vertexCount, uint32_t indexCount, Allocation& out);
+    bool IsEmpty(uint32_t page) const;
+
+    std::vector<Page> m_pages;
+    uint32_t m_pageVertices, m_pageIndices;
+    uint32_t m_livePages = 0;
+    uint32_t m_compactCursor = 0;       // page * 2 + heap
+    uint64_t m_pagesCreated = 0;
+    uint64_t m_pagesReleased = 0;
+    uint64_t m_moves = 0;
+};
+
+#endif
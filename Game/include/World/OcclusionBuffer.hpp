@@ -0,0 +1,53 @@
+#ifndef _OCCLUSION_BUFFER_HPP_
+#define _OCCLUSION_BUFFER_HPP_
+
+#include "CodecKernels.hpp"
+#include "WorldMath.hpp"
+#include <cstdint>
+#include <vector>
+
+// Low-resolution CPU depth buffer for occlusion culling. Occluders are boxes
+// taken to be solid; each face towards the camera is written with its
+// farthest depth to the pixels whose centers it covers. A box is hidden when
+// every pixel its projection touches, plus one pixel of margin, holds
+// something strictly nearer than the box's nearest corner.
+//
+// Depth is view distance along the camera direction (WorldViewProj w);
+// empty pixels are +inf. Each tier fills and tests 8 pixels per step
+// (AVX2: one register, SSE2 / NEON: two) and produces exactly the buffer
+// and answers of the scalar loops.
+class OcclusionBuffer {
+public:
+    static constexpr int WIDTH = 128;   // multiple of 8
+    static constexpr int HEIGHT = 64;
+    // Geometry nearer than this is clipped from occluders; boxes reaching
+    // it are always visible
+    static constexpr float NEAR_DEPTH = 0.1f;
+
+    OcclusionBuffer();
+
+    // Clears the buffer for a new view
+    void Begin(const WorldViewProj& viewProj);
+    // Rasterizes the faces of a solid box that point towards the camera
+    void DrawOccluder(const WorldVec3& min, const WorldVec3& max);
+    bool IsVisible(const WorldVec3& min, const WorldVec3& max) const;
+
+    // Kernel tier used from the next call on (defaults to CodecKernels::GetTier())
+    void SetTier(KernelTier tier) { m_tier = tier; }
+    KernelTier GetTier() const { return m_tier; }
+    static const char* GetTierName(KernelTier tier);
+
+    const float* GetDepth() const { return m_depth.data(); }
+    // Pixels written by occluders since Begin
+    size_t CountCovered() const;
+
+private:
+    struct ScreenVert { float x, y, w; };
+    void DrawPolygon(const WorldVec3* corners, int count);
+
+    WorldViewProj m_viewProj;
+    KernelTier m_tier;
+    std::vector<float> m_depth;     // WIDTH * HEIGHT, row 0 at the top
+};
+
+#endif
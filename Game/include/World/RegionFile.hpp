@@ -5,23 +5,63 @@
 #include <vector>
 #include <string>
 #include <array>
+#include <functional>
 
 struct ChunkSaveData {
     int32_t cx, cy, cz;
     std::array<uint8_t, 4096> blocks;
 };
 
+// Regenerates the unedited blocks of a chunk so edits can be stored as a
+// delta (ChunkCodecId::Delta). `version` identifies the generator revision.
+struct ChunkBaseSource {
+    uint16_t version = 0;
+    std::function<void(int32_t cx, int32_t cy, int32_t cz, uint8_t* blocks)> generate;
+};
+
+// One chunk entry of a region file; `payload` points into the file buffer
+// passed to RegionFile::ParseIndex and is only valid while it is alive.
+struct RegionChunkRecord {
+    int32_t cx, cy, cz;
+    uint8_t codec;
+    uint32_t size;
+    uint32_t crc;
+    const uint8_t* payload;
+};
+
 class RegionFile {
 public:
     static constexpr uint32_t MAGIC = 0x534C4B52; // "SLKR"
-    static constexpr uint16_t CURRENT_VERSION = 1;
+    static constexpr uint16_t CURRENT_VERSION = 2;  // v2: per-chunk codec id (ChunkCodec)
     static constexpr int REGION_SIZE = 8;
 
     static void RegionCoord(int cx, int cz, int& rx, int& rz);
     static std::string RegionFileName(int rx, int rz);
 
-    static bool Save(const std::string& path, const std::vector<ChunkSaveData>& chunks);
-    static bool Load(const std::string& path, std::vector<ChunkSaveData>& chunks);
+    // With a base source, Save stores a chunk as a delta whenever that beats
+    // the full encoding. Load needs the base source to restore delta chunks.
+    static bool Save(const std::string& path, const std::vector<ChunkSaveData>& chunks,
+                     const ChunkBaseSource* base = nullptr);
+    static bool Load(const std::string& path, std::vector<ChunkSaveData>& chunks,
+                     const ChunkBaseSource* base = nullptr);
+    // Rewrites the region at `path` with `chunks` encoded as Save would and
+    // every other record of the existing file copied byte for byte (never
+    // decoded, so no base source is needed for them)
+    static bool Update(const std::string& path, const std::vector<const ChunkSaveData*>& chunks,
+                       const ChunkBaseSource* base = nullptr);
+
+    // Load split into stages so callers can decode chunks in parallel:
+    // ReadFile + ParseIndex per region, then DecodeChunk (decode + CRC check)
+    // per record. DecodeChunk is thread-safe.
+    static bool ReadFile(const std::string& path, std::vector<uint8_t>& buf);
+    static bool ParseIndex(const std::vector<uint8_t>& buf,
+                           std::vector<RegionChunkRecord>& records);
+    static bool DecodeChunk(const RegionChunkRecord& record, std::array<uint8_t, 4096>& blocks,
+                            const ChunkBaseSource* base = nullptr);
+    // A delta record made by another generator revision: it cannot be
+    // decoded with this base, but the edits are intact and the record is
+    // worth keeping (Update copies it as is)
+    static bool IsStaleDelta(const RegionChunkRecord& record, const ChunkBaseSource& base);
 
     static std::vector<uint8_t> RLEEncode(const uint8_t* data, size_t size);
     static bool RLEDecode(const uint8_t* encoded, size_t encodedSize,
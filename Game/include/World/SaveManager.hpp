@@ -3,12 +3,12 @@
 
 #include "WorldMeta.hpp"
 #include "RegionFile.hpp"
+#include "SavedChunkMap.hpp"
 #include <string>
 #include <vector>
-#include <unordered_map>
-#include <array>
 
 class ChunkManager;
+class WorldGenerator;
 
 struct ChunkCoord;
 struct ChunkCoordHash;
@@ -17,10 +17,17 @@ class SaveManager {
 public:
     void SetSavePath(const std::string& basePath);
 
+    // Only the dirty chunks are encoded; the rest of each touched region is
+    // copied as stored. `generator` (the running world's, with its column
+    // store) builds delta bases; without one a generator is made for the seed.
     bool SaveWorld(const WorldMeta& meta,
-                   const std::vector<ChunkSaveData>& dirtyChunks);
-    bool LoadWorld(WorldMeta& meta,
-                   std::unordered_map<int64_t, std::array<uint8_t, 4096>>& chunkData);
+                   const std::vector<ChunkSaveData>& dirtyChunks,
+                   const WorldGenerator* generator = nullptr);
+    bool LoadWorld(WorldMeta& meta, SavedChunkMap& chunkData);
+    // Edited chunks the last load could not restore because they were saved
+    // as deltas against another generator version. Their records stay in the
+    // region files (saves copy them untouched) until the chunk is saved again.
+    size_t GetStaleDeltaChunks() const { return m_staleDeltaChunks; }
 
     bool HasSave() const;
     const std::string& GetSavePath() const { return m_savePath; }
@@ -36,9 +43,8 @@ private:
                        const std::vector<ChunkSaveData>& dirtyChunks) const;
     bool ReadWorldDat(WorldMeta& meta) const;
 
-    static int64_t PackCoord(int32_t cx, int32_t cy, int32_t cz);
-
     std::string m_savePath = "saves/Default";
+    size_t m_staleDeltaChunks = 0;
 };
 
 #endif
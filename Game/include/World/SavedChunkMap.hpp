@@ -0,0 +1,71 @@
+#ifndef _SAVED_CHUNK_MAP_HPP_
+#define _SAVED_CHUNK_MAP_HPP_
+
+#include "ChunkKey.hpp"
+#include "FlatHashMap.hpp"
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Block data of saved chunks by ChunkKey. The 4 KB block arrays live in one
+// dense vector and a flat key -> index table points into it, so lookups probe
+// a compact table instead of hopping between hash nodes.
+class SavedChunkMap {
+public:
+    using Blocks = std::array<uint8_t, 4096>;
+
+    // Blocks of `key`, appending a zeroed entry if missing (second = inserted).
+    // The pointer stays valid until the map grows past its reserved size.
+    std::pair<Blocks*, bool> Insert(uint64_t key) {
+        auto [it, inserted] = m_index.try_emplace(key, static_cast<uint32_t>(m_blocks.size()));
+        if (inserted) {
+            m_blocks.emplace_back();
+            m_keys.push_back(key);
+        }
+        return {&m_blocks[it->second], inserted};
+    }
+
+    const Blocks* Find(uint64_t key) const {
+        auto it = m_index.find(key);
+        return (it == m_index.end()) ? nullptr : &m_blocks[it->second];
+    }
+
+    // Moves the last entry into the hole, so the blocks stay dense
+    bool Erase(uint64_t key) {
+        auto it = m_index.find(key);
+        if (it == m_index.end()) return false;
+        uint32_t slot = it->second;
+        m_index.erase(it);
+        if (slot + 1 != m_blocks.size()) {
+            m_blocks[slot] = m_blocks.back();
+            m_keys[slot] = m_keys.back();
+            m_index[m_keys[slot]] = slot;
+        }
+        m_blocks.pop_back();
+        m_keys.pop_back();
+        return true;
+    }
+
+    void Reserve(size_t count) {
+        m_index.reserve(count);
+        m_blocks.reserve(count);
+        m_keys.reserve(count);
+    }
+
+    void Clear() {
+        m_index.clear();
+        m_blocks.clear();
+        m_keys.clear();
+    }
+
+    size_t Size() const { return m_blocks.size(); }
+    bool Empty() const { return m_blocks.empty(); }
+
+private:
+    FlatHashMap<uint64_t, uint32_t> m_index;
+    std::vector<Blocks> m_blocks;
+    std::vector<uint64_t> m_keys;   // key of each m_blocks entry
+};
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef _TEXTURE_ATLAS_HPP_
 #define _TEXTURE_ATLAS_HPP_
 
+#include "Block.hpp"
 #include <cstdint>
 #include <vector>
 #include <string>
@@ -15,26 +16,26 @@ struct AtlasUV {
 class TextureAtlas {
 public:
     static constexpr int TILES_PER_ROW = 4;
+    static constexpr int ROWS = (TILE_COUNT + TILES_PER_ROW - 1) / TILES_PER_ROW;
 
     // Build atlas from individual block textures, returns the texture
-    // Tile order must match BlockTile enum in Block.hpp
+    // Tile order must match BlockTile enum in Block.hpp.
+    // Implemented in SleakGame (needs the engine); the UV math below is
+    // engine-free so the headless mesher can use it.
     static Sleak::Texture* BuildAtlas();
 
     static AtlasUV GetTileUV(uint8_t tileIndex) {
         int col = tileIndex % TILES_PER_ROW;
         int row = tileIndex / TILES_PER_ROW;
         float tw = 1.0f / static_cast<float>(TILES_PER_ROW);
-        float th = 1.0f / static_cast<float>(s_rows);
+        float th = 1.0f / static_cast<float>(ROWS);
         return {
             col * tw,       row * th,
             (col + 1) * tw, (row + 1) * th
         };
     }
 
-    static int GetRows() { return s_rows; }
-
-private:
-    static int s_rows;
+    static constexpr int GetRows() { return ROWS; }
 };
 
 #endif
@@ -0,0 +1,84 @@
+#ifndef _TRACE_TIMELINE_HPP_
+#define _TRACE_TIMELINE_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+// Scoped trace spans for the main thread and the chunk workers, exported in
+// the Chrome trace event format (chrome://tracing, ui.perfetto.dev).
+//
+// Every thread that records owns a fixed ring of the most recent spans; the
+// hot path is a relaxed flag load, two clock reads and three relaxed stores
+// into the thread's own ring — no locks, no allocation after the first span.
+// Only registering a thread and writing a trace take the registry mutex.
+//
+// Configure with -DSLEAK_TRACE=OFF to compile every SLEAK_TRACE_* macro out.
+#ifndef SLEAK_TRACE_ENABLED
+#define SLEAK_TRACE_ENABLED 0
+#endif
+
+class TraceTimeline {
+public:
+    // Spans kept per thread; older ones are overwritten
+    static constexpr size_t RING_CAPACITY = 1u << 15;
+
+    static constexpr bool IsCompiledIn() { return SLEAK_TRACE_ENABLED != 0; }
+
+    // Runtime switch (on by default when compiled in)
+    static bool IsRecording() { return s_recording.load(std::memory_order_relaxed); }
+    static void SetRecording(bool enabled) { s_recording.store(enabled, std::memory_order_relaxed); }
+
+    static uint64_t Now() {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    // Appends a completed span to the calling thread's ring. name must
+    // outlive the trace (string literals).
+    static void Record(const char* name, uint64_t startNs, uint64_t endNs);
+
+    // Label for the calling thread's track
+    static void SetThreadName(const std::string& name);
+
+    // Writes every ring to a Chrome trace JSON file. Safe while other
+    // threads keep recording; spans overwritten during the copy are dropped.
+    static bool WriteChromeTrace(const std::string& path);
+
+    // Discards all recorded spans
+    static void Clear();
+
+private:
+    static inline std::atomic<bool> s_recording{SLEAK_TRACE_ENABLED != 0};
+    static inline std::atomic<uint64_t> s_clearNs{0};
+};
+
+// Records [construction, destruction) as one span
+class TraceScope {
+public:
+    explicit TraceScope(const char* name)
+        : m_name(name), m_start(TraceTimeline::IsRecording() ? TraceTimeline::Now() : 0) {}
+    ~TraceScope() {
+        if (m_start) TraceTimeline::Record(m_name, m_start, TraceTimeline::Now());
+    }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* m_name;
+    uint64_t m_start;
+};
+
+#if SLEAK_TRACE_ENABLED
+#define SLEAK_TRACE_CONCAT_(a, b) a##b
+#define SLEAK_TRACE_CONCAT(a, b) SLEAK_TRACE_CONCAT_(a, b)
+#define SLEAK_TRACE_SCOPE(name) TraceScope SLEAK_TRACE_CONCAT(traceScope_, __LINE__)(name)
+#define SLEAK_TRACE_THREAD(name) TraceTimeline::SetThreadName(name)
+#else
+#define SLEAK_TRACE_SCOPE(name) ((void)0)
+#define SLEAK_TRACE_THREAD(name) ((void)0)
+#endif
+
+#endif
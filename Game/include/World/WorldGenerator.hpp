@@ -5,6 +5,8 @@
 #include <cstdint>
 
 class Chunk;
+class ColumnStore;
+struct ColumnRecord;
 
 enum class Biome : uint8_t {
     Plains,
@@ -26,6 +28,9 @@ public:
     static constexpr int MAX_CHUNK_Y = 7;  // blocks 0-127
     static constexpr int SEA_LEVEL = 64;
     static constexpr int BASE_HEIGHT = 64;
+    // Bump whenever Generate() output changes for a given seed — delta saves
+    // (ChunkCodecId::Delta) are only valid against the same revision.
+    static constexpr uint16_t GENERATOR_VERSION = 1;
 
     WorldGenerator();
     explicit WorldGenerator(uint32_t seed);
@@ -33,10 +38,20 @@ public:
     void SetSeed(uint32_t seed);
     uint32_t GetSeed() const { return m_seed; }
 
+    // Optional cache of per-column heights/biomes. Generate() fills it and
+    // reads it instead of re-running the 2D noise; ignored on seed mismatch.
+    void SetColumnStore(ColumnStore* store) { m_columnStore = store; }
+
     void Generate(Chunk* chunk) const;
     int GetSurfaceHeight(int worldX, int worldZ) const;
     bool IsCave(int worldX, int worldY, int worldZ) const;
     Biome GetBiome(int worldX, int worldZ) const;
+    // Heights, biomes and maxCy of chunk column (cx, cz): from the column
+    // store, otherwise one noise pass (then stored)
+    void GetColumn(int cx, int cz, ColumnRecord& out) const;
+    // Surface height and biome of one block column straight from the noise,
+    // without touching the column store (for sparse far-field sampling)
+    ColumnInfo SampleColumn(int worldX, int worldZ) const { return GetColumnInfo(worldX, worldZ); }
 
     bool IsChunkEmpty(const Chunk* chunk) const;
     bool IsChunkFullySolid(const Chunk* chunk) const;
@@ -58,10 +73,15 @@ private:
     Noise m_riverNoise;
     Noise m_lakeNoise;
     uint32_t m_seed = 0;
+    ColumnStore* m_columnStore = nullptr;
 
     void InitNoises();
     void PlaceTrees(Chunk* chunk) const;
     ColumnInfo GetColumnInfo(int worldX, int worldZ) const;
+    ColumnInfo GetColumnInfoCached(int worldX, int worldZ) const;
+    const ColumnStore* GetActiveStore() const;
+    void ComputeColumn(int cx, int cz, ColumnRecord& column) const;
+    static int MaxCyFromSurface(int maxH);
 
     static uint32_t HashPosition(int x, int z, uint32_t seed);
 };
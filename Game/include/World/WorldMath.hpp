@@ -0,0 +1,109 @@
+#ifndef _WORLD_MATH_HPP_
+#define _WORLD_MATH_HPP_
+
+#include <cmath>
+
+// Minimal vector / frustum types for the world core, so block queries,
+// collision and culling do not depend on the engine math library.
+
+struct WorldVec3 {
+    float x = 0.0f, y = 0.0f, z = 0.0f;
+};
+
+// Forward / right / up axes of a camera looking along `dir`
+inline void WorldCameraBasis(const WorldVec3& dir, WorldVec3& f, WorldVec3& r, WorldVec3& u) {
+    auto normalize = [](WorldVec3 v) {
+        float len = std::sqrt(v.x * v.x + v.y * v.y + v.z * v.z);
+        if (len > 0.0f) { v.x /= len; v.y /= len; v.z /= len; }
+        return v;
+    };
+    auto cross = [](const WorldVec3& a, const WorldVec3& b) {
+        return WorldVec3{a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+    };
+
+    f = normalize(dir);
+    // Looking straight up/down: any horizontal axis works as "right"
+    WorldVec3 worldUp = (std::abs(f.y) > 0.999f) ? WorldVec3{0.0f, 0.0f, 1.0f}
+                                                 : WorldVec3{0.0f, 1.0f, 0.0f};
+    r = normalize(cross(f, worldUp));
+    u = cross(r, f);
+}
+
+// Six inward-facing planes (nx, ny, nz, d): a point p is inside a plane
+// when nx*p.x + ny*p.y + nz*p.z + d >= 0.
+struct WorldFrustum {
+    float planes[6][4] = {};
+
+    // Perspective camera at `pos` looking along `dir`. fovYDeg is the vertical
+    // field of view; aspect = width / height.
+    static WorldFrustum FromCamera(const WorldVec3& pos, const WorldVec3& dir,
+                                   float fovYDeg, float aspect,
+                                   float nearPlane, float farPlane) {
+        WorldVec3 f, r, u;
+        WorldCameraBasis(dir, f, r, u);
+
+        float halfY = fovYDeg * 0.5f * 0.01745329f;
+        float halfX = std::atan(std::tan(halfY) * aspect);
+        float sy = std::sin(halfY), cy = std::cos(halfY);
+        float sx = std::sin(halfX), cx = std::cos(halfX);
+
+        WorldFrustum out;
+        auto setPlane = [&](int i, WorldVec3 n, const WorldVec3& p) {
+            out.planes[i][0] = n.x;
+            out.planes[i][1] = n.y;
+            out.planes[i][2] = n.z;
+            out.planes[i][3] = -(n.x * p.x + n.y * p.y + n.z * p.z);
+        };
+        WorldVec3 nearPt{pos.x + f.x * nearPlane, pos.y + f.y * nearPlane, pos.z + f.z * nearPlane};
+        WorldVec3 farPt {pos.x + f.x * farPlane,  pos.y + f.y * farPlane,  pos.z + f.z * farPlane};
+        setPlane(0, f, nearPt);
+        setPlane(1, {-f.x, -f.y, -f.z}, farPt);
+        setPlane(2, {r.x * cx + f.x * sx, r.y * cx + f.y * sx, r.z * cx + f.z * sx}, pos);   // left
+        setPlane(3, {-r.x * cx + f.x * sx, -r.y * cx + f.y * sx, -r.z * cx + f.z * sx}, pos); // right
+        setPlane(4, {u.x * cy + f.x * sy, u.y * cy + f.y * sy, u.z * cy + f.z * sy}, pos);   // bottom
+        setPlane(5, {-u.x * cy + f.x * sy, -u.y * cy + f.y * sy, -u.z * cy + f.z * sy}, pos); // top
+        return out;
+    }
+
+    bool IsAABBVisible(const WorldVec3& min, const WorldVec3& max) const {
+        for (const auto& p : planes) {
+            // Corner furthest along the plane normal
+            float x = (p[0] >= 0.0f) ? max.x : min.x;
+            float y = (p[1] >= 0.0f) ? max.y : min.y;
+            float z = (p[2] >= 0.0f) ? max.z : min.z;
+            if (p[0] * x + p[1] * y + p[2] * z + p[3] < 0.0f) return false;
+        }
+        return true;
+    }
+};
+
+// Perspective projection of the same camera: for a point p,
+// x = rows[0]·(p, 1) and y = rows[1]·(p, 1) lie in [-w, w] on screen, where
+// w = rows[2]·(p, 1) is the depth along the view direction.
+struct WorldViewProj {
+    float rows[3][4] = {};
+    WorldVec3 eye;
+
+    static WorldViewProj FromCamera(const WorldVec3& pos, const WorldVec3& dir,
+                                    float fovYDeg, float aspect) {
+        WorldVec3 f, r, u;
+        WorldCameraBasis(dir, f, r, u);
+        float tanY = std::tan(fovYDeg * 0.5f * 0.01745329f);
+        float sx = 1.0f / (tanY * aspect), sy = 1.0f / tanY;
+
+        WorldViewProj out;
+        out.eye = pos;
+        auto setRow = [&](int i, const WorldVec3& axis, float scale) {
+            out.rows[i][0] = axis.x * scale;
+            out.rows[i][1] = axis.y * scale;
+            out.rows[i][2] = axis.z * scale;
+            out.rows[i][3] = -(axis.x * pos.x + axis.y * pos.y + axis.z * pos.z) * scale;
+        };
+        setRow(0, r, sx);
+        setRow(1, u, sy);
+        setRow(2, f, 1.0f);
+        return out;
+    }
+};
+
+#endif
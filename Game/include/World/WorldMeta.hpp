@@ -16,6 +16,9 @@ struct WorldMeta {
     static constexpr uint32_t MAGIC = 0x534C4B57; // "SLKW"
     static constexpr uint16_t CURRENT_VERSION = 1;
 
+    // flags
+    static constexpr uint16_t FLAG_DELTA_CHUNKS = 1 << 0;  // save edits as deltas vs. generation
+
     uint16_t version = CURRENT_VERSION;
     uint16_t flags = 0;
     int64_t saveTimestamp = 0;
@@ -1,8 +1,11 @@
 #include "MainScene.hpp"
 #include "Game.hpp"
 #include "World/TextureAtlas.hpp"
+#include "World/TraceTimeline.hpp"
+#include <algorithm>
 #include <cstring>
 #include <cmath>
+#include <ctime>
 #include <Core/CommandLine.hpp>
 #include <Core/GameObject.hpp>
 #include <Core/Application.hpp>
@@ -25,19 +28,36 @@
 using namespace Sleak;
 using namespace Sleak::Math;
 
+static WorldVec3 ToWorldVec3(const Vector3D& v) {
+    return {v.GetX(), v.GetY(), v.GetZ()};
+}
+
 MainScene::MainScene(const std::string& name, const std::string& savePath,
                      const std::string& worldName, uint32_t seed, bool isNewWorld)
     : Scene(name), m_savePath(savePath), m_worldName(worldName),
       m_worldSeed(seed), m_isNewWorld(isNewWorld) {}
 
 bool MainScene::Initialize() {
+    SLEAK_TRACE_THREAD("Main");
+    m_tracePath = Sleak::CommandLine::GetValue("-trace");
+
     SetupMaterial();
     SetupSkybox();
 
     Scene::Initialize();
 
+    {
+        const std::string horizonStr = Sleak::CommandLine::GetValue("-horizon");
+        int horizon = horizonStr.empty() ? DEFAULT_HORIZON_DISTANCE : std::stoi(horizonStr);
+        m_horizonLimit = std::clamp(horizon, 0, MAX_HORIZON_DISTANCE);
+        // Depth precision goes with far / near: no farther than the
+        // visible terrain's corners
+        float reach = static_cast<float>(std::max(m_horizonLimit, MAX_RENDER_DISTANCE) * 16);
+        m_cameraFar = reach * 1.5f;
+    }
+
     // Create the player camera as a regular scene object
-    auto* cam = new Sleak::Camera("PlayerCamera", {8.0f, 70.0f, 8.0f}, 60, 0.1f, 1500.0f);
+    auto* cam = new Sleak::Camera("PlayerCamera", {8.0f, 70.0f, 8.0f}, 60, CAMERA_NEAR, m_cameraFar);
     cam->SetDirection({0.0f, 0.0f, 1.0f});
     cam->AddComponent<FirstPersonController>();
     cam->AddComponent<Sleak::ColliderComponent>(
@@ -71,11 +91,25 @@ bool MainScene::Initialize() {
     SetupLighting();
 
     m_saveManager.SetSavePath(m_savePath);
-    m_chunkManager.Initialize(this, m_blockMaterial);
+    m_chunkRenderer.SetMaterial(m_blockMaterial);
+    m_chunkManager.Initialize(&m_chunkRenderer);
+    {
+        // Chunk worker pool size; 0 / absent = calibrated at startup
+        const std::string workersStr = Sleak::CommandLine::GetValue("-workers");
+        m_chunkManager.SetWorkerCount(workersStr.empty() ? 0 : std::stoi(workersStr));
+
+        m_chunkManager.SetHorizonDistance(m_horizonLimit);
+
+        const std::string budgetStr = Sleak::CommandLine::GetValue("-mesh-budget");
+        int budgetMB = budgetStr.empty() ? DEFAULT_MESH_BUDGET_MB : std::stoi(budgetStr);
+        if (budgetMB < 0) budgetMB = 0;
+        m_chunkManager.SetMeshBudget(static_cast<size_t>(budgetMB) * 1024 * 1024);
+    }
     m_blockEffects.Initialize(this, m_blockMaterial);
 
     if (m_isNewWorld) {
         m_chunkManager.SetSeed(m_worldSeed);
+        m_chunkManager.OpenColumnStore(m_savePath + "/columns.dat");
 
         // Find surface height at spawn and position camera above it
         if (cam) {
@@ -94,7 +128,7 @@ bool MainScene::Initialize() {
             const std::string rdStr = Sleak::CommandLine::GetValue("-rd");
             int cliRD = rdStr.empty() ? 0 : std::stoi(rdStr);
             int rd = cliRD > 0 ? cliRD : 12;
-            if (rd > 16) rd = 16;
+            if (rd > MAX_RENDER_DISTANCE) rd = MAX_RENDER_DISTANCE;
             m_chunkManager.SetRenderDistance(rd);
         }
         m_chunkManager.SetMultithreaded(m_multithreadedLoading);
@@ -105,10 +139,7 @@ bool MainScene::Initialize() {
         LoadGame();
     }
 
-    if (auto* lm = GetLightManager()) {
-        float fogDist = m_chunkManager.GetDrawDistance();
-        lm->SetFogDistances(fogDist * 0.91f, fogDist);
-    }
+    UpdateFogDistance();
 
     // Register game-specific benchmark metrics
     auto* app = Sleak::Application::GetInstance();
@@ -124,6 +155,45 @@ bool MainScene::Initialize() {
             auto vel = rb->GetVelocity();
             return (vel.Magnitude() > 0.01f) ? 1.0f : 0.0f;
         });
+
+        // Chunk pipeline telemetry
+        struct ChunkMetric {
+            const char* name;
+            float (*get)(const ChunkPipelineTelemetry&);
+        };
+        static const ChunkMetric chunkMetrics[] = {
+            {"Chunk_PendingLoad",   [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.pendingLoad); }},
+            {"Chunk_PendingUnload", [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.pendingUnload); }},
+            {"Chunk_TaskQueue",     [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.taskQueue); }},
+            {"Chunk_ReadyQueue",    [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.readyQueue); }},
+            {"Chunk_DirtyColumns",  [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.dirtyColumns); }},
+            {"Chunk_RemeshSet",     [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.remeshSet); }},
+            {"Chunk_GenPerSec",     [](const ChunkPipelineTelemetry& t) { return t.generatedPerSec; }},
+            {"Chunk_MeshPerSec",    [](const ChunkPipelineTelemetry& t) { return t.meshedPerSec; }},
+            {"Chunk_RemeshPerSec",  [](const ChunkPipelineTelemetry& t) { return t.remeshedPerSec; }},
+            {"Chunk_MeshesPerChunk",[](const ChunkPipelineTelemetry& t) { return t.meshesPerChunkAvg; }},
+            {"Chunk_UploadKB",      [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.uploadBytesLastFrame) / 1024.0f; }},
+            {"Chunk_ColumnMeshes",  [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.columnMeshes); }},
+            {"Chunk_ColumnMeshMB",  [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.columnMeshBytes) / (1024.0f * 1024.0f); }},
+            {"Chunk_LodColumns",    [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.lodColumns); }},
+            {"Chunk_LodColumnMB",   [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.lodColumnBytes) / (1024.0f * 1024.0f); }},
+            {"Chunk_HorizonTiles",  [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.horizonTiles); }},
+            {"Chunk_HorizonMB",     [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.horizonTileBytes) / (1024.0f * 1024.0f); }},
+            {"Chunk_Evicted",       [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.evictedColumns); }},
+            {"Chunk_FrustumColumns",[](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.frustumColumns); }},
+            {"Chunk_OccludedColumns",[](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.occludedColumns); }},
+            {"Chunk_OcclusionRejected",[](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.occlusionRejectedColumns); }},
+            {"Chunk_ShadowOnly",    [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.shadowOnlyColumns); }},
+            {"Chunk_Triangles",     [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.drawnTriangles); }},
+            {"Chunk_DrawSort_ms",   [](const ChunkPipelineTelemetry& t) { return t.drawSortMs; }},
+            {"Chunk_VisibleP50_ms", [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.timeToVisible.Percentile(0.50)); }},
+            {"Chunk_VisibleP95_ms", [](const ChunkPipelineTelemetry& t) { return static_cast<float>(t.timeToVisible.Percentile(0.95)); }},
+        };
+        for (const auto& metric : chunkMetrics) {
+            app->GetBenchmark()->RegisterMetric(metric.name, [this, get = metric.get]() {
+                return get(m_chunkManager.GetTelemetry());
+            });
+        }
         app->GetBenchmark()->RegisterMetric("VRAM_MB", [app]() {
             return static_cast<float>(app->GetGPUMemoryUsed()) / (1024.0f * 1024.0f);
         });
@@ -149,6 +219,9 @@ MainScene::~MainScene() {
     EventDispatcher::UnregisterEvent(EventType::MouseScrolled, m_mouseScrolledHandlerId);
     EventDispatcher::UnregisterEvent(EventType::KeyPressed,    m_keyPressedHandlerId);
     EventDispatcher::UnregisterEvent(EventType::KeyReleased,   m_keyReleasedHandlerId);
+
+    if (!m_tracePath.empty() && TraceTimeline::IsCompiledIn())
+        TraceTimeline::WriteChromeTrace(m_tracePath);
 }
 
 void MainScene::OnDeactivate() {
@@ -177,7 +250,7 @@ void MainScene::OnMousePressed(const Events::Input::MouseButtonPressedEvent& e)
 
     auto pos = cam->GetPosition();
     auto dir = cam->GetDirection();
-    auto hit = m_chunkManager.VoxelRaycast(pos, dir, 6.0f);
+    auto hit = m_chunkManager.VoxelRaycast(ToWorldVec3(pos), ToWorldVec3(dir), 6.0f);
     if (!hit.hit) return;
 
     MouseCode button = e.GetMouseButton();
@@ -262,6 +335,7 @@ void MainScene::OnKeyPressed(const Events::Input::KeyPressedEvent& e) {
     if_key_press(KEY__F3) { m_showUI = !m_showUI; }
     if_key_press(KEY__F5) { SaveGame(); }
     if_key_press(KEY__F6) { LoadGame(); }
+    if_key_press(KEY__F9) { DumpTrace(); }
 }
 
 void MainScene::OnKeyReleased(const Events::Input::KeyReleasedEvent& e) {
@@ -276,6 +350,7 @@ void MainScene::OnKeyReleased(const Events::Input::KeyReleasedEvent& e) {
 }
 
 void MainScene::Update(float deltaTime) {
+    SLEAK_TRACE_SCOPE("MainScene::Update");
     if (deltaTime > 0.05f) deltaTime = 0.05f;
     m_gameTime += deltaTime;
 
@@ -286,7 +361,10 @@ void MainScene::Update(float deltaTime) {
             m_chunkManager.SetBlockAt(completed.x, completed.y, completed.z, completed.type);
     }
 
-    Scene::Update(deltaTime);
+    {
+        SLEAK_TRACE_SCOPE("Scene::Update");
+        Scene::Update(deltaTime);
+    }
 
     // Refresh cached metrics
     m_metricTimer += deltaTime;
@@ -317,12 +395,13 @@ void MainScene::Update(float deltaTime) {
 
         // Collision resolution (always active)
         {
+            SLEAK_TRACE_SCOPE("Collision");
             auto curPos = cam->GetPosition();
-            auto collision = m_chunkManager.ResolveVoxelCollision(curPos, 0.3f, 1.8f, 1.62f);
+            auto collision = m_chunkManager.ResolveVoxelCollision(ToWorldVec3(curPos), 0.3f, 1.8f, 1.62f);
             if (collision.onGround || collision.hitCeiling || collision.hitWall) {
-                cam->SetPosition({curPos.GetX() + collision.correction.GetX(),
-                                  curPos.GetY() + collision.correction.GetY(),
-                                  curPos.GetZ() + collision.correction.GetZ()});
+                cam->SetPosition({curPos.GetX() + collision.correction.x,
+                                  curPos.GetY() + collision.correction.y,
+                                  curPos.GetZ() + collision.correction.z});
                 if (!m_flying) {
                     auto* rb = cam->GetComponent<RigidbodyComponent>();
                     if (rb) {
@@ -334,8 +413,8 @@ void MainScene::Update(float deltaTime) {
                         if (collision.hitCeiling && vel.GetY() > 0.0f)
                             rb->SetVelocity({vel.GetX(), 0.0f, vel.GetZ()});
                         if (collision.hitWall) {
-                            float vx = (collision.correction.GetX() != 0.0f) ? 0.0f : vel.GetX();
-                            float vz = (collision.correction.GetZ() != 0.0f) ? 0.0f : vel.GetZ();
+                            float vx = (collision.correction.x != 0.0f) ? 0.0f : vel.GetX();
+                            float vz = (collision.correction.z != 0.0f) ? 0.0f : vel.GetZ();
                             rb->SetVelocity({vx, vel.GetY(), vz});
                         }
                     }
@@ -343,8 +422,21 @@ void MainScene::Update(float deltaTime) {
             }
         }
 
+        float vw = static_cast<float>(UI::GetViewportWidth());
+        float vh = static_cast<float>(UI::GetViewportHeight());
+        float aspect = (vh > 0.0f) ? vw / vh : 1.0f;
+        m_chunkManager.SetView(ToWorldVec3(cam->GetPosition()),
+                               WorldFrustum::FromCamera(ToWorldVec3(cam->GetPosition()),
+                                                        ToWorldVec3(cam->GetDirection()),
+                                                        cam->GetFieldOfView(), aspect,
+                                                        CAMERA_NEAR, m_cameraFar),
+                               WorldViewProj::FromCamera(ToWorldVec3(cam->GetPosition()),
+                                                         ToWorldVec3(cam->GetDirection()),
+                                                         cam->GetFieldOfView(), aspect));
         m_chunkManager.Update(pos.GetX(), pos.GetY(), pos.GetZ());
         m_chunkManager.RenderColumns();
+        // Nothing until m_chunkRenderer has a shadow caster material
+        m_chunkManager.RenderShadowCasters();
 
         // Animate water — pass game time through material tiling.x
         if (m_waterMaterial) {
@@ -354,7 +446,7 @@ void MainScene::Update(float deltaTime) {
 
         // Block outline always visible
         auto dir = cam->GetDirection();
-        auto rayHit = m_chunkManager.VoxelRaycast(cam->GetPosition(), dir, 6.0f);
+        auto rayHit = m_chunkManager.VoxelRaycast(ToWorldVec3(cam->GetPosition()), ToWorldVec3(dir), 6.0f);
         if (rayHit.hit) {
             constexpr float E = 0.002f;
             Physics::AABB blockAABB(
@@ -400,6 +492,7 @@ float shadownear = 0.1f;
 float shadowfar = 500.0f;
 
 void MainScene::RenderUI() {
+    SLEAK_TRACE_SCOPE("RenderUI");
     auto* cam = GetActiveCamera();
     auto* app = Application::GetInstance();
     if (!cam || !app) return;
@@ -418,7 +511,7 @@ void MainScene::RenderUI() {
              static_cast<int>(m_selectedBlock));
 
     auto dir = cam->GetDirection();
-    auto rayHit = m_chunkManager.VoxelRaycast(cam->GetPosition(), dir, 6.0f);
+    auto rayHit = m_chunkManager.VoxelRaycast(ToWorldVec3(cam->GetPosition()), ToWorldVec3(dir), 6.0f);
     if (rayHit.hit) {
         UI::Text("Looking at: %s (%d, %d, %d)",
                  GetBlockName(rayHit.blockType),
@@ -480,6 +573,49 @@ void MainScene::RenderUI() {
         UI::Text("VRAM: %.0f / %.0f MB (%.0f%%)", usedMB, budgetMB, pct);
     }
 
+    // Chunk streaming pipeline
+    {
+        const auto& t = m_chunkManager.GetTelemetry();
+        UI::Separator();
+        UI::Text("Chunks: %zu active", m_chunkManager.GetActiveChunkCount());
+        UI::Text("Load %zu  Unload %zu", t.pendingLoad, t.pendingUnload);
+        UI::Text("Task %zu  Ready %zu", t.taskQueue, t.readyQueue);
+        UI::Text("Dirty cols %zu  Remesh %zu", t.dirtyColumns, t.remeshSet);
+        UI::Text("Gen %.0f/s  Mesh %.0f/s", t.generatedPerSec, t.meshedPerSec);
+        UI::Text("Remesh %.0f/s  (%.2f/chunk, max %u)",
+                 t.remeshedPerSec, t.meshesPerChunkAvg, t.meshesPerChunkMax);
+        UI::Text("Upload %.0f KB/frame (peak %.0f)",
+                 t.uploadBytesPerFrameAvg / 1024.0f,
+                 static_cast<float>(t.uploadBytesPeakFrame) / 1024.0f);
+        UI::Text("Columns %zu  (%.1f MB)", t.columnMeshes,
+                 static_cast<float>(t.columnMeshBytes) / (1024.0f * 1024.0f));
+        UI::Text("LOD columns %zu (%.1f MB)  Queue %zu", t.lodColumns,
+                 static_cast<float>(t.lodColumnBytes) / (1024.0f * 1024.0f), t.lodQueue);
+        UI::Text("Horizon tiles %zu (%.1f MB)  Queue %zu", t.horizonTiles,
+                 static_cast<float>(t.horizonTileBytes) / (1024.0f * 1024.0f), t.horizonQueue);
+        if (t.meshBudgetBytes > 0) {
+            float usedMB = static_cast<float>(t.columnMeshBytes) / (1024.0f * 1024.0f);
+            float budgetMB = static_cast<float>(t.meshBudgetBytes) / (1024.0f * 1024.0f);
+            UI::Text("Mesh budget %.0f / %.0f MB (%.0f%%)  Evicted %llu", usedMB, budgetMB,
+                     usedMB / budgetMB * 100.0f, static_cast<unsigned long long>(t.evictedColumns));
+            if (t.budgetDetailCap > 0)
+                UI::Text("Over budget: full detail cut to %d chunks", t.budgetDetailCap);
+        }
+        UI::Text("In frustum %zu  Occluded %zu", t.frustumColumns, t.occludedColumns);
+        UI::Text("Occluders %zu  Hidden %zu", t.occluderColumns, t.occlusionRejectedColumns);
+        UI::Text("Shadow casters %zu (+%zu outside view)", t.shadowCasterColumns, t.shadowOnlyColumns);
+        size_t triangles = t.drawnTriangles + t.backfaceSkippedTriangles + t.shadowFaceTriangles;
+        UI::Text("Triangles %zu  Backfaces skipped %.0f%%  Shadow only %zu", t.drawnTriangles,
+                 triangles ? t.backfaceSkippedTriangles * 100.0f / triangles : 0.0f, t.shadowFaceTriangles);
+        UI::Text("Draw sort %.3f ms  Full sorts %llu", t.drawSortMs,
+                 static_cast<unsigned long long>(t.drawListResorts));
+        if (t.timeToVisible.GetCount() > 0)
+            UI::Text("Visible p50 %.0f  p95 %.0f ms",
+                     t.timeToVisible.Percentile(0.50), t.timeToVisible.Percentile(0.95));
+        else
+            UI::TextDisabled("Visible: ---");
+    }
+
     UI::EndPanel();
 
     // --- Settings panel (below HUD) ---
@@ -497,6 +633,18 @@ void MainScene::RenderUI() {
 
     if (UI::Checkbox("Multithreaded Loading", &m_multithreadedLoading))
         m_chunkManager.SetMultithreaded(m_multithreadedLoading);
+    if (m_multithreadedLoading)
+        UI::Text("  Workers: %d", m_chunkManager.GetWorkerCount());
+
+    // Store edited chunks as diffs against the regenerated terrain
+    UI::Checkbox("Delta Saves", &m_deltaSaves);
+
+    // Skip columns hidden behind terrain (visibility graph through chunk faces)
+    if (UI::Checkbox("Cave Culling", &m_caveCulling))
+        m_chunkManager.SetOcclusionCulling(m_caveCulling);
+    // Skip columns behind the nearest columns' solid rock (CPU depth buffer)
+    if (UI::Checkbox("Occlusion Buffer", &m_occlusionBuffer))
+        m_chunkManager.SetOcclusionBuffer(m_occlusionBuffer);
 
     UI::Separator();
     UI::Text("Anti-Aliasing");
@@ -516,15 +664,28 @@ void MainScene::RenderUI() {
 
     UI::Separator();
     float rd = static_cast<float>(m_chunkManager.GetRenderDistance());
-    if (UI::DragFloat("Render Distance", &rd, 1.0f, 2.0f, 16.0f)) {
+    if (UI::DragFloat("Render Distance", &rd, 1.0f, 2.0f, static_cast<float>(MAX_RENDER_DISTANCE))) {
         m_chunkManager.SetRenderDistance(static_cast<int>(rd));
-        float drawDist = m_chunkManager.GetDrawDistance();
-        auto* lm = GetLightManager();
-        if (lm)
-            lm->SetFogDistances(drawDist * 0.9f, drawDist);
+        UpdateFogDistance();
         // Shadow frustum stays fixed — not tied to draw distance
         // (scaling it causes low-res shadows and disappearing issues)
     }
+    // LOD rings: level 1 from here, 2 and 3 every 8 chunks further out
+    float lodStart = static_cast<float>(m_chunkManager.GetLodDistances()[0]);
+    if (UI::DragFloat("LOD Start", &lodStart, 1.0f, 4.0f, static_cast<float>(MAX_RENDER_DISTANCE))) {
+        int start = static_cast<int>(lodStart);
+        m_chunkManager.SetLodDistances(start, start + 8, start + 16);
+    }
+    // Heightmap terrain from the render distance out to here (0 = off)
+    float horizon = static_cast<float>(m_chunkManager.GetHorizonDistance());
+    if (UI::DragFloat("Horizon", &horizon, 4.0f, 0.0f, static_cast<float>(m_horizonLimit))) {
+        m_chunkManager.SetHorizonDistance(static_cast<int>(horizon));
+        UpdateFogDistance();
+    }
+    // Column meshes past this are evicted, then full detail shrinks (0 = unlimited)
+    float budgetMB = static_cast<float>(m_chunkManager.GetMeshBudget() / (1024 * 1024));
+    if (UI::DragFloat("Mesh Budget MB", &budgetMB, 16.0f, 0.0f, static_cast<float>(MAX_MESH_BUDGET_MB)))
+        m_chunkManager.SetMeshBudget(static_cast<size_t>(budgetMB) * 1024 * 1024);
 
     // ---- Lighting ----
     UI::Separator();
@@ -533,15 +694,8 @@ void MainScene::RenderUI() {
     bool sunDirChanged = false;
     sunDirChanged |= UI::DragFloat("Elevation",  &m_sunElevation, 0.5f, -10.0f,  90.0f);
     sunDirChanged |= UI::DragFloat("Azimuth",    &m_sunAzimuth,   1.0f,   0.0f, 360.0f);
-    if (sunDirChanged && m_sun) {
-        const float deg2rad = 0.01745329f;
-        float eRad = m_sunElevation * deg2rad;
-        float aRad = m_sunAzimuth   * deg2rad;
-        m_sun->SetDirection(Vector3D(
-            -cosf(eRad) * sinf(aRad),
-            -sinf(eRad),
-            -cosf(eRad) * cosf(aRad)));
-    }
+    if (sunDirChanged && m_sun)
+        UpdateSunDirection();
 
     if (UI::DragFloat("Sun Intensity", &m_sunIntensity, 0.01f, 0.0f, 5.0f) && m_sun)
         m_sun->SetIntensity(m_sunIntensity);
@@ -666,12 +820,15 @@ void MainScene::RenderUI() {
 }
 
 void MainScene::SaveGame() {
+    SLEAK_TRACE_SCOPE("SaveGame");
     auto* cam = GetActiveCamera();
     if (!cam) return;
 
     WorldMeta meta;
     meta.worldName = m_worldName;
     meta.seed = m_chunkManager.GetSeed();
+    if (m_deltaSaves)
+        meta.flags |= WorldMeta::FLAG_DELTA_CHUNKS;
     auto pos = cam->GetPosition();
     meta.player.posX = pos.GetX();
     meta.player.posY = pos.GetY();
@@ -699,9 +856,9 @@ void MainScene::SaveGame() {
         dirtyChunks.push_back(std::move(cd));
     }
 
-    if (m_saveManager.SaveWorld(meta, dirtyChunks)) {
+    if (m_saveManager.SaveWorld(meta, dirtyChunks, &m_chunkManager.GetGenerator())) {
         m_chunkManager.ClearDirtyFlags();
-        m_chunkManager.SaveHeightmapCache(m_savePath + "/heightmap.cache");
+        m_chunkManager.FlushColumnStore();
         m_saveMessage = "World Saved!";
         m_saveMessageTimer = 2.0f;
     } else {
@@ -710,9 +867,30 @@ void MainScene::SaveGame() {
     }
 }
 
+// Writes the last few seconds of every thread's spans (F9)
+void MainScene::DumpTrace() {
+    if (!TraceTimeline::IsCompiledIn()) {
+        m_saveMessage = "Tracing compiled out";
+        m_saveMessageTimer = 2.0f;
+        return;
+    }
+
+    char stamp[32];
+    std::time_t now = std::time(nullptr);
+    std::strftime(stamp, sizeof(stamp), "%Y%m%d_%H%M%S", std::localtime(&now));
+    std::string path = "traces/" + m_worldName + "_" + stamp + ".json";
+    if (TraceTimeline::WriteChromeTrace(path)) {
+        m_saveMessage = "Trace: " + path;
+        m_saveMessageTimer = 3.0f;
+    } else {
+        m_saveMessage = "Trace Failed!";
+        m_saveMessageTimer = 3.0f;
+    }
+}
+
 void MainScene::LoadGame() {
     WorldMeta meta;
-    std::unordered_map<int64_t, std::array<uint8_t, 4096>> chunkData;
+    SavedChunkMap chunkData;
 
     if (!m_saveManager.LoadWorld(meta, chunkData)) {
         m_saveMessage = "No Save Found!";
@@ -735,11 +913,12 @@ void MainScene::LoadGame() {
     }
 
     m_selectedBlock = static_cast<BlockType>(meta.player.selectedBlock);
+    m_deltaSaves = (meta.flags & WorldMeta::FLAG_DELTA_CHUNKS) != 0;
 
     // Restore seed and reload all chunks
     m_chunkManager.SetSeed(meta.seed);
-    m_chunkManager.LoadChunkData(chunkData);
-    m_chunkManager.LoadHeightmapCache(m_savePath + "/heightmap.cache");
+    m_chunkManager.LoadChunkData(std::move(chunkData));
+    m_chunkManager.OpenColumnStore(m_savePath + "/columns.dat");
     m_chunkManager.ForceReload();
 
     // Load a small area synchronously, let the rest stream in
@@ -751,13 +930,21 @@ void MainScene::LoadGame() {
         int cliRD = rdStr.empty() ? 0 : std::stoi(rdStr);
         int rd = cliRD > 0 ? cliRD : static_cast<int>(meta.player.renderDistance);
         if (rd < 4) rd = 4;
-        if (rd > 16) rd = 16;
+        if (rd > MAX_RENDER_DISTANCE) rd = MAX_RENDER_DISTANCE;
         m_chunkManager.SetRenderDistance(rd);
     }
     m_chunkManager.SetMultithreaded(m_multithreadedLoading);
 
-    m_saveMessage = "World Loaded!";
-    m_saveMessageTimer = 2.0f;
+    if (size_t stale = m_saveManager.GetStaleDeltaChunks()) {
+        // Edits saved against another terrain generator: kept on disk, shown
+        // as generated until rewritten
+        m_saveMessage = "World Loaded - " + std::to_string(stale) +
+                        " edited chunks from an older generator not restored";
+        m_saveMessageTimer = 6.0f;
+    } else {
+        m_saveMessage = "World Loaded!";
+        m_saveMessageTimer = 2.0f;
+    }
 }
 
 // Helper: get the representative texture path for a block type (front/side face)
@@ -882,7 +1069,7 @@ void MainScene::SetupMaterial() {
     waterMat->SetSpecularColor((uint8_t)255, (uint8_t)255, (uint8_t)255);
     waterMat->Initialize();
     m_waterMaterial = RefPtr<Material>(waterMat);
-    m_chunkManager.SetWaterMaterial(m_waterMaterial);
+    m_chunkRenderer.SetWaterMaterial(m_waterMaterial);
 }
 
 void MainScene::SetupSkybox() {
@@ -891,26 +1078,18 @@ void MainScene::SetupSkybox() {
 }
 
 void MainScene::SetupLighting() {
-    // Convert elevation/azimuth angles to a world-space direction vector
-    const float deg2rad = 0.01745329f;
-    float eRad = m_sunElevation * deg2rad;
-    float aRad = m_sunAzimuth   * deg2rad;
-    float dx = -cosf(eRad) * sinf(aRad);
-    float dy = -sinf(eRad);
-    float dz = -cosf(eRad) * cosf(aRad);
-
     m_sun = new DirectionalLight("Sun");
-    m_sun->SetDirection(Vector3D(dx, dy, dz));
+    UpdateSunDirection();
     m_sun->SetColor(m_sunColorR, m_sunColorG, m_sunColorB);
     m_sun->SetIntensity(m_sunIntensity);
     m_sun->SetLightSize(4.0f);
     m_sun->SetCastShadows(true);
     m_sun->SetShadowBias(0.002f);
     m_sun->SetShadowNormalBias(0.05f);
-    m_sun->SetShadowFrustumSize(160.0f);
-    m_sun->SetShadowDistance(160.0f);
+    m_sun->SetShadowFrustumSize(SHADOW_DISTANCE);
+    m_sun->SetShadowDistance(SHADOW_DISTANCE);
     m_sun->SetShadowNearPlane(0.1f);
-    m_sun->SetShadowFarPlane(500.0f);
+    m_sun->SetShadowFarPlane(SHADOW_FAR);
     AddObject(m_sun);
 
     auto* lm = GetLightManager();
@@ -920,8 +1099,7 @@ void MainScene::SetupLighting() {
 
         lm->SetFogColor(m_fogHorizonR, m_fogHorizonG, m_fogHorizonB);
         lm->SetFogZenithColor(m_fogZenithR, m_fogZenithG, m_fogZenithB);
-        float fogDist = m_chunkManager.GetDrawDistance();
-        lm->SetFogDistances(fogDist * 0.9f, fogDist);
+        UpdateFogDistance();
         lm->SetFogEnabled(m_fogEnabled);
 
         lm->SetHeightFogEnabled(m_heightFogEnabled);
@@ -930,3 +1108,26 @@ void MainScene::SetupLighting() {
         lm->SetHeightFogFalloff(m_heightFogFalloff);
     }
 }
+
+void MainScene::UpdateSunDirection() {
+    // Convert elevation/azimuth angles to a world-space direction vector
+    const float deg2rad = 0.01745329f;
+    float eRad = m_sunElevation * deg2rad;
+    float aRad = m_sunAzimuth   * deg2rad;
+    float dx = -cosf(eRad) * sinf(aRad);
+    float dy = -sinf(eRad);
+    float dz = -cosf(eRad) * cosf(aRad);
+
+    m_sun->SetDirection(Vector3D(dx, dy, dz));
+    // Columns outside the view that shade it go to the shadow map only
+    m_chunkManager.SetShadowLight({dx, dy, dz}, SHADOW_DISTANCE, SHADOW_FAR);
+}
+
+// Fog ends where the farthest terrain does: the horizon when it is on,
+// else the chunks' draw distance
+void MainScene::UpdateFogDistance() {
+    if (auto* lm = GetLightManager()) {
+        float fogDist = m_chunkManager.GetVisibleDistance();
+        lm->SetFogDistances(fogDist * 0.9f, fogDist);
+    }
+}
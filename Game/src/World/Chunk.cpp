@@ -1,23 +1,71 @@
 #include "World/Chunk.hpp"
 #include "World/TextureAtlas.hpp"
-#include <Core/GameObject.hpp>
-#include <Core/SceneBase.hpp>
-#include <ECS/Components/TransformComponent.hpp>
-#include <ECS/Components/MeshComponent.hpp>
-#include <ECS/Components/MaterialComponent.hpp>
-#include <Math/Vector.hpp>
-#include <Runtime/Material.hpp>
-
-using namespace Sleak;
-using namespace Sleak::Math;
 
 Chunk::Chunk(int cx, int cy, int cz) : m_cx(cx), m_cy(cy), m_cz(cz) {
     memset(m_blocks, static_cast<uint8_t>(BlockType::Air), VOLUME);
 }
 
-Chunk::~Chunk() {
-    if (m_gameObject && !m_addedToScene)
-        delete m_gameObject;
+void Chunk::Reset(int cx, int cy, int cz) {
+    memset(m_blocks, static_cast<uint8_t>(BlockType::Air), VOLUME);
+    for (auto& n : m_neighbors) n = nullptr;
+    m_cx = cx;
+    m_cy = cy;
+    m_cz = cz;
+    m_meshBuilt = false;
+    m_faceConnectivity = ChunkVisibility::ALL;
+    m_pendingMesh.release();
+    m_pendingWaterMesh.release();
+    m_hasPendingMesh = false;
+    m_hasPendingWaterMesh = false;
+    m_inFlight = false;
+    m_dirty = false;
+    m_edited = false;
+    m_needsRebuild = false;
+    m_needsGeneration = true;
+    m_meshCount = 0;
+    m_activeIndex = -1;
+}
+
+bool ChunkMeshData::HasFaceRanges() const {
+    size_t total = 0;
+    for (uint32_t count : faceIndexCounts) total += count;
+    return !indices.empty() && total == indices.size();
+}
+
+void ChunkMeshData::Append(const ChunkMeshData& src) {
+    if (src.vertices.empty()) return;
+    // Cleared by hand: the old ranges no longer describe anything
+    if (indices.empty()) std::fill(std::begin(faceIndexCounts), std::end(faceIndexCounts), 0u);
+    bool ranged = src.HasFaceRanges() && (indices.empty() || HasFaceRanges());
+
+    uint32_t baseVertex = static_cast<uint32_t>(vertices.size());
+    vertices.insert(vertices.end(), src.vertices.begin(), src.vertices.end());
+    size_t first = indices.size();
+    if (!ranged) {
+        indices.insert(indices.end(), src.indices.begin(), src.indices.end());
+        for (size_t i = first; i < indices.size(); ++i)
+            indices[i] += baseVertex;
+        std::fill(std::begin(faceIndexCounts), std::end(faceIndexCounts), 0u);
+        return;
+    }
+
+    // Last direction first: each old range moves up past the new indices of
+    // the directions before it, then src's range goes in right after it
+    indices.resize(first + src.indices.size());
+    size_t oldEnd = first, srcEnd = src.indices.size(), end = indices.size();
+    for (int face = 5; face >= 0; --face) {
+        uint32_t added = src.faceIndexCounts[face], kept = faceIndexCounts[face];
+        srcEnd -= added;
+        end -= added;
+        for (uint32_t i = 0; i < added; ++i)
+            indices[end + i] = src.indices[srcEnd + i] + baseVertex;
+        oldEnd -= kept;
+        end -= kept;
+        if (end != oldEnd)
+            std::copy_backward(indices.begin() + oldEnd, indices.begin() + oldEnd + kept,
+                               indices.begin() + end + kept);
+        faceIndexCounts[face] = kept + added;
+    }
 }
 
 void Chunk::SetBlock(int x, int y, int z, BlockType type) {
@@ -105,8 +153,25 @@ bool Chunk::IsBlockOpaqueAt(int x, int y, int z) const {
 }
 
 void Chunk::GenerateMeshData() {
-    VoxelVertexGroup vertices;
-    IndexGroup indices;
+    MeshScratch scratch;
+    GenerateMeshData(scratch);
+}
+
+// The built vertices are moved into the pending meshes, which drop their old
+// buffers first; only the index lists keep their capacity in the scratch
+void Chunk::GenerateMeshData(MeshScratch& scratch) {
+    BuildMeshData(scratch);
+    m_pendingMesh.release();
+    m_pendingWaterMesh.release();
+    CommitMeshData(scratch);
+}
+
+void Chunk::BuildMeshData(MeshScratch& scratch) {
+    std::vector<WorldVertex>& vertices = scratch.vertices;
+    vertices.clear();
+    // One index list per BlockFace direction, joined at the end
+    auto& faceIndices = scratch.faceIndices;
+    for (auto& indices : faceIndices) indices.clear();
 
     bool opaque[18][18][18];
     bool solid[18][18][18];
@@ -185,7 +250,7 @@ void Chunk::GenerateMeshData() {
 
     auto fastAddFace = [&](BlockFace face, int x, int y, int z, BlockType type) {
         AtlasUV uv = TextureAtlas::GetTileUV(GetBlockTextureTile(type, face));
-        uint32_t base = static_cast<uint32_t>(vertices.GetSize());
+        uint32_t base = static_cast<uint32_t>(vertices.size());
         float bx = static_cast<float>(x + m_cx * SIZE);
         float by = static_cast<float>(y + m_cy * SIZE);
         float bz = static_cast<float>(z + m_cz * SIZE);
@@ -193,63 +258,66 @@ void Chunk::GenerateMeshData() {
         float ao[4];
         fastFaceAO(face, x, y, z, ao);
 
-        VoxelVertex v[4];
+        WorldVertex v[4];
         switch (face) {
             case BlockFace::Top:
-                v[0] = VoxelVertex(bx,     by + 1, bz,     0, 1, 0, uv.u0, uv.v1);
-                v[1] = VoxelVertex(bx,     by + 1, bz + 1, 0, 1, 0, uv.u0, uv.v0);
-                v[2] = VoxelVertex(bx + 1, by + 1, bz + 1, 0, 1, 0, uv.u1, uv.v0);
-                v[3] = VoxelVertex(bx + 1, by + 1, bz,     0, 1, 0, uv.u1, uv.v1);
+                v[0] = WorldVertex(bx,     by + 1, bz,     0, 1, 0, uv.u0, uv.v1);
+                v[1] = WorldVertex(bx,     by + 1, bz + 1, 0, 1, 0, uv.u0, uv.v0);
+                v[2] = WorldVertex(bx + 1, by + 1, bz + 1, 0, 1, 0, uv.u1, uv.v0);
+                v[3] = WorldVertex(bx + 1, by + 1, bz,     0, 1, 0, uv.u1, uv.v1);
                 break;
             case BlockFace::Bottom:
-                v[0] = VoxelVertex(bx,     by, bz + 1, 0, -1, 0, uv.u0, uv.v1);
-                v[1] = VoxelVertex(bx,     by, bz,     0, -1, 0, uv.u0, uv.v0);
-                v[2] = VoxelVertex(bx + 1, by, bz,     0, -1, 0, uv.u1, uv.v0);
-                v[3] = VoxelVertex(bx + 1, by, bz + 1, 0, -1, 0, uv.u1, uv.v1);
+                v[0] = WorldVertex(bx,     by, bz + 1, 0, -1, 0, uv.u0, uv.v1);
+                v[1] = WorldVertex(bx,     by, bz,     0, -1, 0, uv.u0, uv.v0);
+                v[2] = WorldVertex(bx + 1, by, bz,     0, -1, 0, uv.u1, uv.v0);
+                v[3] = WorldVertex(bx + 1, by, bz + 1, 0, -1, 0, uv.u1, uv.v1);
                 break;
             case BlockFace::North:
-                v[0] = VoxelVertex(bx + 1, by,     bz + 1, 0, 0, 1, uv.u0, uv.v1);
-                v[1] = VoxelVertex(bx + 1, by + 1, bz + 1, 0, 0, 1, uv.u0, uv.v0);
-                v[2] = VoxelVertex(bx,     by + 1, bz + 1, 0, 0, 1, uv.u1, uv.v0);
-                v[3] = VoxelVertex(bx,     by,     bz + 1, 0, 0, 1, uv.u1, uv.v1);
+                v[0] = WorldVertex(bx + 1, by,     bz + 1, 0, 0, 1, uv.u0, uv.v1);
+                v[1] = WorldVertex(bx + 1, by + 1, bz + 1, 0, 0, 1, uv.u0, uv.v0);
+                v[2] = WorldVertex(bx,     by + 1, bz + 1, 0, 0, 1, uv.u1, uv.v0);
+                v[3] = WorldVertex(bx,     by,     bz + 1, 0, 0, 1, uv.u1, uv.v1);
                 break;
             case BlockFace::South:
-                v[0] = VoxelVertex(bx,     by,     bz, 0, 0, -1, uv.u0, uv.v1);
-                v[1] = VoxelVertex(bx,     by + 1, bz, 0, 0, -1, uv.u0, uv.v0);
-                v[2] = VoxelVertex(bx + 1, by + 1, bz, 0, 0, -1, uv.u1, uv.v0);
-                v[3] = VoxelVertex(bx + 1, by,     bz, 0, 0, -1, uv.u1, uv.v1);
+                v[0] = WorldVertex(bx,     by,     bz, 0, 0, -1, uv.u0, uv.v1);
+                v[1] = WorldVertex(bx,     by + 1, bz, 0, 0, -1, uv.u0, uv.v0);
+                v[2] = WorldVertex(bx + 1, by + 1, bz, 0, 0, -1, uv.u1, uv.v0);
+                v[3] = WorldVertex(bx + 1, by,     bz, 0, 0, -1, uv.u1, uv.v1);
                 break;
             case BlockFace::East:
-                v[0] = VoxelVertex(bx + 1, by,     bz,     1, 0, 0, uv.u0, uv.v1);
-                v[1] = VoxelVertex(bx + 1, by + 1, bz,     1, 0, 0, uv.u0, uv.v0);
-                v[2] = VoxelVertex(bx + 1, by + 1, bz + 1, 1, 0, 0, uv.u1, uv.v0);
-                v[3] = VoxelVertex(bx + 1, by,     bz + 1, 1, 0, 0, uv.u1, uv.v1);
+                v[0] = WorldVertex(bx + 1, by,     bz,     1, 0, 0, uv.u0, uv.v1);
+                v[1] = WorldVertex(bx + 1, by + 1, bz,     1, 0, 0, uv.u0, uv.v0);
+                v[2] = WorldVertex(bx + 1, by + 1, bz + 1, 1, 0, 0, uv.u1, uv.v0);
+                v[3] = WorldVertex(bx + 1, by,     bz + 1, 1, 0, 0, uv.u1, uv.v1);
                 break;
             case BlockFace::West:
-                v[0] = VoxelVertex(bx, by,     bz + 1, -1, 0, 0, uv.u0, uv.v1);
-                v[1] = VoxelVertex(bx, by + 1, bz + 1, -1, 0, 0, uv.u0, uv.v0);
-                v[2] = VoxelVertex(bx, by + 1, bz,     -1, 0, 0, uv.u1, uv.v0);
-                v[3] = VoxelVertex(bx, by,     bz,     -1, 0, 0, uv.u1, uv.v1);
+                v[0] = WorldVertex(bx, by,     bz + 1, -1, 0, 0, uv.u0, uv.v1);
+                v[1] = WorldVertex(bx, by + 1, bz + 1, -1, 0, 0, uv.u0, uv.v0);
+                v[2] = WorldVertex(bx, by + 1, bz,     -1, 0, 0, uv.u1, uv.v0);
+                v[3] = WorldVertex(bx, by,     bz,     -1, 0, 0, uv.u1, uv.v1);
                 break;
         }
 
         for (int i = 0; i < 4; ++i) {
             v[i].SetColor(ao[i], ao[i], ao[i], 1.0f);
-            vertices.AddVertex(v[i]);
+            vertices.push_back(v[i]);
         }
 
+        auto& indices = faceIndices[static_cast<uint8_t>(face)];
         if (ao[0] + ao[2] > ao[1] + ao[3]) {
-            indices.add(base); indices.add(base + 2); indices.add(base + 1);
-            indices.add(base); indices.add(base + 3); indices.add(base + 2);
+            indices.push_back(base); indices.push_back(base + 2); indices.push_back(base + 1);
+            indices.push_back(base); indices.push_back(base + 3); indices.push_back(base + 2);
         } else {
-            indices.add(base); indices.add(base + 3); indices.add(base + 1);
-            indices.add(base + 1); indices.add(base + 3); indices.add(base + 2);
+            indices.push_back(base); indices.push_back(base + 3); indices.push_back(base + 1);
+            indices.push_back(base + 1); indices.push_back(base + 3); indices.push_back(base + 2);
         }
     };
 
     // Water mesh gets separate buffers
-    VoxelVertexGroup waterVertices;
-    IndexGroup waterIndices;
+    std::vector<WorldVertex>& waterVertices = scratch.waterVertices;
+    std::vector<uint32_t>& waterIndices = scratch.waterIndices;
+    waterVertices.clear();
+    waterIndices.clear();
 
     // Helper to check if neighbor is water
     auto isWater = [&](int x, int y, int z) -> bool {
@@ -272,7 +340,7 @@ void Chunk::GenerateMeshData() {
     // Water face emitter — lowered top, no AO, blue tint vertex color
     auto addWaterFace = [&](BlockFace face, int x, int y, int z) {
         AtlasUV uv = TextureAtlas::GetTileUV(GetBlockTextureTile(BlockType::Water, face));
-        uint32_t base = static_cast<uint32_t>(waterVertices.GetSize());
+        uint32_t base = static_cast<uint32_t>(waterVertices.size());
         float bx = static_cast<float>(x + m_cx * SIZE);
         float by = static_cast<float>(y + m_cy * SIZE);
         float bz = static_cast<float>(z + m_cz * SIZE);
@@ -281,54 +349,54 @@ void Chunk::GenerateMeshData() {
         float topY = (face == BlockFace::Top || face == BlockFace::Bottom)
                      ? by + 0.875f : by + 1.0f;
 
-        VoxelVertex v[4];
+        WorldVertex v[4];
         switch (face) {
             case BlockFace::Top:
-                v[0] = VoxelVertex(bx,     topY, bz,     0, 1, 0, uv.u0, uv.v1);
-                v[1] = VoxelVertex(bx,     topY, bz + 1, 0, 1, 0, uv.u0, uv.v0);
-                v[2] = VoxelVertex(bx + 1, topY, bz + 1, 0, 1, 0, uv.u1, uv.v0);
-                v[3] = VoxelVertex(bx + 1, topY, bz,     0, 1, 0, uv.u1, uv.v1);
+                v[0] = WorldVertex(bx,     topY, bz,     0, 1, 0, uv.u0, uv.v1);
+                v[1] = WorldVertex(bx,     topY, bz + 1, 0, 1, 0, uv.u0, uv.v0);
+                v[2] = WorldVertex(bx + 1, topY, bz + 1, 0, 1, 0, uv.u1, uv.v0);
+                v[3] = WorldVertex(bx + 1, topY, bz,     0, 1, 0, uv.u1, uv.v1);
                 break;
             case BlockFace::Bottom:
-                v[0] = VoxelVertex(bx,     by, bz + 1, 0, -1, 0, uv.u0, uv.v1);
-                v[1] = VoxelVertex(bx,     by, bz,     0, -1, 0, uv.u0, uv.v0);
-                v[2] = VoxelVertex(bx + 1, by, bz,     0, -1, 0, uv.u1, uv.v0);
-                v[3] = VoxelVertex(bx + 1, by, bz + 1, 0, -1, 0, uv.u1, uv.v1);
+                v[0] = WorldVertex(bx,     by, bz + 1, 0, -1, 0, uv.u0, uv.v1);
+                v[1] = WorldVertex(bx,     by, bz,     0, -1, 0, uv.u0, uv.v0);
+                v[2] = WorldVertex(bx + 1, by, bz,     0, -1, 0, uv.u1, uv.v0);
+                v[3] = WorldVertex(bx + 1, by, bz + 1, 0, -1, 0, uv.u1, uv.v1);
                 break;
             case BlockFace::North:
-                v[0] = VoxelVertex(bx + 1, by,         bz + 1, 0, 0, 1, uv.u0, uv.v1);
-                v[1] = VoxelVertex(bx + 1, by + 0.875f, bz + 1, 0, 0, 1, uv.u0, uv.v0);
-                v[2] = VoxelVertex(bx,     by + 0.875f, bz + 1, 0, 0, 1, uv.u1, uv.v0);
-                v[3] = VoxelVertex(bx,     by,         bz + 1, 0, 0, 1, uv.u1, uv.v1);
+                v[0] = WorldVertex(bx + 1, by,         bz + 1, 0, 0, 1, uv.u0, uv.v1);
+                v[1] = WorldVertex(bx + 1, by + 0.875f, bz + 1, 0, 0, 1, uv.u0, uv.v0);
+                v[2] = WorldVertex(bx,     by + 0.875f, bz + 1, 0, 0, 1, uv.u1, uv.v0);
+                v[3] = WorldVertex(bx,     by,         bz + 1, 0, 0, 1, uv.u1, uv.v1);
                 break;
             case BlockFace::South:
-                v[0] = VoxelVertex(bx,     by,         bz, 0, 0, -1, uv.u0, uv.v1);
-                v[1] = VoxelVertex(bx,     by + 0.875f, bz, 0, 0, -1, uv.u0, uv.v0);
-                v[2] = VoxelVertex(bx + 1, by + 0.875f, bz, 0, 0, -1, uv.u1, uv.v0);
-                v[3] = VoxelVertex(bx + 1, by,         bz, 0, 0, -1, uv.u1, uv.v1);
+                v[0] = WorldVertex(bx,     by,         bz, 0, 0, -1, uv.u0, uv.v1);
+                v[1] = WorldVertex(bx,     by + 0.875f, bz, 0, 0, -1, uv.u0, uv.v0);
+                v[2] = WorldVertex(bx + 1, by + 0.875f, bz, 0, 0, -1, uv.u1, uv.v0);
+                v[3] = WorldVertex(bx + 1, by,         bz, 0, 0, -1, uv.u1, uv.v1);
                 break;
             case BlockFace::East:
-                v[0] = VoxelVertex(bx + 1, by,         bz,     1, 0, 0, uv.u0, uv.v1);
-                v[1] = VoxelVertex(bx + 1, by + 0.875f, bz,     1, 0, 0, uv.u0, uv.v0);
-                v[2] = VoxelVertex(bx + 1, by + 0.875f, bz + 1, 1, 0, 0, uv.u1, uv.v0);
-                v[3] = VoxelVertex(bx + 1, by,         bz + 1, 1, 0, 0, uv.u1, uv.v1);
+                v[0] = WorldVertex(bx + 1, by,         bz,     1, 0, 0, uv.u0, uv.v1);
+                v[1] = WorldVertex(bx + 1, by + 0.875f, bz,     1, 0, 0, uv.u0, uv.v0);
+                v[2] = WorldVertex(bx + 1, by + 0.875f, bz + 1, 1, 0, 0, uv.u1, uv.v0);
+                v[3] = WorldVertex(bx + 1, by,         bz + 1, 1, 0, 0, uv.u1, uv.v1);
                 break;
             case BlockFace::West:
-                v[0] = VoxelVertex(bx, by,         bz + 1, -1, 0, 0, uv.u0, uv.v1);
-                v[1] = VoxelVertex(bx, by + 0.875f, bz + 1, -1, 0, 0, uv.u0, uv.v0);
-                v[2] = VoxelVertex(bx, by + 0.875f, bz,     -1, 0, 0, uv.u1, uv.v0);
-                v[3] = VoxelVertex(bx, by,         bz,     -1, 0, 0, uv.u1, uv.v1);
+                v[0] = WorldVertex(bx, by,         bz + 1, -1, 0, 0, uv.u0, uv.v1);
+                v[1] = WorldVertex(bx, by + 0.875f, bz + 1, -1, 0, 0, uv.u0, uv.v0);
+                v[2] = WorldVertex(bx, by + 0.875f, bz,     -1, 0, 0, uv.u1, uv.v0);
+                v[3] = WorldVertex(bx, by,         bz,     -1, 0, 0, uv.u1, uv.v1);
                 break;
         }
 
         // Store world position in vertex color for water shader (use full white = no AO)
         for (int i = 0; i < 4; ++i) {
             v[i].SetColor(1.0f, 1.0f, 1.0f, 1.0f);
-            waterVertices.AddVertex(v[i]);
+            waterVertices.push_back(v[i]);
         }
 
-        waterIndices.add(base); waterIndices.add(base + 2); waterIndices.add(base + 1);
-        waterIndices.add(base); waterIndices.add(base + 3); waterIndices.add(base + 2);
+        waterIndices.push_back(base); waterIndices.push_back(base + 2); waterIndices.push_back(base + 1);
+        waterIndices.push_back(base); waterIndices.push_back(base + 3); waterIndices.push_back(base + 2);
     };
 
     for (int y = 0; y < SIZE; ++y) {
@@ -364,58 +432,41 @@ void Chunk::GenerateMeshData() {
         }
     }
 
-    m_pendingMesh.vertices = std::move(vertices);
-    m_pendingMesh.indices = std::move(indices);
-    m_hasPendingMesh = true;
-
-    m_pendingWaterMesh.vertices = std::move(waterVertices);
-    m_pendingWaterMesh.indices = std::move(waterIndices);
-    m_hasPendingWaterMesh = true;
-
-    m_meshBuilt = true;
+    m_faceConnectivity = ChunkVisibility::Compute(m_blocks);
 }
 
-void Chunk::UploadMesh(const RefPtr<Material>& material) {
-    if (!m_hasPendingMesh) return;
-    m_hasPendingMesh = false;
-
-    if (m_pendingMesh.vertices.GetSize() == 0) {
-        m_meshBuilt = true;
-        return;
-    }
-
-    delete m_gameObject;
-
-    VoxelMeshData meshData;
-    meshData.vertices = std::move(m_pendingMesh.vertices);
-    meshData.indices = std::move(m_pendingMesh.indices);
-
-    m_gameObject = new GameObject("Chunk");
-    // Vertices are already in world-space, so transform is at origin
-    m_gameObject->AddComponent<TransformComponent>(Vector3D(0.0f, 0.0f, 0.0f));
-    m_gameObject->AddComponent<MaterialComponent>(material);
-    m_gameObject->AddComponent<MeshComponent>(std::move(meshData));
-    m_gameObject->Initialize();
-
-    m_meshBuilt = true;
+// Vertices are copied into a pending buffer that is big enough (one lent by
+// ChunkManager) and otherwise swapped in whole, as a freshly built vector
+// used to be moved. Index buffers are sized by their vertex capacity so a
+// reused buffer only grows when its vertices have to (6 indices per quad).
+static void CommitVertices(std::vector<WorldVertex>& built, std::vector<WorldVertex>& target) {
+    if (target.capacity() >= built.size()) target.assign(built.begin(), built.end());
+    else target.swap(built);
 }
 
-void Chunk::BuildMesh(const RefPtr<Material>& material) {
-    GenerateMeshData();
-    UploadMesh(material);
+static void ReserveIndices(std::vector<uint32_t>& indices, size_t count, size_t vertexCapacity) {
+    indices.clear();
+    indices.reserve(std::max(count, vertexCapacity / 4 * 6));
 }
 
-void Chunk::AddToScene(SceneBase* scene) {
-    if (m_gameObject) {
-        scene->AddObject(m_gameObject);
-        m_addedToScene = true;
+void Chunk::CommitMeshData(MeshScratch& scratch) {
+    CommitVertices(scratch.vertices, m_pendingMesh.vertices);
+    size_t indexCount = 0;
+    for (const auto& indices : scratch.faceIndices) indexCount += indices.size();
+    std::vector<uint32_t>& indices = m_pendingMesh.indices;
+    ReserveIndices(indices, indexCount, m_pendingMesh.vertices.capacity());
+    for (int face = 0; face < 6; ++face) {
+        const auto& faceIndices = scratch.faceIndices[face];
+        indices.insert(indices.end(), faceIndices.begin(), faceIndices.end());
+        m_pendingMesh.faceIndexCounts[face] = static_cast<uint32_t>(faceIndices.size());
     }
-}
+    m_hasPendingMesh = true;
 
-void Chunk::RemoveFromScene(SceneBase* scene) {
-    if (m_gameObject && m_addedToScene) {
-        scene->RemoveObject(m_gameObject);
-        m_gameObject = nullptr;
-        m_addedToScene = false;
-    }
+    CommitVertices(scratch.waterVertices, m_pendingWaterMesh.vertices);
+    const auto& waterIndices = scratch.waterIndices;
+    ReserveIndices(m_pendingWaterMesh.indices, waterIndices.size(), m_pendingWaterMesh.vertices.capacity());
+    m_pendingWaterMesh.indices.assign(waterIndices.begin(), waterIndices.end());
+    m_hasPendingWaterMesh = true;
+
+    m_meshBuilt = true;
 }
@@ -0,0 +1,354 @@
+#include "World/ChunkCodec.hpp"
+#include "World/RegionFile.hpp"
+#include "World/CodecKernels.hpp"
+#include <cstring>
+
+// ── Palette ──────────────────────────────────────────────────────────
+
+static int BitsForPaletteSize(int count) {
+    int bits = 0;
+    while ((1 << bits) < count) ++bits;
+    return bits;
+}
+
+void ChunkCodec::PaletteEncode(const uint8_t* data, size_t size, std::vector<uint8_t>& out) {
+    // Palette entries are emitted in order of first appearance
+    int16_t remap[256];
+    std::memset(remap, 0xFF, sizeof(remap));
+    uint8_t palette[256];
+    int count = 0;
+    for (size_t i = 0; i < size; i += CodecKernels::RunLength(data + i, size - i, size - i)) {
+        if (remap[data[i]] < 0) {
+            remap[data[i]] = static_cast<int16_t>(count);
+            palette[count++] = data[i];
+        }
+    }
+    if (count == 0) {
+        // Empty input still needs a valid palette for the decoder
+        palette[0] = 0;
+        count = 1;
+    }
+
+    out.push_back(static_cast<uint8_t>(count - 1));
+    out.insert(out.end(), palette, palette + count);
+
+    int bits = BitsForPaletteSize(count);
+    if (bits == 0) return;  // uniform chunk — the palette alone is the payload
+
+    uint32_t acc = 0;
+    int accBits = 0;
+    for (size_t i = 0; i < size; ++i) {
+        acc |= static_cast<uint32_t>(remap[data[i]]) << accBits;
+        accBits += bits;
+        while (accBits >= 8) {
+            out.push_back(static_cast<uint8_t>(acc & 0xFF));
+            acc >>= 8;
+            accBits -= 8;
+        }
+    }
+    if (accBits > 0)
+        out.push_back(static_cast<uint8_t>(acc & 0xFF));
+}
+
+bool ChunkCodec::PaletteDecode(const uint8_t* encoded, size_t encodedSize,
+                               uint8_t* output, size_t expectedSize) {
+    if (encodedSize < 1) return false;
+    int count = static_cast<int>(encoded[0]) + 1;
+    if (encodedSize < 1 + static_cast<size_t>(count)) return false;
+    const uint8_t* palette = encoded + 1;
+
+    int bits = BitsForPaletteSize(count);
+    if (bits == 0) {
+        if (encodedSize != 2) return false;
+        std::memset(output, palette[0], expectedSize);
+        return true;
+    }
+
+    const uint8_t* p = palette + count;
+    size_t packedSize = (expectedSize * bits + 7) / 8;
+    if (encodedSize != 1 + static_cast<size_t>(count) + packedSize) return false;
+
+    uint32_t mask = (1u << bits) - 1;
+    uint32_t acc = 0;
+    int accBits = 0;
+    for (size_t i = 0; i < expectedSize; ++i) {
+        while (accBits < bits) {
+            acc |= static_cast<uint32_t>(*p++) << accBits;
+            accBits += 8;
+        }
+        uint32_t idx = acc & mask;
+        acc >>= bits;
+        accBits -= bits;
+        if (idx >= static_cast<uint32_t>(count)) return false;
+        output[i] = palette[idx];
+    }
+    return true;
+}
+
+// ── LZ ───────────────────────────────────────────────────────────────
+// Sequence: token(1) [literal len ext] literals [offset(2) [match len ext]]
+// token = (literal len << 4) | (match len - LZ_MIN_MATCH), nibbles saturate
+// at 15 and continue in 255-terminated extension bytes. The final sequence
+// carries literals only — the decoder stops once the input is consumed.
+
+static constexpr size_t LZ_MIN_MATCH = 4;
+static constexpr size_t LZ_MAX_OFFSET = 65535;
+static constexpr int LZ_HASH_BITS = 12;
+
+static uint32_t LZRead32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static uint32_t LZHash(uint32_t v) {
+    return (v * 2654435761u) >> (32 - LZ_HASH_BITS);
+}
+
+static void LZWriteLength(std::vector<uint8_t>& out, size_t len) {
+    len -= 15;
+    while (len >= 255) {
+        out.push_back(255);
+        len -= 255;
+    }
+    out.push_back(static_cast<uint8_t>(len));
+}
+
+static bool LZReadLength(const uint8_t*& p, const uint8_t* end, size_t& len) {
+    uint8_t b;
+    do {
+        if (p >= end) return false;
+        b = *p++;
+        len += b;
+    } while (b == 255);
+    return true;
+}
+
+static void LZEmit(std::vector<uint8_t>& out, const uint8_t* literals, size_t litLen,
+                   size_t offset, size_t matchLen) {
+    size_t mlCode = matchLen ? matchLen - LZ_MIN_MATCH : 0;
+    uint8_t token = static_cast<uint8_t>(((litLen < 15 ? litLen : 15) << 4) |
+                                         (mlCode < 15 ? mlCode : 15));
+    out.push_back(token);
+    if (litLen >= 15) LZWriteLength(out, litLen);
+    out.insert(out.end(), literals, literals + litLen);
+    if (matchLen == 0) return;  // final literal-only sequence
+    out.push_back(static_cast<uint8_t>(offset & 0xFF));
+    out.push_back(static_cast<uint8_t>((offset >> 8) & 0xFF));
+    if (mlCode >= 15) LZWriteLength(out, mlCode);
+}
+
+void ChunkCodec::LZCompress(const uint8_t* data, size_t size, std::vector<uint8_t>& out) {
+    int32_t table[1 << LZ_HASH_BITS];
+    std::memset(table, 0xFF, sizeof(table));
+
+    size_t anchor = 0;
+    size_t i = 0;
+    while (i + LZ_MIN_MATCH <= size) {
+        uint32_t seq = LZRead32(data + i);
+        uint32_t h = LZHash(seq);
+        int32_t cand = table[h];
+        table[h] = static_cast<int32_t>(i);
+
+        if (cand >= 0 && i - static_cast<size_t>(cand) <= LZ_MAX_OFFSET &&
+            LZRead32(data + cand) == seq) {
+            size_t len = LZ_MIN_MATCH;
+            while (i + len < size && data[cand + len] == data[i + len])
+                ++len;
+            LZEmit(out, data + anchor, i - anchor, i - static_cast<size_t>(cand), len);
+            i += len;
+            anchor = i;
+        } else {
+            ++i;
+        }
+    }
+    LZEmit(out, data + anchor, size - anchor, 0, 0);
+}
+
+bool ChunkCodec::LZDecompress(const uint8_t* encoded, size_t encodedSize,
+                              uint8_t* output, size_t expectedSize) {
+    const uint8_t* p = encoded;
+    const uint8_t* end = encoded + encodedSize;
+    size_t written = 0;
+    while (p < end) {
+        uint8_t token = *p++;
+
+        size_t litLen = token >> 4;
+        if (litLen == 15 && !LZReadLength(p, end, litLen)) return false;
+        if (litLen > static_cast<size_t>(end - p)) return false;
+        if (written + litLen > expectedSize) return false;
+        std::memcpy(output + written, p, litLen);
+        p += litLen;
+        written += litLen;
+
+        if (p == end) break;
+
+        if (end - p < 2) return false;
+        size_t offset = static_cast<size_t>(p[0]) | (static_cast<size_t>(p[1]) << 8);
+        p += 2;
+        if (offset == 0 || offset > written) return false;
+
+        size_t matchLen = token & 0x0F;
+        if (matchLen == 15 && !LZReadLength(p, end, matchLen)) return false;
+        matchLen += LZ_MIN_MATCH;
+        if (written + matchLen > expectedSize) return false;
+
+        // Byte copy — source and destination overlap when offset < matchLen
+        const uint8_t* src = output + written - offset;
+        for (size_t k = 0; k < matchLen; ++k)
+            output[written + k] = src[k];
+        written += matchLen;
+    }
+    return written == expectedSize;
+}
+
+// ── Delta ────────────────────────────────────────────────────────────
+
+void ChunkCodec::DeltaEncode(const uint8_t* data, const uint8_t* base, size_t size,
+                             uint16_t baseVersion, std::vector<uint8_t>& out) {
+    out.clear();
+    out.push_back(static_cast<uint8_t>(baseVersion & 0xFF));
+    out.push_back(static_cast<uint8_t>((baseVersion >> 8) & 0xFF));
+    out.push_back(0);
+    out.push_back(0);
+
+    uint16_t count = 0;
+    for (size_t i = 0; i < size; ++i) {
+        if (data[i] == base[i]) continue;
+        out.push_back(static_cast<uint8_t>(i & 0xFF));
+        out.push_back(static_cast<uint8_t>((i >> 8) & 0xFF));
+        out.push_back(data[i]);
+        ++count;
+    }
+    out[2] = static_cast<uint8_t>(count & 0xFF);
+    out[3] = static_cast<uint8_t>((count >> 8) & 0xFF);
+}
+
+bool ChunkCodec::DeltaDecode(const uint8_t* encoded, size_t encodedSize,
+                             const uint8_t* base, uint16_t baseVersion,
+                             uint8_t* output, size_t expectedSize) {
+    if (encodedSize < 4) return false;
+    uint16_t version = static_cast<uint16_t>(encoded[0] | (encoded[1] << 8));
+    uint16_t count = static_cast<uint16_t>(encoded[2] | (encoded[3] << 8));
+    if (version != baseVersion) return false;
+    if (encodedSize != 4 + static_cast<size_t>(count) * 3) return false;
+
+    std::memcpy(output, base, expectedSize);
+    const uint8_t* p = encoded + 4;
+    for (uint16_t i = 0; i < count; ++i, p += 3) {
+        size_t idx = static_cast<size_t>(p[0]) | (static_cast<size_t>(p[1]) << 8);
+        if (idx >= expectedSize) return false;
+        output[idx] = p[2];
+    }
+    return true;
+}
+
+bool ChunkCodec::DeltaBaseVersion(const uint8_t* encoded, size_t encodedSize, uint16_t& version) {
+    if (encodedSize < 4) return false;
+    version = static_cast<uint16_t>(encoded[0] | (encoded[1] << 8));
+    return true;
+}
+
+// ── Codec selection ──────────────────────────────────────────────────
+
+const char* ChunkCodec::GetName(ChunkCodecId codec) {
+    switch (codec) {
+        case ChunkCodecId::Raw:       return "Raw";
+        case ChunkCodecId::RLE:       return "RLE";
+        case ChunkCodecId::Palette:   return "Palette";
+        case ChunkCodecId::PaletteLZ: return "Palette+LZ";
+        case ChunkCodecId::LZ:        return "LZ";
+        case ChunkCodecId::Delta:     return "Delta";
+        default:                      return "Unknown";
+    }
+}
+
+bool ChunkCodec::Encode(ChunkCodecId codec, const uint8_t* data, size_t size,
+                        std::vector<uint8_t>& out) {
+    out.clear();
+    switch (codec) {
+        case ChunkCodecId::Raw:
+            out.assign(data, data + size);
+            return true;
+        case ChunkCodecId::RLE:
+            out = RegionFile::RLEEncode(data, size);
+            return true;
+        case ChunkCodecId::Palette:
+            PaletteEncode(data, size, out);
+            return true;
+        case ChunkCodecId::PaletteLZ: {
+            // u16 palette stream size, then the LZ-compressed palette stream
+            std::vector<uint8_t> packed;
+            PaletteEncode(data, size, packed);
+            if (packed.size() > 0xFFFF) return false;
+            out.push_back(static_cast<uint8_t>(packed.size() & 0xFF));
+            out.push_back(static_cast<uint8_t>((packed.size() >> 8) & 0xFF));
+            LZCompress(packed.data(), packed.size(), out);
+            return true;
+        }
+        case ChunkCodecId::LZ:
+            LZCompress(data, size, out);
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool ChunkCodec::Decode(ChunkCodecId codec, const uint8_t* encoded, size_t encodedSize,
+                        uint8_t* output, size_t expectedSize) {
+    switch (codec) {
+        case ChunkCodecId::Raw:
+            if (encodedSize != expectedSize) return false;
+            std::memcpy(output, encoded, expectedSize);
+            return true;
+        case ChunkCodecId::RLE:
+            return RegionFile::RLEDecode(encoded, encodedSize, output, expectedSize);
+        case ChunkCodecId::Palette:
+            return PaletteDecode(encoded, encodedSize, output, expectedSize);
+        case ChunkCodecId::PaletteLZ: {
+            if (encodedSize < 2) return false;
+            size_t packedSize = static_cast<size_t>(encoded[0]) |
+                                (static_cast<size_t>(encoded[1]) << 8);
+            std::vector<uint8_t> packed(packedSize);
+            if (!LZDecompress(encoded + 2, encodedSize - 2, packed.data(), packedSize))
+                return false;
+            return PaletteDecode(packed.data(), packedSize, output, expectedSize);
+        }
+        case ChunkCodecId::LZ:
+            return LZDecompress(encoded, encodedSize, output, expectedSize);
+        default:
+            return false;
+    }
+}
+
+ChunkCodecId ChunkCodec::EncodeBest(const uint8_t* data, size_t size,
+                                    std::vector<uint8_t>& out) {
+    // A uniform chunk (all air / all stone) is a one-entry palette — two
+    // bytes, nothing else can beat it
+    if (size > 0 && CodecKernels::IsUniform(data, size)) {
+        out.assign({0, data[0]});
+        return ChunkCodecId::Palette;
+    }
+
+    Encode(ChunkCodecId::Palette, data, size, out);
+    ChunkCodecId best = ChunkCodecId::Palette;
+
+    static constexpr ChunkCodecId candidates[] = {
+        ChunkCodecId::PaletteLZ, ChunkCodecId::LZ, ChunkCodecId::RLE,
+    };
+    std::vector<uint8_t> trial;
+    for (ChunkCodecId codec : candidates) {
+        if (!Encode(codec, data, size, trial)) continue;
+        if (trial.size() < out.size()) {
+            out.swap(trial);
+            best = codec;
+        }
+    }
+
+    // Incompressible data is stored verbatim — never expand past raw size
+    if (out.size() >= size) {
+        Encode(ChunkCodecId::Raw, data, size, out);
+        best = ChunkCodecId::Raw;
+    }
+    return best;
+}
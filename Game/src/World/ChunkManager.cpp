@@ -1,44 +1,55 @@
 #include "World/ChunkManager.hpp"
-#include <Camera/Camera.hpp>
-#include <Core/SceneBase.hpp>
-#include <Logger.hpp>
-#include <Runtime/Material.hpp>
-#include <Runtime/MeshBatch.hpp>
+#include "World/TraceTimeline.hpp"
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <cstring>
-#include <fstream>
+#include <limits>
 #include <vector>
 
-ChunkManager::ChunkManager() {}
+ChunkManager::ChunkManager() {
+    m_generator.SetColumnStore(&m_columnStore);
+}
 
 ChunkManager::~ChunkManager() {
     StopWorkers();
-    // MeshHandle GPU buffers are released automatically via RefPtr
-    m_columns.clear();
+    ClearColumns();
     for (Chunk* chunk : m_activeChunks) {
         if (chunk) delete chunk;
     }
     m_activeChunks.clear();
     m_chunkGrid.clear();
+    for (Chunk* chunk : m_chunkPool) delete chunk;
+    m_chunkPool.clear();
 }
 
 void ChunkManager::SetMultithreaded(bool enabled) {
     if (enabled == m_multithreaded) return;
     m_multithreaded = enabled;
     if (enabled) {
+        m_meshBufferPool.clear();   // only synchronous meshing reuses them
+        m_waterBufferPool.clear();
         StartWorkers();
     } else {
         StopWorkers();
     }
 }
 
+void ChunkManager::SetWorkerCount(int count) {
+    if (count < 0) count = 0;
+    if (count == m_workerCount) return;
+    m_workerCount = count;
+    if (!m_workers.empty()) {
+        StopWorkers();
+        StartWorkers();
+    }
+}
+
 void ChunkManager::StartWorkers() {
     if (!m_workers.empty()) return;
     m_shutdown.store(false);
-    int count = static_cast<int>(std::thread::hardware_concurrency()) - 2;
-    if (count < 2) count = 2;
-    if (count > 12) count = 12;
+    int count = m_workerCount;
+    if (count == 0) count = CalibrateWorkers().chosen;
     for (int i = 0; i < count; ++i)
         m_workers.emplace_back(&ChunkManager::WorkerThread, this);
 }
@@ -46,7 +57,7 @@ void ChunkManager::StartWorkers() {
 void ChunkManager::StopWorkers() {
     if (m_workers.empty()) return;
     {
-        std::lock_guard<std::mutex> lock(m_taskMutex);
+        std::lock_guard<CountingMutex> lock(m_taskMutex);
         m_shutdown.store(true);
     }
     m_taskCV.notify_all();
@@ -55,43 +66,68 @@ void ChunkManager::StopWorkers() {
     m_workers.clear();
 
     {
-        std::lock_guard<std::mutex> lock(m_taskMutex);
+        std::lock_guard<CountingMutex> lock(m_taskMutex);
         m_taskQueue.clear();
+        m_lodBuildPool.insert(m_lodBuildPool.end(), m_lodTaskQueue.begin(), m_lodTaskQueue.end());
+        m_lodTaskQueue.clear();
     }
     {
-        std::lock_guard<std::mutex> lock(m_readyMutex);
+        std::lock_guard<CountingMutex> lock(m_readyMutex);
         m_readyQueue.clear();
+        m_lodBuildPool.insert(m_lodBuildPool.end(), m_lodReadyQueue.begin(), m_lodReadyQueue.end());
+        m_lodReadyQueue.clear();
     }
     m_chunksNeedingRemesh.clear();
+    // Dropped LOD builds are requested again
+    m_lodPending.clear();
+    m_lodRescan = true;
 }
 
 void ChunkManager::WorkerThread() {
+    SLEAK_TRACE_THREAD("Chunk worker");
     std::vector<Chunk*> localBatch;
     localBatch.reserve(8);
+    std::unique_ptr<LodMesher::Scratch> lodScratch;
+    Chunk::MeshScratch meshScratch;
     while (true) {
         localBatch.clear();
+        LodBuild* lod = nullptr;
         {
-            std::unique_lock<std::mutex> lock(m_taskMutex);
-            m_taskCV.wait(lock, [this] { return m_shutdown.load() || !m_taskQueue.empty(); });
+            std::unique_lock<CountingMutex> lock(m_taskMutex);
+            m_taskCV.wait(lock, [this] {
+                return m_shutdown.load() || !m_taskQueue.empty() || !m_lodTaskQueue.empty();
+            });
             if (m_shutdown.load() && m_taskQueue.empty()) return;
 
-            // Steal up to 8 chunks at once
+            // Steal up to 8 chunks at once; LOD columns only when no chunk waits
             for (int i = 0; i < 8 && !m_taskQueue.empty(); ++i) {
                 localBatch.push_back(m_taskQueue.back());
                 m_taskQueue.pop_back();
             }
+            if (localBatch.empty()) {
+                lod = m_lodTaskQueue.back();
+                m_lodTaskQueue.pop_back();
+            }
+        }
+
+        if (lod) {
+            if (!lodScratch) lodScratch = std::make_unique<LodMesher::Scratch>();
+            BuildLodColumn(*lod, *lodScratch);
+            std::lock_guard<CountingMutex> lock(m_readyMutex);
+            m_lodReadyQueue.push_back(lod);
+            continue;
         }
 
         for (Chunk* chunk : localBatch) {
             if (chunk->NeedsGeneration()) {
-                m_generator.Generate(chunk);
+                GenerateChunk(chunk);
                 chunk->SetNeedsGeneration(false);
             }
-            chunk->GenerateMeshData();
+            MeshChunk(chunk, &meshScratch);
         }
 
         {
-            std::lock_guard<std::mutex> lock(m_readyMutex);
+            std::lock_guard<CountingMutex> lock(m_readyMutex);
             for (Chunk* chunk : localBatch) {
                 m_readyQueue.push_back(chunk);
             }
@@ -99,30 +135,167 @@ void ChunkManager::WorkerThread() {
     }
 }
 
+void ChunkManager::GenerateChunk(Chunk* chunk) {
+    SLEAK_TRACE_SCOPE("Generate");
+    m_generator.Generate(chunk);
+    m_statGenerated.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ChunkManager::MeshChunk(Chunk* chunk, Chunk::MeshScratch* workerScratch) {
+    SLEAK_TRACE_SCOPE("Mesh");
+    if (workerScratch) {
+        chunk->GenerateMeshData(*workerScratch);
+    } else {
+        // Main thread only: the buffer pools are not shared with the workers
+        chunk->BuildMeshData(m_meshScratch);
+        LendMeshBuffers(chunk->GetPendingMeshData(), m_meshScratch.vertices.size(), m_meshBufferPool);
+        LendMeshBuffers(chunk->GetPendingWaterMeshData(), m_meshScratch.waterVertices.size(), m_waterBufferPool);
+        chunk->CommitMeshData(m_meshScratch);
+    }
+    chunk->CountMesh();
+    m_statMeshed.fetch_add(1, std::memory_order_relaxed);
+    if (chunk->GetMeshCount() > 1)
+        m_statRemeshed.fetch_add(1, std::memory_order_relaxed);
+}
+
+ChunkManager::StreamStats ChunkManager::GetStreamStats() const {
+    StreamStats stats;
+    stats.chunksGenerated = m_statGenerated.load(std::memory_order_relaxed);
+    stats.chunksMeshed = m_statMeshed.load(std::memory_order_relaxed);
+    stats.columnsBuilt = m_statColumnsBuilt;
+    stats.chunksRemeshed = m_statRemeshed.load(std::memory_order_relaxed);
+    stats.lodColumnsBuilt = m_statLodBuilt.load(std::memory_order_relaxed);
+    stats.horizonTilesBuilt = m_statHorizonBuilt.load(std::memory_order_relaxed);
+    stats.taskLock = m_taskMutex.GetStats();
+    stats.readyLock = m_readyMutex.GetStats();
+    return stats;
+}
+
+const ChunkManager::WorkerCalibration& ChunkManager::CalibrateWorkers() {
+    static WorkerCalibration result;
+    static std::once_flag once;
+    std::call_once(once, [] {
+        // Leave one hardware thread for the main (render) thread
+        int hw = static_cast<int>(std::thread::hardware_concurrency());
+        int maxThreads = std::max(1, hw - 1);
+
+        // Same work a worker does per task: generate + mesh one chunk. Surface
+        // chunks of a fixed seed, each thread on its own strip of columns.
+        WorldGenerator generator(12345);
+        auto work = [&generator](int thread, int item) {
+            Chunk chunk(item % 64, 4, thread * 8 + item / 64 + 1000);
+            generator.Generate(&chunk);
+            chunk.GenerateMeshData();
+        };
+        for (int i = 0; i < 4; ++i) work(0, i);  // warm up caches and the allocator
+
+        constexpr auto STEP_TIME = std::chrono::milliseconds(40);
+        std::vector<int> counts;
+        for (int n = 1; n <= maxThreads; n = (n < 4) ? n + 1 : n + n / 2)
+            counts.push_back(n);
+        if (counts.back() != maxThreads) counts.push_back(maxThreads);
+
+        double best = 0.0;
+        for (int n : counts) {
+            std::atomic<bool> stop{false};
+            std::atomic<uint64_t> done{0};
+            std::vector<std::thread> threads;
+            auto start = std::chrono::steady_clock::now();
+            for (int t = 0; t < n; ++t) {
+                threads.emplace_back([&, t] {
+                    for (int item = 0; !stop.load(std::memory_order_relaxed); ++item) {
+                        work(t, item);
+                        done.fetch_add(1, std::memory_order_relaxed);
+                    }
+                });
+            }
+            std::this_thread::sleep_for(STEP_TIME);
+            stop.store(true);
+            for (auto& th : threads) th.join();
+            double sec = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            double rate = static_cast<double>(done.load()) / sec;
+            result.chunksPerSec.emplace_back(n, rate);
+            best = std::max(best, rate);
+        }
+
+        // Smallest pool that gets (nearly) all of the available throughput
+        for (const auto& [n, rate] : result.chunksPerSec) {
+            if (rate >= best * 0.9) {
+                result.chosen = n;
+                break;
+            }
+        }
+    });
+    return result;
+}
+
+bool ChunkManager::IsFullyLoaded() const {
+    if (m_lastCenterX == INT_MAX) return false;
+    if (!m_pendingLoad.empty() || !m_dirtyColumns.empty() || !m_chunksNeedingRemesh.empty())
+        return false;
+    if (m_lodRescan || !m_lodRequests.empty() || !m_horizonRequests.empty() || !m_lodPending.empty())
+        return false;
+    for (const Chunk* chunk : m_activeChunks)
+        if (chunk && chunk->IsInFlight()) return false;
+    return true;
+}
+
 void ChunkManager::SetRenderDistance(int chunks) {
     if (chunks == m_renderDistance) return;
-    int oldRD = m_renderDistance;
-    SLEAK_INFO("Render distance changed: {} -> {}", oldRD, chunks);
     m_renderDistance = chunks;
     m_drawDistance = static_cast<float>(chunks * Chunk::SIZE);
     m_drawDistSq = m_drawDistance * m_drawDistance;
+    m_budgetDetailCap = INT_MAX;
+    ApplyDetailDistance();
+}
 
-    if (chunks > oldRD) {
+void ChunkManager::SetLodDistances(int level1, int level2, int level3) {
+    std::array<int, 3> distances{level1, std::max(level1, level2), std::max({level1, level2, level3})};
+    if (distances == m_lodDistances) return;
+    m_lodDistances = distances;
+    m_budgetDetailCap = INT_MAX;
+    ApplyDetailDistance();
+}
+
+void ChunkManager::SetHorizonDistance(int chunks) {
+    chunks = std::clamp(chunks, 0, HorizonTerrain::MAX_DISTANCE);
+    if (chunks == m_horizonDistance) return;
+    m_horizonDistance = chunks;
+    m_lodRescan = true;
+    BuildLoadSpiral();
+}
+
+float ChunkManager::GetVisibleDistance() const {
+    if (m_horizonDistance > m_renderDistance)
+        return static_cast<float>(m_horizonDistance * Chunk::SIZE);
+    return m_drawDistance;
+}
+
+// Chunks are kept out to the detail distance; LOD columns (rescanned on the
+// next Update) cover the rest of the render distance
+void ChunkManager::ApplyDetailDistance() {
+    m_lodRescan = true;
+    int oldDetail = m_detailDistance;
+    m_detailDistance = std::min({m_renderDistance, m_lodDistances[0], m_budgetDetailCap});
+
+    if (m_detailDistance > oldDetail) {
         m_pendingUnload.clear();
-    } else {
-        // RD decreased — immediately free out-of-range column meshes and
-        // chunks so VRAM is released before new allocations begin.
+    } else if (m_detailDistance < oldDetail) {
+        // Detail distance decreased — immediately free out-of-range column
+        // meshes and chunks so VRAM is released before new allocations begin.
         int cx = (m_lastCenterX == INT_MAX) ? 0 : m_lastCenterX;
         int cz = (m_lastCenterZ == INT_MAX) ? 0 : m_lastCenterZ;
 
-        // Erase column meshes outside new range first (frees GPU buffers)
-        for (auto it = m_columns.begin(); it != m_columns.end(); ) {
-            if (std::abs(it->first.x - cx) > m_renderDistance ||
-                std::abs(it->first.z - cz) > m_renderDistance) {
-                m_dirtyColumns.erase(it->first);
-                it = m_columns.erase(it);
-            } else {
-                ++it;
+        // Erase column meshes outside new range first (frees GPU buffers).
+        // Backwards, so the slot moved into a hole has already been visited.
+        for (size_t slot = m_columnKeys.size(); slot-- > 0; ) {
+            const ColumnKey& key = m_columnKeys[slot];
+            if (key.yBand < 0) continue;    // LOD columns and horizon tiles
+            if (std::abs(key.x - cx) > m_detailDistance ||
+                std::abs(key.z - cz) > m_detailDistance) {
+                m_dirtyColumns.erase(key);
+                ReleaseColumnMeshes(m_columnMeshes[slot]);
+                EraseColumnSlot(static_cast<uint32_t>(slot));
             }
         }
 
@@ -131,8 +304,8 @@ void ChunkManager::SetRenderDistance(int chunks) {
         std::vector<Chunk*> toDelete;
         for (Chunk* chunk : m_activeChunks) {
             if (!chunk) continue;
-            if (std::abs(chunk->GetChunkX() - cx) > m_renderDistance ||
-                std::abs(chunk->GetChunkZ() - cz) > m_renderDistance) {
+            if (std::abs(chunk->GetChunkX() - cx) > m_detailDistance ||
+                std::abs(chunk->GetChunkZ() - cz) > m_detailDistance) {
                 if (!chunk->IsInFlight())
                     toDelete.push_back(chunk);
             }
@@ -140,7 +313,7 @@ void ChunkManager::SetRenderDistance(int chunks) {
         for (Chunk* chunk : toDelete) {
             UnlinkNeighbors({chunk->GetChunkX(), chunk->GetChunkY(), chunk->GetChunkZ()}, chunk);
             ForceUnloadChunk(chunk);
-            delete chunk;
+            RecycleChunk(chunk);
         }
     }
 
@@ -148,9 +321,12 @@ void ChunkManager::SetRenderDistance(int chunks) {
     BuildLoadSpiral();
 }
 
-void ChunkManager::Initialize(Sleak::SceneBase* scene, const Sleak::RefPtr<Sleak::Material>& material) {
-    m_scene = scene;
-    m_material = material;
+void ChunkManager::Initialize(ChunkRenderBackend* backend) {
+    if (m_backend != backend) {
+        ClearColumns();
+        m_dirtyColumns.clear();
+    }
+    m_backend = backend ? backend : &m_nullBackend;
     m_drawDistance = static_cast<float>(m_renderDistance * Chunk::SIZE);
     m_drawDistSq = m_drawDistance * m_drawDistance;
     BuildLoadSpiral();
@@ -165,7 +341,7 @@ int ChunkManager::GetGridIndex(int cx, int cy, int cz) const {
 }
 
 void ChunkManager::BuildLoadSpiral() {
-    int requiredWidth = (m_renderDistance + 2) * 2;
+    int requiredWidth = (m_detailDistance + 2) * 2;
     bool needsRegrid = requiredWidth > m_gridWidth;
 
     if (needsRegrid) {
@@ -178,11 +354,16 @@ void ChunkManager::BuildLoadSpiral() {
             int idx = GetGridIndex(chunk->GetChunkX(), chunk->GetChunkY(), chunk->GetChunkZ());
             if (idx >= 0) m_chunkGrid[idx] = chunk;
         }
+
+        size_t visCells = static_cast<size_t>(m_gridWidth * m_gridWidth * (m_gridHeight + 1));
+        m_visStamp.assign(visCells, 0);
+        m_visFrame = 0;
+        m_visQueue.reserve(visCells);
     }
 
     m_loadSpiral.clear();
-    for (int x = -m_renderDistance; x <= m_renderDistance; ++x) {
-        for (int z = -m_renderDistance; z <= m_renderDistance; ++z) {
+    for (int x = -m_detailDistance; x <= m_detailDistance; ++x) {
+        for (int z = -m_detailDistance; z <= m_detailDistance; ++z) {
             m_loadSpiral.push_back({x, z});
         }
     }
@@ -190,6 +371,60 @@ void ChunkManager::BuildLoadSpiral() {
     std::sort(m_loadSpiral.begin(), m_loadSpiral.end(), [](const std::pair<int, int>& a, const std::pair<int, int>& b) {
         return (a.first * a.first + a.second * a.second) < (b.first * b.first + b.second * b.second);
     });
+
+    // Size the per-frame queues and sets for everything in range up front,
+    // so streaming never grows them mid-frame
+    size_t columns = m_loadSpiral.size();
+    size_t chunks = columns * (WorldGenerator::MAX_CHUNK_Y - WorldGenerator::MIN_CHUNK_Y + 1);
+    size_t detailBands = columns * ((WorldGenerator::MAX_CHUNK_Y - WorldGenerator::MIN_CHUNK_Y) / BAND_SIZE + 1);
+    size_t lodWidth = static_cast<size_t>(m_renderDistance * 2 + 1);
+    size_t lodColumns = (m_detailDistance < m_renderDistance) ? lodWidth * lodWidth : 0;
+    size_t horizonTiles = (m_horizonDistance > m_renderDistance)
+        ? static_cast<size_t>(HorizonTerrain::GetLevelCount(m_horizonDistance)) *
+          (2 * HorizonTerrain::RING_TILES) * (2 * HorizonTerrain::RING_TILES)
+        : 0;
+    size_t bands = detailBands + lodColumns + horizonTiles;
+    size_t perFrame = static_cast<size_t>(m_chunksPerFrame);
+    m_activeChunks.reserve(chunks);
+    m_pendingLoad.reserve(chunks);
+    m_pendingUnload.reserve(chunks);
+    m_columnSlots.reserve(bands);
+    m_columnKeys.reserve(bands);
+    m_columnMeshes.reserve(bands);
+    m_columnBounds.Reserve(bands);
+    m_visibleSlots.reserve(bands + ColumnBounds::LANES);
+    m_occluderScratch.reserve(bands);
+    m_opaqueDrawList.reserve(bands);
+    m_waterDrawList.reserve(bands);
+    m_dirtyColumns.reserve(detailBands);
+    m_columnRequests.reserve(detailBands);
+    m_lodRequests.reserve(lodColumns);
+    m_horizonLayout.reserve(horizonTiles);
+    m_horizonWanted.reserve(horizonTiles);
+    m_horizonResident.reserve(horizonTiles);
+    m_horizonRequests.reserve(horizonTiles);
+    m_evictScratch.reserve(bands);
+    m_lodPending.reserve(std::max(MAX_LOD_JOBS, LOD_UPLOADS_PER_FRAME));
+    m_lodBatch.reserve(std::max(MAX_LOD_JOBS, LOD_UPLOADS_PER_FRAME));
+    m_lodBuildPool.reserve(MAX_LOD_JOBS);
+    m_lodBuilds.reserve(MAX_LOD_JOBS);
+    m_chunksNeedingRemesh.reserve(chunks);
+    m_unloadedColumns.reserve(perFrame);
+    m_syncDirtyColumns.reserve(perFrame * 2 + static_cast<size_t>(m_uploadsPerFrame));
+    m_dispatchBatch.reserve(perFrame);
+    m_deferredLoads.reserve(chunks);
+    m_deferredUnloads.reserve(chunks);
+    m_remeshBatch.reserve(perFrame);
+    m_rebuildBatch.reserve(static_cast<size_t>(m_uploadsPerFrame));
+    {
+        std::lock_guard<CountingMutex> lock(m_taskMutex);
+        m_taskQueue.reserve(chunks);
+        m_lodTaskQueue.reserve(MAX_LOD_JOBS);
+    }
+    {
+        std::lock_guard<CountingMutex> lock(m_readyMutex);
+        m_lodReadyQueue.reserve(MAX_LOD_JOBS);
+    }
 }
 
 int ChunkManager::GetCachedColumnMaxCy(int cx, int cz) {
@@ -251,7 +486,7 @@ bool ChunkManager::SetBlockAt(int worldX, int worldY, int worldZ, BlockType type
         // (it was likely skipped by IsChunkAboveTerrain)
         if (cy < WorldGenerator::MIN_CHUNK_Y || cy > WorldGenerator::MAX_CHUNK_Y)
             return false;
-        chunk = new Chunk(cx, cy, cz);
+        chunk = AcquireChunk({cx, cy, cz});
         int idx = GetGridIndex(cx, cy, cz);
         if (idx >= 0) {
             m_chunkGrid[idx] = chunk;
@@ -268,15 +503,16 @@ bool ChunkManager::SetBlockAt(int worldX, int worldY, int worldZ, BlockType type
 
     chunk->SetBlock(lx, ly, lz, type);
     chunk->SetDirty(true);
+    chunk->SetEdited(true);
 
-    std::unordered_set<ColumnKey, ColumnKeyHash> affectedColumns;
+    FlatHashSet<ColumnKey, ColumnKeyHash> affectedColumns;
 
     // Only rebuild mesh if the chunk is not being processed by a worker thread
     if (chunk->IsInFlight()) {
         chunk->SetNeedsMeshRebuild(true);
         m_chunksNeedingRemesh.insert({cx, cy, cz});
     } else {
-        chunk->GenerateMeshData();
+        MeshChunk(chunk);
         affectedColumns.insert({cx, ChunkYToBand(cy), cz});
     }
 
@@ -287,7 +523,7 @@ bool ChunkManager::SetBlockAt(int worldX, int worldY, int worldZ, BlockType type
                 neighbor->SetNeedsMeshRebuild(true);
                 m_chunksNeedingRemesh.insert({ncx, ncy, ncz});
             } else {
-                neighbor->GenerateMeshData();
+                MeshChunk(neighbor);
                 affectedColumns.insert({ncx, ChunkYToBand(ncy), ncz});
             }
         }
@@ -307,14 +543,14 @@ bool ChunkManager::SetBlockAt(int worldX, int worldY, int worldZ, BlockType type
 }
 
 VoxelRaycastResult ChunkManager::VoxelRaycast(
-    const Sleak::Math::Vector3D& origin,
-    const Sleak::Math::Vector3D& direction,
+    const WorldVec3& origin,
+    const WorldVec3& direction,
     float maxDist) const
 {
     VoxelRaycastResult result;
 
-    float ox = origin.GetX(), oy = origin.GetY(), oz = origin.GetZ();
-    float dx = direction.GetX(), dy = direction.GetY(), dz = direction.GetZ();
+    float ox = origin.x, oy = origin.y, oz = origin.z;
+    float dx = direction.x, dy = direction.y, dz = direction.z;
 
     int x = static_cast<int>(std::floor(ox));
     int y = static_cast<int>(std::floor(oy));
@@ -380,15 +616,14 @@ VoxelRaycastResult ChunkManager::VoxelRaycast(
 }
 
 VoxelCollisionResult ChunkManager::ResolveVoxelCollision(
-    const Sleak::Math::Vector3D& eyePos,
+    const WorldVec3& eyePos,
     float halfWidth, float height, float eyeOffset) const
 {
-    using namespace Sleak::Math;
     VoxelCollisionResult result;
 
-    float feetY = eyePos.GetY() - eyeOffset;
-    float posX = eyePos.GetX();
-    float posZ = eyePos.GetZ();
+    float feetY = eyePos.y - eyeOffset;
+    float posX = eyePos.x;
+    float posZ = eyePos.z;
 
     auto computeAABB = [&](float fx, float fy, float fz,
                            float& minX, float& minY, float& minZ,
@@ -473,9 +708,9 @@ VoxelCollisionResult ChunkManager::ResolveVoxelCollision(
     }
 
     float newEyeY = feetY + eyeOffset;
-    result.correction = Vector3D(posX - eyePos.GetX(),
-                                  newEyeY - eyePos.GetY(),
-                                  posZ - eyePos.GetZ());
+    result.correction = WorldVec3{posX - eyePos.x,
+                                  newEyeY - eyePos.y,
+                                  posZ - eyePos.z};
 
     return result;
 }
@@ -533,16 +768,40 @@ bool ChunkManager::IsNeighborOfInFlight(const ChunkCoord& coord) const {
     return false;
 }
 
+static size_t MeshBytes(const ChunkMeshData& d) {
+    return d.vertices.size() * sizeof(WorldVertex) + d.indices.size() * sizeof(uint32_t);
+}
+
+// Bit y set when layer y of a chunk is opaque in all of its blocks
+static uint16_t FullOpaqueLayers(const uint8_t* blocks) {
+    constexpr int LAYER = Chunk::SIZE * Chunk::SIZE;
+    uint16_t full = 0;
+    for (int y = 0; y < Chunk::SIZE; ++y) {
+        const uint8_t* layer = blocks + y * LAYER;
+        if (std::all_of(layer, layer + LAYER,
+                        [](uint8_t b) { return IsBlockOpaque(static_cast<BlockType>(b)); }))
+            full |= static_cast<uint16_t>(1u << y);
+    }
+    return full;
+}
+
 void ChunkManager::RebuildColumnMesh(int cx, int yBand, int cz, bool allowDefer) {
+    SLEAK_TRACE_SCOPE("RebuildColumnMesh");
     ColumnKey key{cx, yBand, cz};
 
     int bandMinY = yBand * BAND_SIZE;
     int bandMaxY = bandMinY + BAND_SIZE - 1;
 
-    Sleak::VoxelVertexGroup mergedVerts;
-    Sleak::IndexGroup mergedIndices;
-    Sleak::VoxelVertexGroup mergedWaterVerts;
-    Sleak::IndexGroup mergedWaterIndices;
+    // Member scratch keeps its capacity from column to column
+    ChunkMeshData& merged = m_mergeScratch;
+    ChunkMeshData& mergedWater = m_mergeWaterScratch;
+    merged.vertices.clear();
+    merged.indices.clear();
+    mergedWater.vertices.clear();
+    mergedWater.indices.clear();
+    // Longest run of fully opaque layers, in layers from the band bottom
+    int run = 0, runStart = 0, bestStart = 0, bestLength = 0;
+    int nextLayer = 0;
 
     for (int cy = bandMinY; cy <= bandMaxY; ++cy) {
         Chunk* chunk = GetChunk(cx, cy, cz);
@@ -554,78 +813,204 @@ void ChunkManager::RebuildColumnMesh(int cx, int yBand, int cz, bool allowDefer)
             if (m_multithreaded && allowDefer) {
                 chunk->SetInFlight(true);
                 {
-                    std::lock_guard<std::mutex> lock(m_taskMutex);
+                    std::lock_guard<CountingMutex> lock(m_taskMutex);
                     m_taskQueue.push_back(chunk);
                 }
                 m_taskCV.notify_one();
                 m_dirtyColumns.insert(key);
                 return;
             }
-            chunk->GenerateMeshData();
+            MeshChunk(chunk);
+        }
+        // A chunk skipped above breaks the run
+        int layer = (cy - bandMinY) * Chunk::SIZE;
+        if (layer != nextLayer) run = 0;
+        uint16_t full = FullOpaqueLayers(chunk->GetBlockData());
+        for (int y = 0; y < Chunk::SIZE; ++y, ++layer) {
+            if (!(full & (1u << y))) {
+                run = 0;
+                continue;
+            }
+            if (run++ == 0) runStart = layer;
+            if (run > bestLength) {
+                bestLength = run;
+                bestStart = runStart;
+            }
         }
+        nextLayer = layer;
 
         // Merge opaque mesh
         {
             auto& md = chunk->GetPendingMeshData();
             chunk->ClearPendingMesh();
-
-            if (md.vertices.GetSize() > 0) {
-                uint32_t baseVertex = static_cast<uint32_t>(mergedVerts.GetSize());
-                const Sleak::VoxelVertex* vdata = md.vertices.GetData();
-                for (size_t i = 0; i < md.vertices.GetSize(); ++i)
-                    mergedVerts.AddVertex(vdata[i]);
-                const uint32_t* idata = md.indices.GetData();
-                for (size_t i = 0; i < md.indices.GetSize(); ++i)
-                    mergedIndices.add(idata[i] + baseVertex);
-            }
-            md.vertices.release();
-            md.indices.release();
+            merged.Append(md);
+            ReturnMeshBuffers(md, m_meshBufferPool);
         }
 
         // Merge water mesh
         {
             auto& wd = chunk->GetPendingWaterMeshData();
             chunk->ClearPendingWaterMesh();
-
-            if (wd.vertices.GetSize() > 0) {
-                uint32_t baseVertex = static_cast<uint32_t>(mergedWaterVerts.GetSize());
-                const Sleak::VoxelVertex* vdata = wd.vertices.GetData();
-                for (size_t i = 0; i < wd.vertices.GetSize(); ++i)
-                    mergedWaterVerts.AddVertex(vdata[i]);
-                const uint32_t* idata = wd.indices.GetData();
-                for (size_t i = 0; i < wd.indices.GetSize(); ++i)
-                    mergedWaterIndices.add(idata[i] + baseVertex);
-            }
-            wd.vertices.release();
-            wd.indices.release();
+            mergedWater.Append(wd);
+            ReturnMeshBuffers(wd, m_waterBufferPool);
         }
     }
 
-    if (mergedVerts.GetSize() == 0 && mergedWaterVerts.GetSize() == 0) {
-        m_columns.erase(key);
+    if (merged.vertices.empty() && mergedWater.vertices.empty()) {
+        EraseColumn(key);
+        m_columnRequests.erase(key);    // nothing to draw, never becomes visible
         return;
     }
 
     // Release old GPU buffers BEFORE allocating new ones to reduce peak VRAM.
-    auto existingIt = m_columns.find(key);
-    if (existingIt != m_columns.end()) {
-        existingIt->second.mesh = {};
-        existingIt->second.waterMesh = {};
+    ColumnMesh col;
+    ColumnMesh* existing = FindColumn(key);
+    if (existing) {
+        ReleaseColumnMeshes(*existing);
+        col.awaitingFirstDraw = existing->awaitingFirstDraw;
+        col.requested = existing->requested;
     }
+    col.lastVisibleFrame = m_meshFrame;
 
-    ColumnMesh col;
-    if (mergedVerts.GetSize() > 0)
-        col.mesh = Sleak::MeshBatch::CreateVoxelMesh(mergedVerts, mergedIndices);
-    if (mergedWaterVerts.GetSize() > 0)
-        col.waterMesh = Sleak::MeshBatch::CreateVoxelMesh(mergedWaterVerts, mergedWaterIndices);
+    if (!ReserveMeshBytes(MeshBytes(merged) + MeshBytes(mergedWater))) {
+        if (existing) existing->evicted = true;
+        m_dirtyColumns.insert(key);
+        m_oomThisFrame = true;
+        return;
+    }
 
-    if (!col.mesh.IsValid() && !col.waterMesh.IsValid()) {
+    if (!merged.vertices.empty()) {
+        col.mesh = m_backend->CreateMesh(merged);
+        if (col.mesh) col.bytes += MeshBytes(merged);
+        col.indexCount = static_cast<uint32_t>(merged.indices.size());
+        if (merged.HasFaceRanges())
+            std::copy(std::begin(merged.faceIndexCounts), std::end(merged.faceIndexCounts), col.faceIndices);
+    }
+    if (!mergedWater.vertices.empty()) {
+        col.waterMesh = m_backend->CreateMesh(mergedWater);
+        if (col.waterMesh) col.bytes += MeshBytes(mergedWater);
+    }
+
+    if (col.mesh == 0 && col.waterMesh == 0) {
+        if (existing) existing->evicted = true;
+        m_dirtyColumns.insert(key);
         m_oomThisFrame = true;
         return;
     }
 
-    col.visible = true;
-    m_columns[key] = std::move(col);
+    ++m_columnMeshCount;
+    m_columnMeshBytes += col.bytes;
+    m_frameUploadBytes += col.bytes;
+
+    auto requestIt = m_columnRequests.find(key);
+    if (requestIt != m_columnRequests.end()) {
+        col.awaitingFirstDraw = true;
+        col.requested = requestIt->second;
+        m_columnRequests.erase(requestIt);
+    }
+
+    // Occluder: only layers that are solid wall to wall, so caves, ravines
+    // and overhangs (or a dug tunnel) are never taken as solid
+    float bandBottom = static_cast<float>(bandMinY * Chunk::SIZE);
+    col.occluderBottom = bandBottom + static_cast<float>(bestStart);
+    col.occluderTop = col.occluderBottom + static_cast<float>(bestLength);
+    bool occluder = bestLength > 0;
+
+    // Tight Y bounds (the band's full height hides nothing behind a hill),
+    // still enclosing the occluder so a column is never hidden by itself
+    float minY = occluder ? col.occluderBottom : std::numeric_limits<float>::max();
+    float maxY = occluder ? col.occluderTop : -std::numeric_limits<float>::max();
+    for (const ChunkMeshData* data : {&merged, &mergedWater})
+        for (const WorldVertex& v : data->vertices) {
+            minY = std::min(minY, v.y);
+            maxY = std::max(maxY, v.y);
+        }
+
+    ColumnMesh& inserted = InsertColumn(key);
+    inserted = col;
+    size_t slot = static_cast<size_t>(&inserted - m_columnMeshes.data());
+    float minX = static_cast<float>(cx * Chunk::SIZE), minZ = static_cast<float>(cz * Chunk::SIZE);
+    m_columnBounds.Set(slot, WorldVec3{minX, minY, minZ},
+                       WorldVec3{minX + Chunk::SIZE, maxY, minZ + Chunk::SIZE});
+    m_drawListsStale = true;    // draw it this frame if it is in view
+    ++m_statColumnsBuilt;
+}
+
+void ChunkManager::ReleaseColumnMeshes(ColumnMesh& col) {
+    if (col.mesh) m_backend->DestroyMesh(col.mesh);
+    if (col.waterMesh) m_backend->DestroyMesh(col.waterMesh);
+    if (col.mesh || col.waterMesh) {
+        --m_columnMeshCount;
+        m_columnMeshBytes -= col.bytes;
+        if (col.lodLevel) {
+            --m_lodColumnCount;
+            m_lodColumnBytes -= col.bytes;
+        }
+        if (col.horizon) {
+            --m_horizonTileCount;
+            m_horizonTileBytes -= col.bytes;
+        }
+    }
+    col.mesh = 0;
+    col.waterMesh = 0;
+    col.bytes = 0;
+}
+
+ChunkManager::ColumnMesh* ChunkManager::FindColumn(const ColumnKey& key) {
+    auto it = m_columnSlots.find(key);
+    return (it != m_columnSlots.end()) ? &m_columnMeshes[it->second] : nullptr;
+}
+
+ChunkManager::ColumnMesh& ChunkManager::InsertColumn(const ColumnKey& key) {
+    auto [it, inserted] = m_columnSlots.try_emplace(key, static_cast<uint32_t>(m_columnKeys.size()));
+    if (inserted) {
+        float minX = static_cast<float>(key.x * Chunk::SIZE);
+        float minY = static_cast<float>(key.yBand * BAND_SIZE * Chunk::SIZE);
+        float minZ = static_cast<float>(key.z * Chunk::SIZE);
+        m_columnKeys.push_back(key);
+        m_columnMeshes.emplace_back();
+        m_columnBounds.Append(WorldVec3{minX, minY, minZ},
+                              WorldVec3{minX + Chunk::SIZE, minY + BAND_SIZE * Chunk::SIZE,
+                                        minZ + Chunk::SIZE});
+        m_drawListsStale = true;
+    }
+    return m_columnMeshes[it->second];
+}
+
+void ChunkManager::EraseColumn(const ColumnKey& key) {
+    auto it = m_columnSlots.find(key);
+    if (it == m_columnSlots.end()) return;
+    ReleaseColumnMeshes(m_columnMeshes[it->second]);
+    EraseColumnSlot(it->second);
+}
+
+// The caller has released the meshes
+void ChunkManager::EraseColumnSlot(uint32_t slot) {
+    uint32_t last = static_cast<uint32_t>(m_columnKeys.size() - 1);
+    m_columnSlots.erase(m_columnKeys[slot]);
+    if (slot != last) {
+        m_columnKeys[slot] = m_columnKeys[last];
+        m_columnMeshes[slot] = m_columnMeshes[last];
+        m_columnSlots.find(m_columnKeys[slot])->second = slot;
+    }
+    m_columnKeys.pop_back();
+    m_columnMeshes.pop_back();
+    m_columnBounds.SwapRemove(slot);
+    m_drawListsStale = true;
+}
+
+void ChunkManager::ClearColumns() {
+    for (auto& col : m_columnMeshes)
+        ReleaseColumnMeshes(col);
+    m_columnSlots.clear();
+    m_columnKeys.clear();
+    m_columnMeshes.clear();
+    m_columnBounds.Clear();
+    m_horizonResident.clear();
+    m_opaqueDrawList.clear();
+    m_waterDrawList.clear();
+    m_shadowDrawList.clear();
+    m_drawListsStale = false;
 }
 
 void ChunkManager::ForceUnloadChunk(Chunk* chunk) {
@@ -645,7 +1030,73 @@ void ChunkManager::ForceUnloadChunk(Chunk* chunk) {
     chunk->SetActiveIndex(-1);
 }
 
+// Frees a grid slot held by an out-of-range chunk still waiting to unload,
+// along with that chunk's column (the slot's new chunk is in range, so the
+// old one is not)
+void ChunkManager::EvictChunk(Chunk* stale) {
+    ColumnKey key{stale->GetChunkX(), ChunkYToBand(stale->GetChunkY()), stale->GetChunkZ()};
+    UnlinkNeighbors({stale->GetChunkX(), stale->GetChunkY(), stale->GetChunkZ()}, stale);
+    ForceUnloadChunk(stale);
+    RecycleChunk(stale);
+    EraseColumn(key);
+    m_dirtyColumns.erase(key);
+}
+
+Chunk* ChunkManager::AcquireChunk(const ChunkCoord& coord) {
+    if (m_chunkPool.empty()) return new Chunk(coord.x, coord.y, coord.z);
+    Chunk* chunk = m_chunkPool.back();
+    m_chunkPool.pop_back();
+    chunk->Reset(coord.x, coord.y, coord.z);
+    return chunk;
+}
+
+// Chunk must already be unlinked and out of the grid / active list
+void ChunkManager::RecycleChunk(Chunk* chunk) {
+    ReturnMeshBuffers(chunk->GetPendingMeshData(), m_meshBufferPool);
+    ReturnMeshBuffers(chunk->GetPendingWaterMeshData(), m_waterBufferPool);
+    if (m_chunkPool.size() >= CHUNK_POOL_MAX) {
+        delete chunk;
+        return;
+    }
+    if (m_chunkPool.capacity() == 0) m_chunkPool.reserve(CHUNK_POOL_MAX);
+    m_chunkPool.push_back(chunk);
+}
+
+// Swaps in the smallest pooled buffer holding `vertexCount` vertices when the
+// chunk's own is too small. If none does, the commit keeps the scratch's.
+void ChunkManager::LendMeshBuffers(ChunkMeshData& data, size_t vertexCount, std::vector<ChunkMeshData>& pool) {
+    if (data.vertices.capacity() >= vertexCount) return;
+    auto fit = std::lower_bound(pool.begin(), pool.end(), vertexCount,
+        [](const ChunkMeshData& pooled, size_t count) { return pooled.vertices.capacity() < count; });
+    if (fit == pool.end()) return;
+    ChunkMeshData lent = std::move(*fit);
+    pool.erase(fit);
+    ReturnMeshBuffers(data, pool);
+    data = std::move(lent);
+}
+
+// Leaves `data` empty. The pool is kept sorted by capacity; once it is full
+// the smallest buffers are the ones freed. With workers the main thread
+// seldom meshes, so their buffers are freed rather than pooled.
+void ChunkManager::ReturnMeshBuffers(ChunkMeshData& data, std::vector<ChunkMeshData>& pool) {
+    auto byCapacity = [](size_t capacity, const ChunkMeshData& pooled) {
+        return capacity < pooled.vertices.capacity();
+    };
+    size_t capacity = data.vertices.capacity();
+    if (capacity == 0 || m_multithreaded || (pool.size() >= MESH_BUFFER_POOL_MAX &&
+                                             capacity <= pool.front().vertices.capacity())) {
+        data.release();
+        return;
+    }
+    if (pool.capacity() == 0) pool.reserve(MESH_BUFFER_POOL_MAX);
+    if (pool.size() >= MESH_BUFFER_POOL_MAX) pool.erase(pool.begin());
+    pool.insert(std::upper_bound(pool.begin(), pool.end(), capacity, byCapacity), std::move(data));
+    data.release();
+}
+
 void ChunkManager::Update(float playerX, float playerY, float playerZ) {
+    SLEAK_TRACE_SCOPE("ChunkManager::Update");
+    if (m_budgetCapPending) ApplyBudgetDetailCap();
     int centerX = static_cast<int>(std::floor(playerX / Chunk::SIZE));
     int centerY = static_cast<int>(std::floor(playerY / Chunk::SIZE));
     int centerZ = static_cast<int>(std::floor(playerZ / Chunk::SIZE));
@@ -654,11 +1105,13 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
     bool yMoved  = (centerY != m_lastCenterY);
 
     if (xzMoved) {
+        SLEAK_TRACE_SCOPE("Unload scan");
         // Save previous center before updating, so we can compute exiting slabs.
         int prevCX = (m_lastCenterX == INT_MAX) ? centerX : m_lastCenterX;
         int prevCZ = (m_lastCenterZ == INT_MAX) ? centerZ : m_lastCenterZ;
         m_lastCenterX = centerX;
         m_lastCenterZ = centerZ;
+        m_lodRescan = true;
 
         // Queue out-of-range chunks for gradual unloading.
         // When the player moves by a small delta we only need to check the slabs
@@ -666,41 +1119,42 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
         // Fall back to a full scan on large teleports.
         int dX = std::abs(centerX - prevCX);
         int dZ = std::abs(centerZ - prevCZ);
-        bool largeTeleport = (dX > m_renderDistance * 2 || dZ > m_renderDistance * 2);
+        bool largeTeleport = (dX > m_detailDistance * 2 || dZ > m_detailDistance * 2);
         if (largeTeleport) {
             for (Chunk* chunk : m_activeChunks) {
                 if (!chunk) continue;
                 int cx = chunk->GetChunkX(), cy = chunk->GetChunkY(), cz = chunk->GetChunkZ();
-                if (std::abs(cx - centerX) > m_renderDistance ||
-                    std::abs(cz - centerZ) > m_renderDistance)
+                if (std::abs(cx - centerX) > m_detailDistance ||
+                    std::abs(cz - centerZ) > m_detailDistance)
                     m_pendingUnload.push_back({cx, cy, cz});
             }
         } else {
             // Unload X-axis slabs that just left view
             auto unloadSlabX = [&](int cx) {
-                for (int cz2 = prevCZ - m_renderDistance; cz2 <= prevCZ + m_renderDistance; ++cz2)
+                for (int cz2 = prevCZ - m_detailDistance; cz2 <= prevCZ + m_detailDistance; ++cz2)
                     for (int cy = WorldGenerator::MIN_CHUNK_Y; cy <= WorldGenerator::MAX_CHUNK_Y; ++cy)
                         if (GetChunk(cx, cy, cz2)) m_pendingUnload.push_back({cx, cy, cz2});
             };
             if (centerX > prevCX)
-                for (int x = prevCX - m_renderDistance; x < centerX - m_renderDistance; ++x) unloadSlabX(x);
+                for (int x = prevCX - m_detailDistance; x < centerX - m_detailDistance; ++x) unloadSlabX(x);
             else if (centerX < prevCX)
-                for (int x = centerX + m_renderDistance + 1; x <= prevCX + m_renderDistance; ++x) unloadSlabX(x);
+                for (int x = centerX + m_detailDistance + 1; x <= prevCX + m_detailDistance; ++x) unloadSlabX(x);
 
             // Unload Z-axis slabs that just left view
             auto unloadSlabZ = [&](int cz2) {
-                for (int cx = centerX - m_renderDistance; cx <= centerX + m_renderDistance; ++cx)
+                for (int cx = centerX - m_detailDistance; cx <= centerX + m_detailDistance; ++cx)
                     for (int cy = WorldGenerator::MIN_CHUNK_Y; cy <= WorldGenerator::MAX_CHUNK_Y; ++cy)
                         if (GetChunk(cx, cy, cz2)) m_pendingUnload.push_back({cx, cy, cz2});
             };
             if (centerZ > prevCZ)
-                for (int z = prevCZ - m_renderDistance; z < centerZ - m_renderDistance; ++z) unloadSlabZ(z);
+                for (int z = prevCZ - m_detailDistance; z < centerZ - m_detailDistance; ++z) unloadSlabZ(z);
             else if (centerZ < prevCZ)
-                for (int z = centerZ + m_renderDistance + 1; z <= prevCZ + m_renderDistance; ++z) unloadSlabZ(z);
+                for (int z = centerZ + m_detailDistance + 1; z <= prevCZ + m_detailDistance; ++z) unloadSlabZ(z);
         }
     }
 
     if (xzMoved || yMoved) {
+        SLEAK_TRACE_SCOPE("Load queue");
         m_lastCenterY = centerY;
 
         m_pendingLoad.clear();
@@ -711,11 +1165,26 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
             int cz = centerZ + offset.second;
             int maxCy = GetCachedColumnMaxCy(cx, cz);
             for (int cy = WorldGenerator::MIN_CHUNK_Y; cy <= maxCy; ++cy) {
-                if (!GetChunk(cx, cy, cz))
+                if (!GetChunk(cx, cy, cz)) {
                     m_pendingLoad.push_back({cx, cy, cz});
+                    // Time-to-visible starts at the first request of a column
+                    // that has nothing on screen yet
+                    ColumnKey colKey{cx, ChunkYToBand(cy), cz};
+                    if (!FindColumn(colKey))
+                        m_columnRequests.emplace(colKey, std::chrono::steady_clock::now());
+                }
             }
         }
 
+        // Drop requests for columns that left the detail distance unseen
+        for (auto it = m_columnRequests.begin(); it != m_columnRequests.end(); ) {
+            if (std::abs(it->first.x - centerX) > m_detailDistance ||
+                std::abs(it->first.z - centerZ) > m_detailDistance)
+                it = m_columnRequests.erase(it);
+            else
+                ++it;
+        }
+
         // Velocity in chunk-space from last player world position.
         float dvx = (playerX - m_lastPlayerX) / Chunk::SIZE;
         float dvy = (playerY - m_lastPlayerY) / Chunk::SIZE;
@@ -725,11 +1194,11 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
         if (speed > 0.05f) {
             // Velocity-biased sort: chunks ahead of the player are pulled to the
             // front of the load queue so they appear before the player arrives.
-            // lookahead scales with speed, capped at render distance.
+            // lookahead scales with speed, capped at the detail distance.
             float inv = 1.0f / speed;
             float nx = dvx * inv, ny = dvy * inv, nz = dvz * inv;
             float lookahead = std::min(speed * 4.0f,
-                                       static_cast<float>(m_renderDistance));
+                                       static_cast<float>(m_detailDistance));
             std::sort(m_pendingLoad.begin(), m_pendingLoad.end(),
                 [centerX, centerY, centerZ, nx, ny, nz, lookahead](
                         const ChunkCoord& a, const ChunkCoord& b) {
@@ -766,8 +1235,12 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
 
     // Process pending unloads gradually (rate-limited)
     {
+        SLEAK_TRACE_SCOPE("Unload");
         int unloaded = 0;
-        std::unordered_set<ColumnKey, ColumnKeyHash> columnsToCheck;
+        FlatHashSet<ColumnKey, ColumnKeyHash>& columnsToCheck = m_unloadedColumns;
+        columnsToCheck.clear();
+        std::vector<ChunkCoord>& busy = m_deferredUnloads;
+        busy.clear();
         while (unloaded < m_chunksPerFrame && !m_pendingUnload.empty()) {
             ChunkCoord coord = m_pendingUnload.back();
             m_pendingUnload.pop_back();
@@ -775,19 +1248,24 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
             Chunk* chunk = GetChunk(coord.x, coord.y, coord.z);
             if (!chunk) continue;
 
-            if (std::abs(coord.x - centerX) <= m_renderDistance &&
-                std::abs(coord.z - centerZ) <= m_renderDistance)
+            if (std::abs(coord.x - centerX) <= m_detailDistance &&
+                std::abs(coord.z - centerZ) <= m_detailDistance)
                 continue;
 
-            if (chunk->IsInFlight() || IsNeighborOfInFlight(coord))
+            // A worker still uses it — retry on a later frame (left behind,
+            // its column would stay drawn on top of the LOD columns)
+            if (chunk->IsInFlight() || IsNeighborOfInFlight(coord)) {
+                busy.push_back(coord);
                 continue;
+            }
 
             columnsToCheck.insert({coord.x, ChunkYToBand(coord.y), coord.z});
             UnlinkNeighbors(coord, chunk);
             ForceUnloadChunk(chunk);
-            delete chunk;
+            RecycleChunk(chunk);
             ++unloaded;
         }
+        m_pendingUnload.insert(m_pendingUnload.begin(), busy.begin(), busy.end());
 
         // Free column meshes whose bands lost all chunks.  For columns
         // that still have SOME chunks, erase the column mesh immediately
@@ -802,18 +1280,15 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
                 if (GetChunk(colKey.x, cy, colKey.z)) { hasChunks = true; break; }
             }
             if (!hasChunks) {
-                m_columns.erase(colKey);
+                EraseColumn(colKey);
                 m_dirtyColumns.erase(colKey);
             } else {
                 // Column still has chunks but lost some — the existing
                 // column mesh is oversized.  Free its GPU buffers now
                 // and queue a rebuild so the next pass allocates a
                 // smaller buffer.
-                auto it = m_columns.find(colKey);
-                if (it != m_columns.end()) {
-                    it->second.mesh = {};
-                    it->second.waterMesh = {};
-                }
+                if (ColumnMesh* col = FindColumn(colKey))
+                    ReleaseColumnMeshes(*col);
                 m_dirtyColumns.insert(colKey);
             }
         }
@@ -825,9 +1300,12 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
         // We carefully check whether pointers actually changed before marking
         // anything for remesh, to avoid cascading unnecessary rebuilds.
         {
-            std::vector<Chunk*> ready;
+            SLEAK_TRACE_SCOPE("Integrate");
+            // Swap with the scratch vector so both keep their capacity
+            std::vector<Chunk*>& ready = m_readyScratch;
+            ready.clear();
             {
-                std::lock_guard<std::mutex> lock(m_readyMutex);
+                std::lock_guard<CountingMutex> lock(m_readyMutex);
                 ready.swap(m_readyQueue);
             }
             static const struct { BlockFace face; int dx, dy, dz; BlockFace opposite; } dirs[] = {
@@ -881,56 +1359,66 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
         }
 
         // Phase 2: Dispatch new chunks to workers
-        int dispatchBudget = m_chunksPerFrame;
-
-        std::vector<Chunk*> batch;
-        int dispatched = 0;
-        while (dispatched < dispatchBudget && !m_pendingLoad.empty()) {
-            ChunkCoord coord = m_pendingLoad.back();
-            m_pendingLoad.pop_back();
-
-            if (GetChunk(coord.x, coord.y, coord.z)) continue;
-
-            auto* chunk = new Chunk(coord.x, coord.y, coord.z);
-            int idx = GetGridIndex(coord.x, coord.y, coord.z);
-            if (idx >= 0) {
-                if (m_chunkGrid[idx] != nullptr) {
+        {
+            SLEAK_TRACE_SCOPE("Dispatch");
+            int dispatchBudget = m_chunksPerFrame;
+
+            std::vector<Chunk*>& batch = m_dispatchBatch;
+            std::vector<ChunkCoord>& deferred = m_deferredLoads;
+            batch.clear();
+            deferred.clear();
+            int dispatched = 0;
+            while (dispatched < dispatchBudget && !m_pendingLoad.empty()) {
+                ChunkCoord coord = m_pendingLoad.back();
+                m_pendingLoad.pop_back();
+
+                if (GetChunk(coord.x, coord.y, coord.z)) continue;
+
+                int idx = GetGridIndex(coord.x, coord.y, coord.z);
+                // The grid slot still holds an out-of-range chunk that a worker is
+                // using (directly or as a neighbor) — retry once it has returned.
+                if (idx >= 0 && m_chunkGrid[idx] != nullptr) {
                     Chunk* stale = m_chunkGrid[idx];
-                    UnlinkNeighbors({stale->GetChunkX(), stale->GetChunkY(), stale->GetChunkZ()}, stale);
-                    ForceUnloadChunk(stale);
-                    delete stale;
+                    if (stale->IsInFlight() ||
+                        IsNeighborOfInFlight({stale->GetChunkX(), stale->GetChunkY(), stale->GetChunkZ()})) {
+                        deferred.push_back(coord);
+                        continue;
+                    }
                 }
-                m_chunkGrid[idx] = chunk;
-                chunk->SetActiveIndex(static_cast<int>(m_activeChunks.size()));
-                m_activeChunks.push_back(chunk);
-            }
-            int64_t key = PackCoord(coord.x, coord.y, coord.z);
-            auto savedIt = m_savedBlockData.find(key);
-            if (savedIt != m_savedBlockData.end()) {
-                std::memcpy(const_cast<uint8_t*>(chunk->GetBlockData()),
-                            savedIt->second.data(), 4096);
-                chunk->SetNeedsGeneration(false);
+
+                Chunk* chunk = AcquireChunk(coord);
+                if (idx >= 0) {
+                    if (m_chunkGrid[idx] != nullptr) EvictChunk(m_chunkGrid[idx]);
+                    m_chunkGrid[idx] = chunk;
+                    chunk->SetActiveIndex(static_cast<int>(m_activeChunks.size()));
+                    m_activeChunks.push_back(chunk);
+                }
+                if (RestoreSavedBlocks(chunk))
+                    chunk->SetNeedsGeneration(false);
+                LinkNeighbors(coord, chunk);
+                batch.push_back(chunk);
+                ++dispatched;
             }
-            LinkNeighbors(coord, chunk);
-            batch.push_back(chunk);
-            ++dispatched;
-        }
+            m_pendingLoad.insert(m_pendingLoad.begin(), deferred.begin(), deferred.end());
 
-        if (!batch.empty()) {
-            {
-                std::lock_guard<std::mutex> lock(m_taskMutex);
-                for (auto* chunk : batch) {
-                    chunk->SetInFlight(true);
-                    m_taskQueue.push_back(chunk);
+            if (!batch.empty()) {
+                {
+                    std::lock_guard<CountingMutex> lock(m_taskMutex);
+                    for (auto* chunk : batch) {
+                        chunk->SetInFlight(true);
+                        m_taskQueue.push_back(chunk);
+                    }
                 }
+                m_taskCV.notify_all();
             }
-            m_taskCV.notify_all();
         }
 
         // Phase 3: Dispatch remesh requests to workers
         // Uses m_chunksNeedingRemesh (O(k)) instead of scanning all chunks (O(n))
         {
-            std::vector<Chunk*> remeshBatch;
+            SLEAK_TRACE_SCOPE("Dispatch remesh");
+            std::vector<Chunk*>& remeshBatch = m_remeshBatch;
+            remeshBatch.clear();
             int remeshBudget = m_chunksPerFrame;
             auto it = m_chunksNeedingRemesh.begin();
             while (it != m_chunksNeedingRemesh.end() && remeshBudget > 0) {
@@ -953,7 +1441,7 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
                 --remeshBudget;
             }
             if (!remeshBatch.empty()) {
-                std::lock_guard<std::mutex> lock(m_taskMutex);
+                std::lock_guard<CountingMutex> lock(m_taskMutex);
                 for (auto* ch : remeshBatch) {
                     ch->SetInFlight(true);
                     m_taskQueue.push_back(ch);
@@ -966,6 +1454,7 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
         // Skip columns where any chunk is still in-flight to prevent
         // flickering (the old column mesh stays visible until remesh is done).
         {
+            SLEAK_TRACE_SCOPE("Column uploads");
             m_oomThisFrame = false;
             // Strict cap: never exceed m_uploadsPerFrame column rebuilds
             // per frame.  The old adaptive *2 boost caused VRAM spikes
@@ -973,7 +1462,8 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
             // a render-distance change or fast player movement).
             int uploadBudget = m_uploadsPerFrame;
 
-            std::vector<ColumnKey> toRebuild;
+            std::vector<ColumnKey>& toRebuild = m_rebuildBatch;
+            toRebuild.clear();
             {
                 int count = 0;
                 for (auto it = m_dirtyColumns.begin();
@@ -1005,38 +1495,29 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
         }
     } else {
         // Synchronous path
+        SLEAK_TRACE_SCOPE("Sync build");
         int built = 0;
-        std::unordered_set<ColumnKey, ColumnKeyHash> syncDirtyColumns;
+        FlatHashSet<ColumnKey, ColumnKeyHash>& syncDirtyColumns = m_syncDirtyColumns;
+        syncDirtyColumns.clear();
         while (built < m_chunksPerFrame && !m_pendingLoad.empty()) {
             ChunkCoord coord = m_pendingLoad.back();
             m_pendingLoad.pop_back();
 
             if (GetChunk(coord.x, coord.y, coord.z)) continue;
 
-            auto* chunk = new Chunk(coord.x, coord.y, coord.z);
+            Chunk* chunk = AcquireChunk(coord);
             int idx = GetGridIndex(coord.x, coord.y, coord.z);
             if (idx >= 0) {
-                if (m_chunkGrid[idx] != nullptr) {
-                    Chunk* stale = m_chunkGrid[idx];
-                    UnlinkNeighbors({stale->GetChunkX(), stale->GetChunkY(), stale->GetChunkZ()}, stale);
-                    ForceUnloadChunk(stale);
-                    delete stale;
-                }
+                if (m_chunkGrid[idx] != nullptr) EvictChunk(m_chunkGrid[idx]);
                 m_chunkGrid[idx] = chunk;
                 chunk->SetActiveIndex(static_cast<int>(m_activeChunks.size()));
                 m_activeChunks.push_back(chunk);
             }
-            int64_t key = PackCoord(coord.x, coord.y, coord.z);
-            auto savedIt = m_savedBlockData.find(key);
-            if (savedIt != m_savedBlockData.end()) {
-                std::memcpy(const_cast<uint8_t*>(chunk->GetBlockData()),
-                            savedIt->second.data(), 4096);
-            } else {
-                m_generator.Generate(chunk);
-            }
+            if (!RestoreSavedBlocks(chunk))
+                GenerateChunk(chunk);
             chunk->SetNeedsGeneration(false);
             LinkNeighbors(coord, chunk);
-            chunk->GenerateMeshData();
+            MeshChunk(chunk);
             syncDirtyColumns.insert({coord.x, ChunkYToBand(coord.y), coord.z});
             ++built;
         }
@@ -1051,13 +1532,23 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
                     continue;
                 }
                 ch->SetNeedsMeshRebuild(false);
-                ch->GenerateMeshData();
+                MeshChunk(ch);
                 syncDirtyColumns.insert({ch->GetChunkX(), ChunkYToBand(ch->GetChunkY()), ch->GetChunkZ()});
                 it = m_chunksNeedingRemesh.erase(it);
                 ++rebuilt;
             }
         }
 
+        // Columns queued by unloading or an earlier out-of-memory frame
+        {
+            int carried = 0;
+            for (auto it = m_dirtyColumns.begin();
+                 it != m_dirtyColumns.end() && carried < m_uploadsPerFrame; ++carried) {
+                syncDirtyColumns.insert(*it);
+                it = m_dirtyColumns.erase(it);
+            }
+        }
+
         m_oomThisFrame = false;
         for (auto& col : syncDirtyColumns) {
             if (m_oomThisFrame) {
@@ -1068,51 +1559,125 @@ void ChunkManager::Update(float playerX, float playerY, float playerZ) {
         }
     }
 
+    UpdateLod(centerX, centerZ);
+    m_backend->Compact();
+    TraverseVisibility();
     FrustumCull();
+    UpdateTelemetry();
+}
+
+void ChunkManager::UpdateTelemetry() {
+    SLEAK_TRACE_SCOPE("Telemetry");
+    auto& t = m_telemetry;
+    t.pendingLoad = m_pendingLoad.size();
+    t.pendingUnload = m_pendingUnload.size();
+    t.dirtyColumns = m_dirtyColumns.size();
+    t.remeshSet = m_chunksNeedingRemesh.size();
+    if (m_multithreaded) {
+        {
+            std::lock_guard<CountingMutex> lock(m_taskMutex);
+            t.taskQueue = m_taskQueue.size();
+        }
+        {
+            std::lock_guard<CountingMutex> lock(m_readyMutex);
+            t.readyQueue = m_readyQueue.size();
+        }
+    } else {
+        t.taskQueue = 0;
+        t.readyQueue = 0;
+    }
+
+    t.columnMeshes = m_columnMeshCount;
+    t.columnMeshBytes = m_columnMeshBytes;
+    t.lodColumns = m_lodColumnCount;
+    t.lodColumnBytes = m_lodColumnBytes;
+    t.lodQueue = m_lodRequests.size() + m_lodPending.size();
+    t.horizonTiles = m_horizonTileCount;
+    t.horizonTileBytes = m_horizonTileBytes;
+    t.horizonQueue = m_horizonRequests.size();
+    t.meshBudgetBytes = m_meshBudget;
+    t.evictedColumns = m_evictedColumns;
+    t.budgetDetailCap = (m_budgetDetailCap == INT_MAX) ? 0 : m_budgetDetailCap;
+    t.uploadBytesLastFrame = m_frameUploadBytes;
+    m_windowUploadBytes += m_frameUploadBytes;
+    m_windowPeakUpload = std::max(m_windowPeakUpload, m_frameUploadBytes);
+    m_frameUploadBytes = 0;
+    ++m_windowFrames;
+
+    // Rates and per-chunk figures once per second
+    auto now = std::chrono::steady_clock::now();
+    if (m_windowStart == std::chrono::steady_clock::time_point{}) {
+        m_windowStart = now;
+        m_windowStats = GetStreamStats();
+        return;
+    }
+    double sec = std::chrono::duration<double>(now - m_windowStart).count();
+    if (sec < 1.0) return;
+
+    StreamStats s = GetStreamStats();
+    auto rate = [sec](uint64_t a, uint64_t b) { return static_cast<float>(static_cast<double>(b - a) / sec); };
+    t.generatedPerSec = rate(m_windowStats.chunksGenerated, s.chunksGenerated);
+    t.meshedPerSec = rate(m_windowStats.chunksMeshed, s.chunksMeshed);
+    t.remeshedPerSec = rate(m_windowStats.chunksRemeshed, s.chunksRemeshed);
+    t.columnsBuiltPerSec = rate(m_windowStats.columnsBuilt, s.columnsBuilt);
+    t.uploadBytesPerFrameAvg = static_cast<float>(m_windowUploadBytes) / static_cast<float>(m_windowFrames);
+    t.uploadBytesPeakFrame = m_windowPeakUpload;
+
+    uint64_t meshes = 0, counted = 0;
+    uint32_t maxMeshes = 0;
+    for (const Chunk* chunk : m_activeChunks) {
+        if (!chunk || chunk->IsInFlight() || chunk->GetMeshCount() == 0) continue;
+        meshes += chunk->GetMeshCount();
+        maxMeshes = std::max<uint32_t>(maxMeshes, chunk->GetMeshCount());
+        ++counted;
+    }
+    t.meshesPerChunkAvg = counted ? static_cast<float>(meshes) / static_cast<float>(counted) : 0.0f;
+    t.meshesPerChunkMax = maxMeshes;
+
+    m_windowStart = now;
+    m_windowStats = s;
+    m_windowUploadBytes = 0;
+    m_windowPeakUpload = 0;
+    m_windowFrames = 0;
+}
+
+void ChunkManager::RecordFirstDraw(ColumnMesh& col) {
+    col.awaitingFirstDraw = false;
+    m_telemetry.timeToVisible.Record(std::chrono::duration<double, std::milli>(
+        std::chrono::steady_clock::now() - col.requested).count());
 }
 
 void ChunkManager::FlushPendingChunks() {
+    SLEAK_TRACE_SCOPE("FlushPendingChunks");
     // Pass 1: Generate all chunks and link neighbors
     std::vector<ChunkCoord> generated;
     while (!m_pendingLoad.empty()) {
         ChunkCoord coord = m_pendingLoad.back();
         m_pendingLoad.pop_back();
-        m_pendingSet.erase(coord);
 
         if (GetChunk(coord.x, coord.y, coord.z)) continue;
 
-        auto* chunk = new Chunk(coord.x, coord.y, coord.z);
+        Chunk* chunk = AcquireChunk(coord);
         int idx = GetGridIndex(coord.x, coord.y, coord.z);
         if (idx >= 0) {
-            if (m_chunkGrid[idx] != nullptr) {
-                Chunk* stale = m_chunkGrid[idx];
-                UnlinkNeighbors({stale->GetChunkX(), stale->GetChunkY(), stale->GetChunkZ()}, stale);
-                ForceUnloadChunk(stale);
-                delete stale;
-            }
+            if (m_chunkGrid[idx] != nullptr) EvictChunk(m_chunkGrid[idx]);
             m_chunkGrid[idx] = chunk;
             chunk->SetActiveIndex(static_cast<int>(m_activeChunks.size()));
             m_activeChunks.push_back(chunk);
         }
-        int64_t key = PackCoord(coord.x, coord.y, coord.z);
-        auto savedIt = m_savedBlockData.find(key);
-        if (savedIt != m_savedBlockData.end()) {
-            std::memcpy(const_cast<uint8_t*>(chunk->GetBlockData()),
-                        savedIt->second.data(), 4096);
-        } else {
-            m_generator.Generate(chunk);
-        }
+        if (!RestoreSavedBlocks(chunk))
+            GenerateChunk(chunk);
         chunk->SetNeedsGeneration(false);
         LinkNeighbors(coord, chunk);
         generated.push_back(coord);
     }
 
     // Pass 2: Mesh all chunks (now that all neighbors exist and are linked)
-    std::unordered_set<ColumnKey, ColumnKeyHash> flushDirtyColumns;
+    FlatHashSet<ColumnKey, ColumnKeyHash> flushDirtyColumns;
     for (auto& coord : generated) {
         Chunk* chunk = GetChunk(coord.x, coord.y, coord.z);
         if (chunk) {
-            chunk->GenerateMeshData();
+            MeshChunk(chunk);
             flushDirtyColumns.insert({coord.x, ChunkYToBand(coord.y), coord.z});
         }
     }
@@ -1122,11 +1687,17 @@ void ChunkManager::FlushPendingChunks() {
         RebuildColumnMesh(col.x, col.yBand, col.z);
 }
 
-int64_t ChunkManager::PackCoord(int32_t cx, int32_t cy, int32_t cz) {
-    uint64_t ux = static_cast<uint32_t>(cx);
-    uint64_t uy = static_cast<uint32_t>(cy) & 0xFFFF;
-    uint64_t uz = static_cast<uint32_t>(cz);
-    return static_cast<int64_t>((ux << 32) | (uy << 16) | (uz & 0xFFFF));
+static_assert(WorldGenerator::MIN_CHUNK_Y >= ChunkKey::Y_MIN && WorldGenerator::MAX_CHUNK_Y <= ChunkKey::Y_MAX,
+              "chunk Y range must fit ChunkKey");
+
+bool ChunkManager::RestoreSavedBlocks(Chunk* chunk) const {
+    if (m_savedBlockData.Empty()) return false;
+    const auto* saved = m_savedBlockData.Find(
+        ChunkKey::Pack(chunk->GetChunkX(), chunk->GetChunkY(), chunk->GetChunkZ()));
+    if (!saved) return false;
+    std::memcpy(const_cast<uint8_t*>(chunk->GetBlockData()), saved->data(), saved->size());
+    chunk->SetEdited(true);
+    return true;
 }
 
 std::vector<ChunkManager::DirtyChunkInfo> ChunkManager::GetDirtyChunks() const {
@@ -1144,15 +1715,19 @@ void ChunkManager::ClearDirtyFlags() {
         if (chunk) chunk->SetDirty(false);
 }
 
-void ChunkManager::LoadChunkData(const std::unordered_map<int64_t, std::array<uint8_t, 4096>>& data) {
-    m_savedBlockData = data;
+void ChunkManager::LoadChunkData(SavedChunkMap data) {
+    // Workers read the saved blocks while building LOD columns
+    bool running = !m_workers.empty();
+    if (running) StopWorkers();
+    m_savedBlockData = std::move(data);
+    if (running) StartWorkers();
 }
 
 void ChunkManager::ForceReload() {
     bool wasMultithreaded = m_multithreaded;
     if (wasMultithreaded) StopWorkers();
 
-    m_columns.clear();
+    ClearColumns();
     m_dirtyColumns.clear();
     m_chunksNeedingRemesh.clear();
 
@@ -1163,7 +1738,11 @@ void ChunkManager::ForceReload() {
     m_activeChunks.clear();
     m_chunkGrid.assign(m_chunkGrid.size(), nullptr);
     m_pendingLoad.clear();
-    m_pendingSet.clear();
+    m_columnRequests.clear();
+    m_lodRequests.clear();
+    m_horizonRequests.clear();
+    m_lodPending.clear();
+    m_lodRescan = true;
     m_lastCenterX = INT_MAX;
     m_lastCenterY = INT_MAX;
     m_lastCenterZ = INT_MAX;
@@ -1174,122 +1753,864 @@ void ChunkManager::ForceReload() {
     if (wasMultithreaded) StartWorkers();
 }
 
+void ChunkManager::SetView(const WorldVec3& cameraPos, const WorldFrustum& frustum) {
+    m_viewPos = cameraPos;
+    m_viewFrustum = frustum;
+    m_hasView = true;
+    m_hasViewProj = false;
+}
+
+void ChunkManager::SetView(const WorldVec3& cameraPos, const WorldFrustum& frustum,
+                           const WorldViewProj& viewProj) {
+    SetView(cameraPos, frustum);
+    m_viewProj = viewProj;
+    m_hasViewProj = true;
+}
+
+// BlockFace directions with a face turned toward `eye` possible inside the
+// bounds: every face of a column lies within them, and a +Y face at height
+// h is only seen from above h (likewise for the other five)
+static uint8_t FacingFaces(const WorldVec3& eye, const WorldVec3& min, const WorldVec3& max) {
+    uint8_t faces = 0;
+    if (eye.y > min.y) faces |= 1u << static_cast<uint8_t>(BlockFace::Top);
+    if (eye.y < max.y) faces |= 1u << static_cast<uint8_t>(BlockFace::Bottom);
+    if (eye.z > min.z) faces |= 1u << static_cast<uint8_t>(BlockFace::North);
+    if (eye.z < max.z) faces |= 1u << static_cast<uint8_t>(BlockFace::South);
+    if (eye.x > min.x) faces |= 1u << static_cast<uint8_t>(BlockFace::East);
+    if (eye.x < max.x) faces |= 1u << static_cast<uint8_t>(BlockFace::West);
+    return faces;
+}
+
 void ChunkManager::FrustumCull() {
-    const auto& frustum = Sleak::Camera::GetMainViewFrustum();
-    const auto& camPos = Sleak::Camera::GetMainCameraPosition();
-    float camX = camPos.GetX();
-    float camY = camPos.GetY();
-    float camZ = camPos.GetZ();
+    SLEAK_TRACE_SCOPE("FrustumCull");
+    ++m_meshFrame;
+    ColumnCull::Params params;
+    params.frustum = m_hasView ? &m_viewFrustum : nullptr;
+    params.camX = m_hasView ? m_viewPos.x : m_lastPlayerX;
+    params.camZ = m_hasView ? m_viewPos.z : m_lastPlayerZ;
+    // Horizontal-only distance check (XZ cylinder) so columns stay visible
+    // when the player is high above the terrain. With the horizon on, the
+    // chunks' whole square is drawn and the horizon tiles around it.
+    if (m_horizonDistance > m_renderDistance) {
+        float visible = GetVisibleDistance();
+        params.drawDistSq = visible * visible;
+    } else {
+        params.drawDistSq = m_drawDistSq;
+    }
+    // Without a caster pass the shadow map only sees this pass, so columns
+    // near the player are drawn regardless of the frustum and of occlusion:
+    // terrain above caves and enclosed spaces stays in the shadow map and
+    // sunlight does not leak through it
+    constexpr float SHADOW_FORCE_DIST = 48.0f;
+    if (!m_backend->HasShadowCasterPass())
+        params.forceDistSq = SHADOW_FORCE_DIST * SHADOW_FORCE_DIST;
+
+    m_visibleSlots.resize(m_columnBounds.PaddedSize());
+    size_t visible = ColumnCull::Cull(m_columnBounds, params, m_visibleSlots.data());
+    // Directions are only left out when the backend draws ranges and the
+    // shadow map has its own pass: without one it sees what this pass draws,
+    // and a face turned from the camera can still face the sun
+    bool faceRanges = m_backend->DrawsFaceRanges() && m_backend->HasShadowCasterPass();
+    // Directions RenderShadowCasters submits when the camera pass leaves them out
+    uint8_t shadowFaces = m_shadowCasting && m_backend->HasShadowCasterPass() ? m_shadowLitFaces : 0;
+
+    // Occluders are only ever truly solid blocks, so the buffer holds in
+    // caves too
+    bool useBuffer = m_occlusionBufferEnabled && m_hasView && m_hasViewProj;
+    if (useBuffer) DrawOccluders(visible);
+    else m_telemetry.occluderColumns = 0;
+
+    m_opaqueDrawList.clear();
+    m_waterDrawList.clear();
+    m_sortEye = m_hasView ? m_viewPos : WorldVec3{m_lastPlayerX, m_lastPlayerY, m_lastPlayerZ};
+    size_t occluded = 0, rejected = 0;
+    size_t drawnIndices = 0, skippedIndices = 0, shadowIndices = 0;
+    int centerX = static_cast<int>(std::floor(m_lastPlayerX / Chunk::SIZE));
+    int centerZ = static_cast<int>(std::floor(m_lastPlayerZ / Chunk::SIZE));
+    for (size_t i = 0; i < visible; ++i) {
+        uint32_t slot = m_visibleSlots[i];
+        const ColumnKey& key = m_columnKeys[slot];
+        if (IsLodCovered(key, centerX, centerZ)) continue;
+        WorldVec3 min{m_columnBounds.MinX()[slot], m_columnBounds.MinY()[slot], m_columnBounds.MinZ()[slot]};
+        WorldVec3 max{m_columnBounds.MaxX()[slot], m_columnBounds.MaxY()[slot], m_columnBounds.MaxZ()[slot]};
+        // Shadow casters in the forced radius are kept even when hidden
+        float dx = std::max({min.x - params.camX, params.camX - max.x, 0.0f});
+        float dz = std::max({min.z - params.camZ, params.camZ - max.z, 0.0f});
+        bool forced = params.forceDistSq > 0.0f && dx * dx + dz * dz <= params.forceDistSq;
+        if (!forced) {
+            if (m_visTraversed && key.yBand >= 0 && !IsColumnReachable(key)) {
+                ++occluded;
+                continue;
+            }
+            if (useBuffer && !m_occlusionBuffer.IsVisible(min, max)) {
+                ++rejected;
+                continue;
+            }
+        }
+        ColumnMesh& col = m_columnMeshes[slot];
+        col.lastVisibleFrame = m_meshFrame;
+        if (col.evicted) ReloadEvictedColumn(slot);
+        if (col.mesh) {
+            m_opaqueDrawList.push_back(slot);
+            col.drawFaces = faceRanges ? FacingFaces(m_sortEye, min, max) : ChunkMeshData::ALL_FACES;
+            uint32_t skipped = 0, shadowed = 0;
+            for (int face = 0; face < 6; ++face) {
+                if (col.drawFaces & (1u << face)) continue;
+                if (shadowFaces & (1u << face)) shadowed += col.faceIndices[face];
+                else skipped += col.faceIndices[face];
+            }
+            drawnIndices += col.indexCount - skipped - shadowed;
+            skippedIndices += skipped;
+            shadowIndices += shadowed;
+        }
+        if (col.waterMesh) m_waterDrawList.push_back(slot);
+    }
+    m_telemetry.frustumColumns = visible;
+    m_telemetry.occludedColumns = occluded;
+    m_telemetry.occlusionRejectedColumns = rejected;
+    m_telemetry.drawnTriangles = drawnIndices / 3;
+    m_telemetry.backfaceSkippedTriangles = skippedIndices / 3;
+    m_telemetry.shadowFaceTriangles = shadowIndices / 3;
+    CullShadowCasters();
+
+    auto sortStart = std::chrono::steady_clock::now();
+    SortDrawList(m_opaqueDrawList, 0);
+    SortDrawList(m_waterDrawList, 1);
+    m_telemetry.drawSortMs = std::chrono::duration<float, std::milli>(
+        std::chrono::steady_clock::now() - sortStart).count();
+    m_telemetry.drawListResorts = m_drawListResorts;
+    m_drawListsStale = false;
+}
 
-    for (auto& [key, col] : m_columns) {
-        if (!col.mesh.IsValid() && !col.waterMesh.IsValid()) { col.visible = false; continue; }
+bool ChunkManager::IsLodCovered(const ColumnKey& key, int centerX, int centerZ) const {
+    if (key.yBand != LOD_BAND ||
+        std::max(std::abs(key.x - centerX), std::abs(key.z - centerZ)) > m_detailDistance)
+        return false;
+    auto detail = m_columnSlots.find(ColumnKey{key.x, 0, key.z});
+    return detail != m_columnSlots.end() && !m_columnMeshes[detail->second].evicted;
+}
 
-        float minX = static_cast<float>(key.x * Chunk::SIZE);
-        float minY = static_cast<float>(key.yBand * BAND_SIZE * Chunk::SIZE);
-        float minZ = static_cast<float>(key.z * Chunk::SIZE);
-        float maxX = minX + Chunk::SIZE;
-        float maxY = minY + BAND_SIZE * Chunk::SIZE;
-        float maxZ = minZ + Chunk::SIZE;
-
-        // Horizontal-only distance check (XZ cylinder) so columns stay visible
-        // when the player is high above the terrain
-        float dx = (camX < minX) ? (minX - camX) : (camX > maxX) ? (camX - maxX) : 0.0f;
-        float dz = (camZ < minZ) ? (minZ - camZ) : (camZ > maxZ) ? (camZ - maxZ) : 0.0f;
-        float distSq = dx * dx + dz * dz;
+// ── Shadow casters ───────────────────────────────────────────────────────────
+
+void ChunkManager::SetShadowLight(const WorldVec3& direction, float shadowDistance, float maxSweep) {
+    float len = std::sqrt(direction.x * direction.x + direction.y * direction.y + direction.z * direction.z);
+    m_shadowCasting = len > 0.0f && direction.y < 0.0f && shadowDistance > 0.0f;
+    if (m_shadowCasting)
+        m_shadowLightDir = {direction.x / len, direction.y / len, direction.z / len};
+    // The directions facing the sun (against the way light travels)
+    m_shadowLitFaces = 0;
+    if (m_shadowCasting) {
+        const WorldVec3& light = m_shadowLightDir;
+        if (light.y < 0.0f) m_shadowLitFaces |= 1u << static_cast<uint8_t>(BlockFace::Top);
+        if (light.y > 0.0f) m_shadowLitFaces |= 1u << static_cast<uint8_t>(BlockFace::Bottom);
+        if (light.z < 0.0f) m_shadowLitFaces |= 1u << static_cast<uint8_t>(BlockFace::North);
+        if (light.z > 0.0f) m_shadowLitFaces |= 1u << static_cast<uint8_t>(BlockFace::South);
+        if (light.x < 0.0f) m_shadowLitFaces |= 1u << static_cast<uint8_t>(BlockFace::East);
+        if (light.x > 0.0f) m_shadowLitFaces |= 1u << static_cast<uint8_t>(BlockFace::West);
+    }
+    m_shadowDistance = shadowDistance;
+    m_shadowSweep = maxSweep;
+    m_drawListsStale = true;
+}
 
-        if (distSq > m_drawDistSq) {
-            col.visible = false;
-            continue;
+// A column at c shades c + t * L for t in [0, sweep]; that meets the
+// receivers (the view, no farther than the shadow distance) only if, for
+// every receiver plane, n.c + d + max(0, sweep * n.L) >= 0. So the casters
+// are culled with those planes and a draw distance widened by the sweep's
+// horizontal reach, on the same kernels as the view. Columns the view
+// already draws are left out: the opaque pass has them. Nothing is culled
+// while the backend has no caster pass to draw them in.
+void ChunkManager::CullShadowCasters() {
+    m_shadowDrawList.clear();
+    size_t casters = 0;
+    if (m_shadowCasting && m_hasView && m_backend->HasShadowCasterPass()) {
+        SLEAK_TRACE_SCOPE("ShadowCull");
+        const WorldVec3& light = m_shadowLightDir;
+        // Nothing is shaded from higher than the world's top down to its bottom
+        constexpr float WORLD_SPAN = static_cast<float>(
+            (WorldGenerator::MAX_CHUNK_Y + 1 - WorldGenerator::MIN_CHUNK_Y) * Chunk::SIZE);
+        float sweep = std::min(m_shadowSweep, WORLD_SPAN / -light.y);
+
+        WorldFrustum receivers = m_viewFrustum;
+        // Receivers end at the shadow distance: the far plane faces back
+        // along the near plane's normal (the view direction)
+        const float* nearPlane = receivers.planes[0];
+        WorldVec3 forward{nearPlane[0], nearPlane[1], nearPlane[2]};
+        float farDist = forward.x * m_viewPos.x + forward.y * m_viewPos.y + forward.z * m_viewPos.z
+                      + m_shadowDistance;
+        receivers.planes[1][0] = -forward.x;
+        receivers.planes[1][1] = -forward.y;
+        receivers.planes[1][2] = -forward.z;
+        receivers.planes[1][3] = farDist;
+        for (auto& p : receivers.planes)
+            p[3] += std::max(0.0f, sweep * (p[0] * light.x + p[1] * light.y + p[2] * light.z));
+
+        ColumnCull::Params params;
+        params.frustum = &receivers;
+        params.camX = m_viewPos.x;
+        params.camZ = m_viewPos.z;
+        float reach = m_shadowDistance + sweep * std::sqrt(light.x * light.x + light.z * light.z);
+        params.drawDistSq = std::min(reach * reach, m_drawDistSq);
+
+        m_shadowSlots.resize(m_columnBounds.PaddedSize());
+        size_t count = ColumnCull::Cull(m_columnBounds, params, m_shadowSlots.data());
+        int centerX = static_cast<int>(std::floor(m_lastPlayerX / Chunk::SIZE));
+        int centerZ = static_cast<int>(std::floor(m_lastPlayerZ / Chunk::SIZE));
+        for (size_t i = 0; i < count; ++i) {
+            uint32_t slot = m_shadowSlots[i];
+            ColumnMesh& col = m_columnMeshes[slot];
+            if (col.horizon || IsLodCovered(m_columnKeys[slot], centerX, centerZ)) continue;
+            ++casters;
+            if (col.lastVisibleFrame == m_meshFrame) continue;      // in the view
+            col.lastVisibleFrame = m_meshFrame;
+            if (col.evicted) ReloadEvictedColumn(slot);
+            if (col.mesh) m_shadowDrawList.push_back(slot);
         }
+    }
+    m_telemetry.shadowCasterColumns = casters;
+    m_telemetry.shadowOnlyColumns = m_shadowDrawList.size();
+}
 
-        // Force-render columns near the player regardless of camera frustum.
-        // This ensures terrain above caves/enclosed spaces is always in the
-        // shadow map, preventing sunlight from leaking through terrain.
-        constexpr float SHADOW_FORCE_DIST = 48.0f;
-        if (distSq <= SHADOW_FORCE_DIST * SHADOW_FORCE_DIST) {
-            col.visible = true;
-            continue;
+// Quantized distance from the camera: to the nearest point of the bounds
+// for opaque columns, to their center for water (its surfaces blend in
+// order of their middles). Water keys count down, so both sort ascending.
+uint32_t ChunkManager::DrawSortKey(uint32_t slot, int pass) const {
+    float minX = m_columnBounds.MinX()[slot], maxX = m_columnBounds.MaxX()[slot];
+    float minY = m_columnBounds.MinY()[slot], maxY = m_columnBounds.MaxY()[slot];
+    float minZ = m_columnBounds.MinZ()[slot], maxZ = m_columnBounds.MaxZ()[slot];
+    float dx, dy, dz;
+    if (pass == 0) {
+        dx = std::max({minX - m_sortEye.x, m_sortEye.x - maxX, 0.0f});
+        dy = std::max({minY - m_sortEye.y, m_sortEye.y - maxY, 0.0f});
+        dz = std::max({minZ - m_sortEye.z, m_sortEye.z - maxZ, 0.0f});
+    } else {
+        dx = (minX + maxX) * 0.5f - m_sortEye.x;
+        dy = (minY + maxY) * 0.5f - m_sortEye.y;
+        dz = (minZ + maxZ) * 0.5f - m_sortEye.z;
+    }
+    float q = std::min(std::sqrt(dx * dx + dy * dy + dz * dz) * SORT_KEY_SCALE, 65535.0f);
+    uint32_t key = static_cast<uint32_t>(q);
+    return pass == 0 ? key : 65535u - key;
+}
+
+void ChunkManager::SortDrawList(std::vector<uint32_t>& list, int pass) {
+    // Columns from last frame's list in their old order; new ones apart
+    const uint32_t gen = m_sortGen[pass];
+    std::vector<uint32_t>& byRank = m_sortByRank;
+    std::vector<DrawItem>& items = m_sortItems;
+    std::vector<DrawItem>& fresh = m_sortFresh;
+    byRank.assign(m_sortedCount[pass], UINT32_MAX);
+    items.clear();
+    fresh.clear();
+    for (uint32_t slot : list) {
+        const ColumnMesh& col = m_columnMeshes[slot];
+        if (col.sortGen[pass] == gen && col.drawRank[pass] < byRank.size())
+            byRank[col.drawRank[pass]] = slot;
+        else
+            fresh.push_back({DrawSortKey(slot, pass), slot});
+    }
+    for (uint32_t slot : byRank)
+        if (slot != UINT32_MAX) items.push_back({DrawSortKey(slot, pass), slot});
+
+    // Insertion sort both while they are nearly in order, then merge...
+    auto byKey = [](const DrawItem& a, const DrawItem& b) { return a.key < b.key; };
+    int moves = 0;
+    auto insertionSort = [&moves](std::vector<DrawItem>& v) {
+        for (size_t i = 1; i < v.size(); ++i) {
+            DrawItem item = v[i];
+            size_t j = i;
+            for (; j > 0 && v[j - 1].key > item.key; --j) {
+                if (++moves > SORT_INSERTION_MAX) {
+                    v[j] = item;
+                    return false;
+                }
+                v[j] = v[j - 1];
+            }
+            v[j] = item;
         }
+        return true;
+    };
+    std::vector<DrawItem>& sorted = m_sortScratch;
+    const size_t n = items.size() + fresh.size();
+    sorted.resize(n);
+    if (insertionSort(items) && insertionSort(fresh)) {
+        std::merge(items.begin(), items.end(), fresh.begin(), fresh.end(), sorted.begin(), byKey);
+    } else {
+        // ...else two 8-bit LSD radix passes over the 16-bit keys (stable,
+        // and an insertion sort stopped halfway left a permutation)
+        items.insert(items.end(), fresh.begin(), fresh.end());
+        DrawItem* src = items.data();
+        DrawItem* dst = sorted.data();
+        for (int shift = 0; shift < 16; shift += 8) {
+            uint32_t offsets[256] = {};
+            for (size_t k = 0; k < n; ++k) ++offsets[(src[k].key >> shift) & 0xFF];
+            uint32_t sum = 0;
+            for (uint32_t& o : offsets) {
+                uint32_t c = o;
+                o = sum;
+                sum += c;
+            }
+            for (size_t k = 0; k < n; ++k) dst[offsets[(src[k].key >> shift) & 0xFF]++] = src[k];
+            std::swap(src, dst);
+        }
+        sorted.swap(items);     // an even pass count leaves the result in items
+        ++m_drawListResorts;
+    }
+
+    ++m_sortGen[pass];
+    m_sortedCount[pass] = static_cast<uint32_t>(n);
+    for (size_t k = 0; k < n; ++k) {
+        uint32_t slot = sorted[k].slot;
+        list[k] = slot;
+        m_columnMeshes[slot].drawRank[pass] = static_cast<uint32_t>(k);
+        m_columnMeshes[slot].sortGen[pass] = m_sortGen[pass];
+    }
+}
+
+// Occluders of the nearest columns in view. Columns the visibility graph
+// drops still occlude, so this takes every column that passed the frustum test.
+void ChunkManager::DrawOccluders(size_t visible) {
+    SLEAK_TRACE_SCOPE("OcclusionBuffer");
+    m_occluderScratch.clear();
+    for (size_t i = 0; i < visible; ++i) {
+        uint32_t slot = m_visibleSlots[i];
+        const ColumnMesh& col = m_columnMeshes[slot];
+        if (m_columnKeys[slot].yBand < 0 || !(col.occluderTop > col.occluderBottom)) continue;
+        float dx = std::max({m_columnBounds.MinX()[slot] - m_viewPos.x, m_viewPos.x - m_columnBounds.MaxX()[slot], 0.0f});
+        float dz = std::max({m_columnBounds.MinZ()[slot] - m_viewPos.z, m_viewPos.z - m_columnBounds.MaxZ()[slot], 0.0f});
+        float distSq = dx * dx + dz * dz;
+        if (distSq <= OCCLUDER_DIST * OCCLUDER_DIST) m_occluderScratch.push_back({distSq, slot});
+    }
+    if (m_occluderScratch.size() > MAX_OCCLUDERS) {
+        std::nth_element(m_occluderScratch.begin(), m_occluderScratch.begin() + MAX_OCCLUDERS,
+                         m_occluderScratch.end());
+        m_occluderScratch.resize(MAX_OCCLUDERS);
+    }
+    // Front to back, so occluders already hidden by nearer ones are skipped
+    std::sort(m_occluderScratch.begin(), m_occluderScratch.end());
+
+    m_occlusionBuffer.Begin(m_viewProj);
+    size_t drawn = 0;
+    for (const auto& [distSq, slot] : m_occluderScratch) {
+        const ColumnMesh& col = m_columnMeshes[slot];
+        WorldVec3 min{m_columnBounds.MinX()[slot], col.occluderBottom, m_columnBounds.MinZ()[slot]};
+        WorldVec3 max{m_columnBounds.MaxX()[slot], col.occluderTop, m_columnBounds.MaxZ()[slot]};
+        if (!m_occlusionBuffer.IsVisible(min, max)) continue;
+        m_occlusionBuffer.DrawOccluder(min, max);
+        ++drawn;
+    }
+    m_telemetry.occluderColumns = drawn;
+}
+
+int ChunkManager::GetVisIndex(int cx, int cy, int cz) const {
+    if (cy == WorldGenerator::MAX_CHUNK_Y + 1) {
+        int px = (cx % m_gridWidth); if (px < 0) px += m_gridWidth;
+        int pz = (cz % m_gridWidth); if (pz < 0) pz += m_gridWidth;
+        return px + pz * m_gridWidth + m_gridHeight * m_gridWidth * m_gridWidth;
+    }
+    return GetGridIndex(cx, cy, cz);
+}
+
+void ChunkManager::TraverseVisibility() {
+    m_visTraversed = false;
+    if (!m_occlusionCulling || !m_hasView || m_visStamp.empty()) return;
+
+    SLEAK_TRACE_SCOPE("Visibility");
+    int camCx = floorDiv(static_cast<int>(std::floor(m_viewPos.x)), Chunk::SIZE);
+    int camCy = floorDiv(static_cast<int>(std::floor(m_viewPos.y)), Chunk::SIZE);
+    int camCz = floorDiv(static_cast<int>(std::floor(m_viewPos.z)), Chunk::SIZE);
+    // Below the world or high above it everything in the frustum may show
+    if (camCy < WorldGenerator::MIN_CHUNK_Y || camCy > WorldGenerator::MAX_CHUNK_Y + 1) return;
+
+    if (++m_visFrame == 0) {
+        std::fill(m_visStamp.begin(), m_visStamp.end(), 0u);
+        m_visFrame = 1;
+    }
+
+    static constexpr int STEP[6][3] = {
+        {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}, {1, 0, 0}, {-1, 0, 0}
+    };  // BlockFace order: Top, Bottom, North, South, East, West
+
+    m_visQueue.clear();
+    m_visStamp[GetVisIndex(camCx, camCy, camCz)] = m_visFrame;
+    m_visQueue.push_back({camCx, camCy, camCz, VIS_NO_FACE, 0});
+    for (size_t head = 0; head < m_visQueue.size(); ++head) {
+        VisNode node = m_visQueue[head];
+        // Unloaded, unmeshed or in-flight chunks (and the sky) are open
+        const Chunk* chunk = GetChunk(node.cx, node.cy, node.cz);
+        uint16_t faces = (chunk && chunk->IsMeshBuilt() && !chunk->IsInFlight())
+                       ? chunk->GetFaceConnectivity() : ChunkVisibility::ALL;
+
+        for (int f = 0; f < 6; ++f) {
+            BlockFace exit = static_cast<BlockFace>(f);
+            if (node.dirs & (1u << static_cast<int>(ChunkVisibility::Opposite(exit)))) continue;
+            if (node.entry != VIS_NO_FACE &&
+                !ChunkVisibility::Connected(faces, static_cast<BlockFace>(node.entry), exit))
+                continue;
 
-        col.visible = frustum.IsAABBVisible(
-            Sleak::Math::Vector3D(minX, minY, minZ),
-            Sleak::Math::Vector3D(maxX, maxY, maxZ));
+            int nx = node.cx + STEP[f][0], ny = node.cy + STEP[f][1], nz = node.cz + STEP[f][2];
+            if (ny < WorldGenerator::MIN_CHUNK_Y || ny > WorldGenerator::MAX_CHUNK_Y + 1) continue;
+            if (std::abs(nx - camCx) > m_detailDistance || std::abs(nz - camCz) > m_detailDistance) continue;
+            int idx = GetVisIndex(nx, ny, nz);
+            if (m_visStamp[idx] == m_visFrame) continue;
+
+            float minX = static_cast<float>(nx * Chunk::SIZE);
+            float minY = static_cast<float>(ny * Chunk::SIZE);
+            float minZ = static_cast<float>(nz * Chunk::SIZE);
+            if (!m_viewFrustum.IsAABBVisible(WorldVec3{minX, minY, minZ},
+                    WorldVec3{minX + Chunk::SIZE, minY + Chunk::SIZE, minZ + Chunk::SIZE}))
+                continue;
+
+            m_visStamp[idx] = m_visFrame;
+            m_visQueue.push_back({nx, ny, nz,
+                                  static_cast<uint8_t>(ChunkVisibility::Opposite(exit)),
+                                  static_cast<uint8_t>(node.dirs | (1u << f))});
+        }
     }
+    m_visTraversed = true;
+}
+
+bool ChunkManager::IsColumnReachable(const ColumnKey& key) const {
+    int first = std::max(key.yBand * BAND_SIZE, WorldGenerator::MIN_CHUNK_Y);
+    int last = std::min(key.yBand * BAND_SIZE + BAND_SIZE - 1, WorldGenerator::MAX_CHUNK_Y);
+    for (int cy = first; cy <= last; ++cy) {
+        int idx = GetGridIndex(key.x, cy, key.z);
+        if (idx >= 0 && m_visStamp[idx] == m_visFrame) return true;
+    }
+    return false;
 }
 
 void ChunkManager::RenderColumns() {
-    Sleak::MeshBatch::BeginBatch(m_material.get());
-    for (auto& [key, col] : m_columns) {
-        if (col.visible && col.mesh.IsValid())
-            Sleak::MeshBatch::Draw(col.mesh);
+    SLEAK_TRACE_SCOPE("RenderColumns");
+    if (m_drawListsStale) FrustumCull();
+    m_backend->BeginPass(ChunkRenderPass::Opaque);
+    for (uint32_t slot : m_opaqueDrawList) {
+        ColumnMesh& col = m_columnMeshes[slot];
+        if (col.mesh) {
+            m_backend->DrawFaces(col.mesh, col.drawFaces);
+            if (col.awaitingFirstDraw) RecordFirstDraw(col);
+        }
     }
-    Sleak::MeshBatch::EndBatch();
+    m_backend->EndPass();
+}
+
+void ChunkManager::RenderShadowCasters() {
+    SLEAK_TRACE_SCOPE("RenderShadowCasters");
+    if (m_drawListsStale) FrustumCull();
+    if (!m_shadowCasting || !m_backend->HasShadowCasterPass()) return;
+
+    bool begun = false;
+    auto draw = [&](ChunkMeshId mesh, uint8_t faces) {
+        if (!begun) m_backend->BeginPass(ChunkRenderPass::ShadowCaster);
+        begun = true;
+        m_backend->DrawFaces(mesh, faces);
+    };
+    for (uint32_t slot : m_shadowDrawList) {
+        const ColumnMesh& col = m_columnMeshes[slot];
+        if (col.mesh) draw(col.mesh, ChunkMeshData::ALL_FACES);
+    }
+    // The directions facing the sun that the camera pass left out of the
+    // columns in view for facing away from the camera
+    for (uint32_t slot : m_opaqueDrawList) {
+        const ColumnMesh& col = m_columnMeshes[slot];
+        uint8_t faces = static_cast<uint8_t>(~col.drawFaces & m_shadowLitFaces);
+        if (col.mesh && faces) draw(col.mesh, faces);
+    }
+    if (begun) m_backend->EndPass();
 }
 
 void ChunkManager::RenderWater() {
-    if (!m_waterMaterial) return;
-    Sleak::MeshBatch::BeginBatch(m_waterMaterial.get());
-    for (auto& [key, col] : m_columns) {
-        if (col.visible && col.waterMesh.IsValid())
-            Sleak::MeshBatch::Draw(col.waterMesh);
+    SLEAK_TRACE_SCOPE("RenderWater");
+    if (m_drawListsStale) FrustumCull();
+    m_backend->BeginPass(ChunkRenderPass::Water);
+    for (uint32_t slot : m_waterDrawList) {
+        ColumnMesh& col = m_columnMeshes[slot];
+        if (col.waterMesh) {
+            m_backend->Draw(col.waterMesh);
+            if (col.awaitingFirstDraw) RecordFirstDraw(col);
+        }
     }
-    Sleak::MeshBatch::EndBatch();
+    m_backend->EndPass();
 }
 
-// ── Heightmap cache ──────────────────────────────────────────────────────────
-// Format: magic(4) seed(4) count(4) [cx(4) cz(4) maxCy(4)] * count
-// Tied to seed — if seed mismatches the file is silently ignored.
+// ── Mesh budget ──────────────────────────────────────────────────────────────
 
-static constexpr uint32_t HEIGHTMAP_MAGIC = 0x484D4348; // "HMCH"
+void ChunkManager::SetMeshBudget(size_t bytes) {
+    m_meshBudget = bytes;
+    m_budgetCapPending = false;
+    if (m_budgetDetailCap != INT_MAX) {
+        m_budgetDetailCap = INT_MAX;
+        ApplyDetailDistance();
+    }
+}
 
-void ChunkManager::SaveHeightmapCache(const std::string& path) const {
-    if (m_columnMaxCyCache.empty()) return;
+bool ChunkManager::ReserveMeshBytes(size_t bytes) {
+    if (m_meshBudget == 0 || m_columnMeshBytes + bytes <= m_meshBudget) return true;
+    size_t target = static_cast<size_t>(static_cast<double>(m_meshBudget) * EVICT_TARGET);
+    EvictColumns(target > bytes ? target - bytes : 0);
+    if (m_columnMeshBytes + bytes <= m_meshBudget) return true;
+    // Only columns in view are left: draw fewer at full detail
+    if (m_detailDistance > MIN_BUDGET_DETAIL) m_budgetCapPending = true;
+    return false;
+}
 
-    std::ofstream f(path, std::ios::binary);
-    if (!f.is_open()) return;
+// Evicts columns not in the last cull's draw lists until at most
+// `targetBytes` are resident: longest out of view first, then farthest
+void ChunkManager::EvictColumns(size_t targetBytes) {
+    SLEAK_TRACE_SCOPE("EvictColumns");
+    float camX = m_hasView ? m_viewPos.x : m_lastPlayerX;
+    float camZ = m_hasView ? m_viewPos.z : m_lastPlayerZ;
+    m_evictScratch.clear();
+    for (uint32_t slot = 0; slot < m_columnMeshes.size(); ++slot) {
+        const ColumnMesh& col = m_columnMeshes[slot];
+        if ((!col.mesh && !col.waterMesh) || col.lastVisibleFrame == m_meshFrame) continue;
+        float dx = std::max({m_columnBounds.MinX()[slot] - camX, camX - m_columnBounds.MaxX()[slot], 0.0f});
+        float dz = std::max({m_columnBounds.MinZ()[slot] - camZ, camZ - m_columnBounds.MaxZ()[slot], 0.0f});
+        m_evictScratch.push_back({col.lastVisibleFrame, dx * dx + dz * dz, slot});
+    }
+    std::sort(m_evictScratch.begin(), m_evictScratch.end());
+    for (const EvictCandidate& candidate : m_evictScratch) {
+        if (m_columnMeshBytes <= targetBytes) break;
+        EvictColumn(candidate.slot);
+    }
+}
+
+// Frees the meshes but keeps the entry (and its bounds), so the cull still
+// sees the column and asks for it again once it is in view
+void ChunkManager::EvictColumn(uint32_t slot) {
+    ColumnMesh& col = m_columnMeshes[slot];
+    ReleaseColumnMeshes(col);
+    col.evicted = true;
+    col.reloadQueued = false;
+    ++m_evictedColumns;
+    m_drawListsStale = true;
+}
+
+void ChunkManager::ReloadEvictedColumn(uint32_t slot) {
+    ColumnMesh& col = m_columnMeshes[slot];
+    const ColumnKey& key = m_columnKeys[slot];
+    if (key.yBand >= 0) {
+        m_dirtyColumns.insert(key);
+        return;
+    }
+    if (col.reloadQueued || m_lodPending.find(key) != m_lodPending.end()) return;
+    col.reloadQueued = true;
+    if (col.horizon) m_horizonRequests.push_back({key.x, key.z, HORIZON_BAND - key.yBand});
+    else m_lodRequests.push_back({key.x, key.z, col.lodLevel});
+}
+
+// Steps the detail distance down after an upload found only columns in view
+void ChunkManager::ApplyBudgetDetailCap() {
+    m_budgetCapPending = false;
+    if (m_detailDistance <= MIN_BUDGET_DETAIL) return;
+    m_budgetDetailCap = std::max(MIN_BUDGET_DETAIL, m_detailDistance - BUDGET_DETAIL_STEP);
+    ApplyDetailDistance();
+}
+
+// ── Distance LOD ─────────────────────────────────────────────────────────────
+
+int ChunkManager::GetLodLevel(int dist) const {
+    return 1 + (dist > m_lodDistances[1] ? 1 : 0) + (dist > m_lodDistances[2] ? 1 : 0);
+}
+
+int ChunkManager::ChooseLodLevel(int dist, int current) const {
+    int target = GetLodLevel(dist);
+    if (current == 0 || target == current) return target;
+    if (target > current) return std::max(current, GetLodLevel(dist - LOD_HYSTERESIS));
+    return std::min(current, GetLodLevel(dist + LOD_HYSTERESIS));
+}
+
+// Drops LOD columns that left the ring, then requests the missing ones and
+// those due for another level, nearest at the back
+void ChunkManager::ScanLodColumns(int centerX, int centerZ) {
+    SLEAK_TRACE_SCOPE("LOD scan");
+    m_lodRescan = false;
+    m_lodRequests.clear();
+    for (size_t slot = m_columnKeys.size(); slot-- > 0; ) {
+        const ColumnKey& key = m_columnKeys[slot];
+        if (key.yBand != LOD_BAND) continue;
+        m_columnMeshes[slot].reloadQueued = false;      // requests were just dropped
+        if (!IsInLodRange(std::max(std::abs(key.x - centerX), std::abs(key.z - centerZ)))) {
+            ReleaseColumnMeshes(m_columnMeshes[slot]);
+            EraseColumnSlot(static_cast<uint32_t>(slot));
+        }
+    }
+    if (m_detailDistance >= m_renderDistance) return;
+
+    int inner = std::max(0, m_detailDistance - LOD_HYSTERESIS);
+    for (int x = -m_renderDistance; x <= m_renderDistance; ++x) {
+        for (int z = -m_renderDistance; z <= m_renderDistance; ++z) {
+            int dist = std::max(std::abs(x), std::abs(z));
+            if (dist < inner) continue;
+            ColumnKey key{centerX + x, LOD_BAND, centerZ + z};
+            if (m_lodPending.find(key) != m_lodPending.end()) continue;
+            const ColumnMesh* col = FindColumn(key);
+            int current = col ? col->lodLevel : 0;
+            int level = ChooseLodLevel(dist, current);
+            if (level != current) m_lodRequests.push_back({key.x, key.z, level});
+        }
+    }
+    std::sort(m_lodRequests.begin(), m_lodRequests.end(),
+        [centerX, centerZ](const LodRequest& a, const LodRequest& b) {
+            int da = (a.cx - centerX) * (a.cx - centerX) + (a.cz - centerZ) * (a.cz - centerZ);
+            int db = (b.cx - centerX) * (b.cx - centerX) + (b.cz - centerZ) * (b.cz - centerZ);
+            return da > db;
+        });
+}
+
+// Starts builds (on the workers, or a few inline when synchronous) and
+// uploads the finished ones
+void ChunkManager::UpdateLod(int centerX, int centerZ) {
+    SLEAK_TRACE_SCOPE("LOD");
+    if (m_lodRescan) {
+        ScanLodColumns(centerX, centerZ);
+        ScanHorizon(centerX, centerZ);
+    }
 
-    uint32_t count = static_cast<uint32_t>(m_columnMaxCyCache.size());
-    uint32_t seed  = m_generator.GetSeed();
+    std::vector<LodBuild*>& batch = m_lodBatch;
+    batch.clear();
+    size_t limit = m_multithreaded ? MAX_LOD_JOBS : SYNC_LOD_BUILDS;
+    while (m_lodPending.size() < limit && !m_lodRequests.empty()) {
+        LodRequest request = m_lodRequests.back();
+        m_lodRequests.pop_back();
+        LodBuild* build = AcquireLodBuild();
+        build->cx = request.cx;
+        build->cz = request.cz;
+        build->level = request.level;
+        build->horizon = false;
+        m_lodPending.emplace(ColumnKey{request.cx, LOD_BAND, request.cz}, request.level);
+        batch.push_back(build);
+    }
+    while (m_lodPending.size() < limit && !m_horizonRequests.empty()) {
+        LodRequest request = m_horizonRequests.back();
+        m_horizonRequests.pop_back();
+        ColumnKey key = HorizonKey(request.cx, request.cz, request.level);
+        auto wanted = m_horizonWanted.find(key);
+        if (wanted == m_horizonWanted.end()) continue;
+        LodBuild* build = AcquireLodBuild();
+        build->cx = request.cx;
+        build->cz = request.cz;
+        build->level = request.level;
+        build->horizon = true;
+        build->hole = wanted->second;
+        m_lodPending.emplace(key, request.level);
+        batch.push_back(build);
+    }
 
-    f.write(reinterpret_cast<const char*>(&HEIGHTMAP_MAGIC), 4);
-    f.write(reinterpret_cast<const char*>(&seed),  4);
-    f.write(reinterpret_cast<const char*>(&count), 4);
+    if (m_multithreaded) {
+        if (!batch.empty()) {
+            {
+                std::lock_guard<CountingMutex> lock(m_taskMutex);
+                // Workers pop from the back: nearest last
+                m_lodTaskQueue.insert(m_lodTaskQueue.end(), batch.rbegin(), batch.rend());
+            }
+            m_taskCV.notify_all();
+        }
+        batch.clear();
+        std::lock_guard<CountingMutex> lock(m_readyMutex);
+        while (batch.size() < LOD_UPLOADS_PER_FRAME && !m_lodReadyQueue.empty()) {
+            batch.push_back(m_lodReadyQueue.back());
+            m_lodReadyQueue.pop_back();
+        }
+    } else {
+        if (!batch.empty() && !m_lodScratch) m_lodScratch = std::make_unique<LodMesher::Scratch>();
+        for (LodBuild* build : batch)
+            BuildLodColumn(*build, *m_lodScratch);
+    }
+
+    for (LodBuild* build : batch) {
+        FinishLodBuild(*build, centerX, centerZ);
+        m_lodBuildPool.push_back(build);
+    }
+}
+
+void ChunkManager::BuildLodColumn(LodBuild& build, LodMesher::Scratch& scratch) {
+    if (build.horizon) {
+        SLEAK_TRACE_SCOPE("HorizonBuild");
+        HorizonTerrain::Build(m_generator, {build.cx, build.cz, build.level, build.hole},
+                              build.opaque, build.water);
+        m_statHorizonBuilt.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    SLEAK_TRACE_SCOPE("LodBuild");
+    LodMesher::Build(m_generator, m_savedBlockData.Empty() ? nullptr : &m_savedBlockData,
+                     build.cx, build.cz, build.level, scratch, build.opaque, build.water);
+    m_statLodBuilt.fetch_add(1, std::memory_order_relaxed);
+}
 
-    for (const auto& [packed, maxCy] : m_columnMaxCyCache) {
-        // Unpack cx/cz from the uint64 key (same packing as PackColumnXZ)
-        int32_t cx = static_cast<int32_t>(static_cast<uint32_t>(packed >> 32));
-        int32_t cz = static_cast<int32_t>(static_cast<uint32_t>(packed & 0xFFFFFFFF));
-        int32_t mc = static_cast<int32_t>(maxCy);
-        f.write(reinterpret_cast<const char*>(&cx), 4);
-        f.write(reinterpret_cast<const char*>(&cz), 4);
-        f.write(reinterpret_cast<const char*>(&mc), 4);
+// Uploads a finished build unless its column left the ring meanwhile or is
+// now due for another level (then that level is requested next)
+void ChunkManager::FinishLodBuild(LodBuild& build, int centerX, int centerZ) {
+    if (build.horizon) {
+        FinishHorizonBuild(build);
+        return;
+    }
+    ColumnKey key{build.cx, LOD_BAND, build.cz};
+    m_lodPending.erase(key);
+    int dist = std::max(std::abs(build.cx - centerX), std::abs(build.cz - centerZ));
+    if (!IsInLodRange(dist)) return;
+    const ColumnMesh* col = FindColumn(key);
+    int level = ChooseLodLevel(dist, col ? col->lodLevel : 0);
+    if (level != build.level) {
+        m_lodRequests.push_back({build.cx, build.cz, level});
+        return;
     }
+    UploadLodColumn(build);
 }
 
-void ChunkManager::LoadHeightmapCache(const std::string& path) {
-    std::ifstream f(path, std::ios::binary | std::ios::ate);
-    if (!f.is_open()) return;
+void ChunkManager::UploadLodColumn(const LodBuild& build) {
+    ColumnKey key = build.horizon ? HorizonKey(build.cx, build.cz, build.level)
+                                  : ColumnKey{build.cx, LOD_BAND, build.cz};
+    if (build.opaque.vertices.empty() && build.water.vertices.empty()) {
+        EraseColumn(key);
+        return;
+    }
+
+    // Release old GPU buffers BEFORE allocating new ones to reduce peak VRAM.
+    ColumnMesh* existing = FindColumn(key);
+    if (existing) ReleaseColumnMeshes(*existing);
+
+    // Over budget: a resident column rebuilds once in view, a new one on
+    // the next scan
+    if (!ReserveMeshBytes(MeshBytes(build.opaque) + MeshBytes(build.water))) {
+        if (existing) {
+            existing->evicted = true;
+            existing->reloadQueued = false;
+        } else {
+            m_lodRescan = true;
+        }
+        m_oomThisFrame = true;
+        return;
+    }
+
+    ColumnMesh col;
+    col.lastVisibleFrame = m_meshFrame;
+    if (build.horizon) col.horizon = true;
+    else col.lodLevel = static_cast<uint8_t>(build.level);
+    if (!build.opaque.vertices.empty()) {
+        col.mesh = m_backend->CreateMesh(build.opaque);
+        if (col.mesh) col.bytes += MeshBytes(build.opaque);
+        col.indexCount = static_cast<uint32_t>(build.opaque.indices.size());
+    }
+    if (!build.water.vertices.empty()) {
+        col.waterMesh = m_backend->CreateMesh(build.water);
+        if (col.waterMesh) col.bytes += MeshBytes(build.water);
+    }
+    if (col.mesh == 0 && col.waterMesh == 0) {
+        EraseColumn(key);
+        m_oomThisFrame = true;
+        return;
+    }
+
+    ++m_columnMeshCount;
+    m_columnMeshBytes += col.bytes;
+    m_frameUploadBytes += col.bytes;
+    if (build.horizon) {
+        ++m_horizonTileCount;
+        m_horizonTileBytes += col.bytes;
+    } else {
+        ++m_lodColumnCount;
+        m_lodColumnBytes += col.bytes;
+    }
 
-    auto fileSize = static_cast<size_t>(f.tellg());
-    if (fileSize < 12) return;
-    f.seekg(0);
+    float minY = std::numeric_limits<float>::max();
+    float maxY = -std::numeric_limits<float>::max();
+    for (const ChunkMeshData* data : {&build.opaque, &build.water})
+        for (const WorldVertex& v : data->vertices) {
+            minY = std::min(minY, v.y);
+            maxY = std::max(maxY, v.y);
+        }
 
-    uint32_t magic, seed, count;
-    f.read(reinterpret_cast<char*>(&magic), 4);
-    f.read(reinterpret_cast<char*>(&seed),  4);
-    f.read(reinterpret_cast<char*>(&count), 4);
+    ColumnMesh& inserted = InsertColumn(key);
+    inserted = col;
+    size_t slot = static_cast<size_t>(&inserted - m_columnMeshes.data());
+    int chunks = build.horizon ? HorizonTerrain::GetTileChunks(build.level) : 1;
+    float size = static_cast<float>(chunks * Chunk::SIZE);
+    float minX = build.cx * size, minZ = build.cz * size;
+    m_columnBounds.Set(slot, WorldVec3{minX, minY, minZ}, WorldVec3{minX + size, maxY, minZ + size});
+    m_drawListsStale = true;
+}
 
-    if (magic != HEIGHTMAP_MAGIC) return;
-    if (seed  != m_generator.GetSeed()) return;  // stale cache — different seed
-    if (fileSize < 12 + static_cast<size_t>(count) * 12) return;  // truncated
+// ── Horizon ──────────────────────────────────────────────────────────────────
+
+// Drops tiles that left the layout, then requests those missing or built
+// with another hole, nearest at the back
+void ChunkManager::ScanHorizon(int centerX, int centerZ) {
+    SLEAK_TRACE_SCOPE("Horizon scan");
+    m_horizonRequests.clear();
+    m_horizonWanted.clear();
+    HorizonTerrain::Layout(centerX, centerZ, m_renderDistance, m_horizonDistance, m_horizonLayout);
+    for (const HorizonTerrain::Tile& tile : m_horizonLayout)
+        m_horizonWanted.emplace(HorizonKey(tile.tx, tile.tz, tile.level), tile.hole);
+
+    for (size_t slot = m_columnKeys.size(); slot-- > 0; ) {
+        const ColumnKey& key = m_columnKeys[slot];
+        if (key.yBand > HORIZON_BAND) continue;
+        m_columnMeshes[slot].reloadQueued = false;
+        if (m_horizonWanted.find(key) != m_horizonWanted.end()) continue;
+        m_horizonResident.erase(key);
+        ReleaseColumnMeshes(m_columnMeshes[slot]);
+        EraseColumnSlot(static_cast<uint32_t>(slot));
+    }
 
-    m_columnMaxCyCache.reserve(m_columnMaxCyCache.size() + count);
-    for (uint32_t i = 0; i < count; ++i) {
-        int32_t cx, cz, maxCy;
-        f.read(reinterpret_cast<char*>(&cx),    4);
-        f.read(reinterpret_cast<char*>(&cz),    4);
-        f.read(reinterpret_cast<char*>(&maxCy), 4);
-        uint64_t key = PackColumnXZ(cx, cz);
-        m_columnMaxCyCache.emplace(key, static_cast<int>(maxCy));
+    for (const HorizonTerrain::Tile& tile : m_horizonLayout) {
+        ColumnKey key = HorizonKey(tile.tx, tile.tz, tile.level);
+        if (m_lodPending.find(key) != m_lodPending.end()) continue;
+        auto resident = m_horizonResident.find(key);
+        if (resident != m_horizonResident.end() && resident->second == tile.hole && FindColumn(key))
+            continue;
+        m_horizonRequests.push_back({tile.tx, tile.tz, tile.level});
+    }
+    std::sort(m_horizonRequests.begin(), m_horizonRequests.end(),
+        [centerX, centerZ](const LodRequest& a, const LodRequest& b) {
+            auto distSq = [centerX, centerZ](const LodRequest& r) {
+                // Tile center relative to the player's chunk, in half chunks
+                int t = HorizonTerrain::GetTileChunks(r.level);
+                int64_t dx = static_cast<int64_t>(r.cx * 2 + 1) * t - static_cast<int64_t>(centerX) * 2;
+                int64_t dz = static_cast<int64_t>(r.cz * 2 + 1) * t - static_cast<int64_t>(centerZ) * 2;
+                return dx * dx + dz * dz;
+            };
+            return distSq(a) > distSq(b);
+        });
+}
+
+// Uploads a finished tile unless it left the layout meanwhile or its hole
+// changed (then it is requested again)
+void ChunkManager::FinishHorizonBuild(LodBuild& build) {
+    ColumnKey key = HorizonKey(build.cx, build.cz, build.level);
+    m_lodPending.erase(key);
+    auto wanted = m_horizonWanted.find(key);
+    if (wanted == m_horizonWanted.end()) return;
+    if (wanted->second != build.hole) {
+        m_horizonRequests.push_back({build.cx, build.cz, build.level});
+        return;
     }
+    UploadLodColumn(build);
+    m_horizonResident[key] = build.hole;
+}
+
+ChunkManager::LodBuild* ChunkManager::AcquireLodBuild() {
+    if (m_lodBuildPool.empty()) {
+        m_lodBuilds.push_back(std::make_unique<LodBuild>());
+        return m_lodBuilds.back().get();
+    }
+    LodBuild* build = m_lodBuildPool.back();
+    m_lodBuildPool.pop_back();
+    return build;
+}
+
+// ── Column store ─────────────────────────────────────────────────────────────
+
+void ChunkManager::SetSeed(uint32_t seed) {
+    m_generator.SetSeed(seed);
+    m_columnStore.Reset(seed);
+    m_columnMaxCyCache.clear();
+}
+
+void ChunkManager::OpenColumnStore(const std::string& path) {
+    m_columnStore.Open(path, m_generator.GetSeed());
+}
+
+void ChunkManager::FlushColumnStore() {
+    m_columnStore.Flush();
 }
@@ -0,0 +1,76 @@
+#include "World/ChunkVisibility.hpp"
+#include "World/Chunk.hpp"
+
+// Faces touched by a block on each axis coordinate, as BlockFace bits
+struct BoundaryLUT {
+    uint8_t x[Chunk::SIZE] = {}, y[Chunk::SIZE] = {}, z[Chunk::SIZE] = {};
+    constexpr BoundaryLUT() {
+        constexpr int LAST = Chunk::SIZE - 1;
+        y[LAST] |= 1u << static_cast<int>(BlockFace::Top);
+        y[0]    |= 1u << static_cast<int>(BlockFace::Bottom);
+        z[LAST] |= 1u << static_cast<int>(BlockFace::North);
+        z[0]    |= 1u << static_cast<int>(BlockFace::South);
+        x[LAST] |= 1u << static_cast<int>(BlockFace::East);
+        x[0]    |= 1u << static_cast<int>(BlockFace::West);
+    }
+};
+static constexpr BoundaryLUT s_boundary;
+
+uint16_t ChunkVisibility::Compute(const uint8_t* blocks) {
+    constexpr int S = Chunk::SIZE;
+    constexpr int VOLUME = Chunk::VOLUME;
+
+    // Opaque blocks start out visited, so the fill only walks open space
+    uint64_t visited[VOLUME / 64] = {};
+    int open = 0;
+    for (int i = 0; i < VOLUME; ++i) {
+        if (IsBlockOpaque(static_cast<BlockType>(blocks[i])))
+            visited[i >> 6] |= 1ull << (i & 63);
+        else
+            ++open;
+    }
+    if (open == 0) return NONE;
+    if (open == VOLUME) return ALL;
+
+    static_assert(S == 16, "index math below assumes 16^3 chunks");
+    uint16_t stack[VOLUME];
+    uint16_t result = NONE;
+    for (unsigned start = 0; start < VOLUME && result != ALL; ++start) {
+        if (visited[start >> 6] & (1ull << (start & 63))) continue;
+        // Pockets that do not reach the boundary connect nothing
+        if (!(s_boundary.x[start & 15] | s_boundary.z[(start >> 4) & 15] | s_boundary.y[start >> 8]))
+            continue;
+
+        uint8_t faces = 0;
+        int top = 0;
+        stack[top++] = static_cast<uint16_t>(start);
+        visited[start >> 6] |= 1ull << (start & 63);
+        while (top > 0) {
+            unsigned i = stack[--top];
+            unsigned x = i & 15, z = (i >> 4) & 15, y = i >> 8;
+            faces |= s_boundary.x[x] | s_boundary.z[z] | s_boundary.y[y];
+            if (faces == 0x3F) return ALL;  // one region touching every face
+
+            auto visit = [&](unsigned n) {
+                uint64_t bit = 1ull << (n & 63);
+                if (visited[n >> 6] & bit) return;
+                visited[n >> 6] |= bit;
+                stack[top++] = static_cast<uint16_t>(n);
+            };
+            if (x > 0)     visit(i - 1);
+            if (x < S - 1) visit(i + 1);
+            if (z > 0)     visit(i - S);
+            if (z < S - 1) visit(i + S);
+            if (y > 0)     visit(i - S * S);
+            if (y < S - 1) visit(i + S * S);
+        }
+
+        for (int a = 0; a < 6; ++a) {
+            if (!(faces & (1u << a))) continue;
+            for (int b = a + 1; b < 6; ++b)
+                if (faces & (1u << b))
+                    result |= PairBit(static_cast<BlockFace>(a), static_cast<BlockFace>(b));
+        }
+    }
+    return result;
+}
@@ -0,0 +1,377 @@
+#include "World/CodecKernels.hpp"
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define KERNELS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define KERNELS_ARM64 1
+#include <arm_neon.h>
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define KERNELS_ARM_CRC 1
+#endif
+#endif
+
+// GCC/Clang compile the SIMD paths per function so the rest of the library
+// keeps the baseline ISA; MSVC accepts the intrinsics without flags.
+#if defined(_MSC_VER) && !defined(__clang__)
+#define KERNEL_TARGET(x)
+#else
+#define KERNEL_TARGET(x) __attribute__((target(x)))
+#endif
+
+// ── CPU detection ────────────────────────────────────────────────────
+
+static KernelTier DetectMaxTier() {
+#if defined(KERNELS_X86)
+    bool sse41 = false, pclmul = false, avx2 = false;
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuid(info, 0);
+    int maxLeaf = info[0];
+    __cpuid(info, 1);
+    pclmul = (info[2] & (1 << 1)) != 0;
+    sse41 = (info[2] & (1 << 19)) != 0;
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (maxLeaf >= 7 && osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+        __cpuidex(info, 7, 0);
+        avx2 = (info[1] & (1 << 5)) != 0;
+    }
+#else
+    __builtin_cpu_init();
+    sse41 = __builtin_cpu_supports("sse4.1");
+    pclmul = __builtin_cpu_supports("pclmul");
+    avx2 = __builtin_cpu_supports("avx2");
+#endif
+    if (!sse41 || !pclmul) return KernelTier::Portable;
+    return avx2 ? KernelTier::SIMD256 : KernelTier::SIMD128;
+#elif defined(KERNELS_ARM64)
+    return KernelTier::SIMD128;  // NEON is part of the AArch64 baseline
+#else
+    return KernelTier::Portable;
+#endif
+}
+
+static KernelTier MaxTier() {
+    static const KernelTier tier = DetectMaxTier();
+    return tier;
+}
+
+static std::atomic<uint8_t>& ActiveTier() {
+    static std::atomic<uint8_t> tier{static_cast<uint8_t>(MaxTier())};
+    return tier;
+}
+
+KernelTier CodecKernels::GetTier() {
+    return static_cast<KernelTier>(ActiveTier().load(std::memory_order_relaxed));
+}
+
+KernelTier CodecKernels::GetMaxTier() {
+    return MaxTier();
+}
+
+KernelTier CodecKernels::SetTier(KernelTier tier) {
+    if (tier > MaxTier()) tier = MaxTier();
+    ActiveTier().store(static_cast<uint8_t>(tier), std::memory_order_relaxed);
+    return tier;
+}
+
+const char* CodecKernels::GetTierName(KernelTier tier) {
+    switch (tier) {
+        case KernelTier::Scalar:   return "Scalar";
+        case KernelTier::Portable: return "Portable";
+#if defined(KERNELS_ARM64)
+        case KernelTier::SIMD128:  return "NEON";
+#else
+        case KernelTier::SIMD128:  return "SSE4.1+PCLMUL";
+#endif
+        case KernelTier::SIMD256:  return "AVX2";
+        default:                   return "Unknown";
+    }
+}
+
+// ── CRC32 ────────────────────────────────────────────────────────────
+// All variants work on the pre-inverted running value (crc ^ 0xFFFFFFFF).
+
+using CRCTables = std::array<std::array<uint32_t, 256>, 8>;
+
+// Table 0 is the classic byte table; table k advances a byte by k more zeros
+static const CRCTables& GetCRCTables() {
+    static const CRCTables tables = [] {
+        CRCTables t{};
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t crc = i;
+            for (int j = 0; j < 8; ++j)
+                crc = (crc >> 1) ^ (0xEDB88320 & (-(crc & 1)));
+            t[0][i] = crc;
+        }
+        for (int k = 1; k < 8; ++k) {
+            for (uint32_t i = 0; i < 256; ++i)
+                t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xFF];
+        }
+        return t;
+    }();
+    return tables;
+}
+
+static uint32_t CRCUpdateScalar(uint32_t crc, const uint8_t* data, size_t size) {
+    const auto& t = GetCRCTables()[0];
+    for (size_t i = 0; i < size; ++i)
+        crc = (crc >> 8) ^ t[(crc ^ data[i]) & 0xFF];
+    return crc;
+}
+
+static uint32_t CRCUpdateSlice8(uint32_t crc, const uint8_t* data, size_t size) {
+    const auto& t = GetCRCTables();
+    while (size >= 8) {
+        uint32_t lo = crc ^ (static_cast<uint32_t>(data[0])
+                          | (static_cast<uint32_t>(data[1]) << 8)
+                          | (static_cast<uint32_t>(data[2]) << 16)
+                          | (static_cast<uint32_t>(data[3]) << 24));
+        crc = t[7][lo & 0xFF] ^ t[6][(lo >> 8) & 0xFF]
+            ^ t[5][(lo >> 16) & 0xFF] ^ t[4][lo >> 24]
+            ^ t[3][data[4]] ^ t[2][data[5]]
+            ^ t[1][data[6]] ^ t[0][data[7]];
+        data += 8;
+        size -= 8;
+    }
+    return CRCUpdateScalar(crc, data, size);
+}
+
+#if defined(KERNELS_X86)
+// Carry-less multiply folding (Intel "Fast CRC Computation Using PCLMULQDQ").
+// Four 128-bit lanes fold 64 bytes per step, then reduce to 32 bits with
+// Barrett reduction. Requires size >= 64 and a multiple of 16.
+KERNEL_TARGET("sse4.1,pclmul")
+static uint32_t CRCFoldPCLMUL(uint32_t crc, const uint8_t* data, size_t size) {
+    alignas(16) static const uint64_t k1k2[] = {0x0154442bd4, 0x01c6e41596};
+    alignas(16) static const uint64_t k3k4[] = {0x01751997d0, 0x00ccaa009e};
+    alignas(16) static const uint64_t k5k0[] = {0x0163cd6124, 0x0000000000};
+    alignas(16) static const uint64_t poly[] = {0x01db710641, 0x01f7011641};
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+    x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00));
+    x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10));
+    x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20));
+    x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(crc)));
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k1k2));
+    data += 64;
+    size -= 64;
+
+    // Fold 4 x 128 bits in parallel
+    while (size >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+        y5 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x00));
+        y6 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x10));
+        y7 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x20));
+        y8 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 0x30));
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+        data += 64;
+        size -= 64;
+    }
+
+    // Fold the four lanes into one
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(k3k4));
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    // Remaining 16-byte blocks
+    while (size >= 16) {
+        x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+        data += 16;
+        size -= 16;
+    }
+
+    // 128 -> 64 bits
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+    x0 = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(k5k0));
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    // Barrett reduction to 32 bits
+    x0 = _mm_load_si128(reinterpret_cast<const __m128i*>(poly));
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return static_cast<uint32_t>(_mm_extract_epi32(x1, 1));
+}
+#endif
+
+#if defined(KERNELS_ARM_CRC)
+static uint32_t CRCUpdateARMv8(uint32_t crc, const uint8_t* data, size_t size) {
+    while (size >= 8) {
+        uint64_t v;
+        std::memcpy(&v, data, sizeof(v));
+        crc = __crc32d(crc, v);
+        data += 8;
+        size -= 8;
+    }
+    while (size--)
+        crc = __crc32b(crc, *data++);
+    return crc;
+}
+#endif
+
+static uint32_t CRCUpdateHardware(uint32_t crc, const uint8_t* data, size_t size) {
+#if defined(KERNELS_X86)
+    if (size >= 64) {
+        size_t bulk = size & ~static_cast<size_t>(15);
+        crc = CRCFoldPCLMUL(crc, data, bulk);
+        data += bulk;
+        size -= bulk;
+    }
+    return CRCUpdateSlice8(crc, data, size);
+#elif defined(KERNELS_ARM_CRC)
+    return CRCUpdateARMv8(crc, data, size);
+#else
+    return CRCUpdateSlice8(crc, data, size);
+#endif
+}
+
+uint32_t CodecKernels::CRC32(KernelTier tier, const uint8_t* data, size_t size) {
+    uint32_t crc = 0xFFFFFFFF;
+    switch (tier) {
+        case KernelTier::Scalar:   crc = CRCUpdateScalar(crc, data, size); break;
+        case KernelTier::Portable: crc = CRCUpdateSlice8(crc, data, size); break;
+        default:                   crc = CRCUpdateHardware(crc, data, size); break;
+    }
+    return crc ^ 0xFFFFFFFF;
+}
+
+uint32_t CodecKernels::CRC32(const uint8_t* data, size_t size) {
+    return CRC32(GetTier(), data, size);
+}
+
+// ── Run scanning ─────────────────────────────────────────────────────
+// Each variant returns the index of the first byte in [start, n) that
+// differs from `value`, or n.
+
+static size_t RunEndScalar(const uint8_t* data, size_t start, size_t n, uint8_t value) {
+    size_t i = start;
+    while (i < n && data[i] == value) ++i;
+    return i;
+}
+
+static size_t RunEndPortable(const uint8_t* data, size_t start, size_t n, uint8_t value) {
+    const uint64_t pattern = 0x0101010101010101ull * value;
+    size_t i = start;
+    for (; i + 8 <= n; i += 8) {
+        uint64_t w;
+        std::memcpy(&w, data + i, sizeof(w));
+        uint64_t diff = w ^ pattern;
+        if (diff) {
+            if constexpr (std::endian::native == std::endian::little)
+                return i + static_cast<size_t>(std::countr_zero(diff)) / 8;
+            else
+                return i + static_cast<size_t>(std::countl_zero(diff)) / 8;
+        }
+    }
+    return RunEndScalar(data, i, n, value);
+}
+
+#if defined(KERNELS_X86)
+KERNEL_TARGET("sse2")
+static size_t RunEndSSE2(const uint8_t* data, size_t start, size_t n, uint8_t value) {
+    const __m128i pattern = _mm_set1_epi8(static_cast<char>(value));
+    size_t i = start;
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        uint32_t eq = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, pattern)));
+        if (eq != 0xFFFF)
+            return i + static_cast<size_t>(std::countr_zero(~eq));
+    }
+    return RunEndScalar(data, i, n, value);
+}
+
+KERNEL_TARGET("avx2")
+static size_t RunEndAVX2(const uint8_t* data, size_t start, size_t n, uint8_t value) {
+    const __m256i pattern = _mm256_set1_epi8(static_cast<char>(value));
+    size_t i = start;
+    for (; i + 32 <= n; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        uint32_t eq = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, pattern)));
+        if (eq != 0xFFFFFFFFu)
+            return i + static_cast<size_t>(std::countr_zero(~eq));
+    }
+    return RunEndSSE2(data, i, n, value);
+}
+#endif
+
+#if defined(KERNELS_ARM64)
+static size_t RunEndNEON(const uint8_t* data, size_t start, size_t n, uint8_t value) {
+    const uint8x16_t pattern = vdupq_n_u8(value);
+    size_t i = start;
+    for (; i + 16 <= n; i += 16) {
+        uint8x16_t eq = vceqq_u8(vld1q_u8(data + i), pattern);
+        if (vminvq_u8(eq) != 0xFF) {
+            // Narrow to one nibble per byte, then find the first zero nibble
+            uint64_t mask = vget_lane_u64(vreinterpret_u64_u8(
+                vshrn_n_u16(vreinterpretq_u16_u8(eq), 4)), 0);
+            return i + static_cast<size_t>(std::countr_zero(~mask)) / 4;
+        }
+    }
+    return RunEndScalar(data, i, n, value);
+}
+#endif
+
+size_t CodecKernels::RunLength(KernelTier tier, const uint8_t* data, size_t size, size_t maxRun) {
+    size_t n = size < maxRun ? size : maxRun;
+    if (n == 0) return 0;
+    uint8_t value = data[0];
+    switch (tier) {
+        case KernelTier::Scalar:   return RunEndScalar(data, 1, n, value);
+        case KernelTier::Portable: return RunEndPortable(data, 1, n, value);
+#if defined(KERNELS_X86)
+        case KernelTier::SIMD128:  return RunEndSSE2(data, 1, n, value);
+        case KernelTier::SIMD256:  return RunEndAVX2(data, 1, n, value);
+#elif defined(KERNELS_ARM64)
+        case KernelTier::SIMD128:  return RunEndNEON(data, 1, n, value);
+#endif
+        default:                   return RunEndPortable(data, 1, n, value);
+    }
+}
+
+size_t CodecKernels::RunLength(const uint8_t* data, size_t size, size_t maxRun) {
+    return RunLength(GetTier(), data, size, maxRun);
+}
+
+bool CodecKernels::IsUniform(const uint8_t* data, size_t size) {
+    return RunLength(data, size, size) == size;
+}
@@ -0,0 +1,360 @@
+#include "World/ColumnCull.hpp"
+#include <algorithm>
+#include <bit>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CULL_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define CULL_ARM64 1
+#include <arm_neon.h>
+#endif
+
+// Same per-function ISA selection as CodecKernels.cpp
+#if defined(_MSC_VER) && !defined(__clang__)
+#define KERNEL_TARGET(x)
+#else
+#define KERNEL_TARGET(x) __attribute__((target(x)))
+#endif
+
+// ── Bounds ───────────────────────────────────────────────────────────
+
+size_t ColumnBounds::Append(const WorldVec3& min, const WorldVec3& max) {
+    size_t i = m_size;
+    Resize(m_size + 1);
+    Set(i, min, max);
+    return i;
+}
+
+void ColumnBounds::Set(size_t i, const WorldVec3& min, const WorldVec3& max) {
+    m_minX[i] = min.x; m_minY[i] = min.y; m_minZ[i] = min.z;
+    m_maxX[i] = max.x; m_maxY[i] = max.y; m_maxZ[i] = max.z;
+}
+
+void ColumnBounds::SwapRemove(size_t i) {
+    size_t last = m_size - 1;
+    if (i != last) {
+        m_minX[i] = m_minX[last]; m_minY[i] = m_minY[last]; m_minZ[i] = m_minZ[last];
+        m_maxX[i] = m_maxX[last]; m_maxY[i] = m_maxY[last]; m_maxZ[i] = m_maxZ[last];
+    }
+    Resize(last);
+}
+
+void ColumnBounds::Reserve(size_t count) {
+    size_t padded = (count + LANES - 1) / LANES * LANES;
+    for (auto* v : {&m_minX, &m_minY, &m_minZ, &m_maxX, &m_maxY, &m_maxZ})
+        v->reserve(padded);
+}
+
+void ColumnBounds::Clear() {
+    Resize(0);
+}
+
+void ColumnBounds::Resize(size_t count) {
+    size_t padded = (count + LANES - 1) / LANES * LANES;
+    for (auto* v : {&m_minX, &m_minY, &m_minZ, &m_maxX, &m_maxY, &m_maxZ})
+        v->resize(padded);
+    // Everything past the live boxes is padding (at most LANES - 1 entries)
+    for (size_t i = count; i < padded; ++i) SetEmpty(i);
+    m_size = count;
+}
+
+// At +inf the XZ distance is +inf, which fails every draw distance
+void ColumnBounds::SetEmpty(size_t i) {
+    const float inf = std::numeric_limits<float>::infinity();
+    m_minX[i] = m_minY[i] = m_minZ[i] = inf;
+    m_maxX[i] = m_maxY[i] = m_maxZ[i] = inf;
+}
+
+// ── Shared ───────────────────────────────────────────────────────────
+
+// A frustum plane with the box corner furthest along its normal picked
+// once per frame: the sign of each normal component is the same for every
+// box, so the kernels read one array per axis instead of selecting per lane.
+struct CullPlane {
+    float nx, ny, nz, d;
+    const float* x;
+    const float* y;
+    const float* z;
+};
+
+// Always six planes, so the kernels' plane loops have a fixed trip count.
+// Without a frustum every plane is 0·p + 1, which nothing fails.
+//
+// The left and right planes come first: on a render-distance square they
+// reject most columns, so a block they reject entirely skips the other four.
+static constexpr int PLANE_ORDER[6] = {2, 3, 0, 1, 4, 5};
+static constexpr int EARLY_PLANES = 2;
+
+static void SelectPlanes(const ColumnBounds& b, const ColumnCull::Params& p, CullPlane* out) {
+    for (int k = 0; k < 6; ++k) {
+        if (!p.frustum) {
+            out[k] = {0.0f, 0.0f, 0.0f, 1.0f, b.MinX(), b.MinY(), b.MinZ()};
+            continue;
+        }
+        const float* pl = p.frustum->planes[PLANE_ORDER[k]];
+        out[k] = {pl[0], pl[1], pl[2], pl[3],
+                  pl[0] >= 0.0f ? b.MaxX() : b.MinX(),
+                  pl[1] >= 0.0f ? b.MaxY() : b.MinY(),
+                  pl[2] >= 0.0f ? b.MaxZ() : b.MinZ()};
+    }
+}
+
+// Lane indices of the set bits of a 4-bit mask, in order, for branchless
+// compaction: store all four, then advance by the popcount.
+struct CompactLUT {
+    alignas(16) uint32_t lanes[16][4] = {};
+    constexpr CompactLUT() {
+        for (uint32_t m = 0; m < 16; ++m) {
+            int n = 0;
+            for (uint32_t lane = 0; lane < 4; ++lane)
+                if (m & (1u << lane)) lanes[m][n++] = lane;
+        }
+    }
+};
+static constexpr CompactLUT s_compact;
+
+// ── Scalar (reference) ───────────────────────────────────────────────
+// The SIMD tiers evaluate the same expressions in the same order, with the
+// comparisons negated the same way (NaN counts as "not rejected").
+
+static size_t CullScalar(const ColumnBounds& b, const ColumnCull::Params& p, uint32_t* out) {
+    CullPlane planes[6];
+    SelectPlanes(b, p, planes);
+    size_t n = 0;
+    for (size_t i = 0; i < b.Size(); ++i) {
+        // Horizontal-only distance (XZ cylinder)
+        float dx = std::max(std::max(b.MinX()[i] - p.camX, p.camX - b.MaxX()[i]), 0.0f);
+        float dz = std::max(std::max(b.MinZ()[i] - p.camZ, p.camZ - b.MaxZ()[i]), 0.0f);
+        float distSq = dx * dx + dz * dz;
+        if (distSq > p.drawDistSq) continue;
+
+        bool visible = true;
+        if (!(distSq <= p.forceDistSq)) {
+            for (int k = 0; k < 6 && visible; ++k) {
+                const CullPlane& pl = planes[k];
+                float dot = pl.nx * pl.x[i] + pl.ny * pl.y[i] + pl.nz * pl.z[i] + pl.d;
+                visible = !(dot < 0.0f);
+            }
+        }
+        if (visible) out[n++] = static_cast<uint32_t>(i);
+    }
+    return n;
+}
+
+// ── SSE2 (2 × 4 lanes) ───────────────────────────────────────────────
+
+#if defined(CULL_X86)
+struct PlanesSSE2 {
+    __m128 nx[6], ny[6], nz[6], d[6];
+};
+
+KERNEL_TARGET("sse2")
+static uint32_t CullMaskSSE2(const ColumnBounds& b, size_t i, const CullPlane* planes,
+                             const PlanesSSE2& v, const ColumnCull::Params& p) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 camX = _mm_set1_ps(p.camX);
+    const __m128 camZ = _mm_set1_ps(p.camZ);
+    __m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(b.MinX() + i), camX),
+                                      _mm_sub_ps(camX, _mm_loadu_ps(b.MaxX() + i))), zero);
+    __m128 dz = _mm_max_ps(_mm_max_ps(_mm_sub_ps(_mm_loadu_ps(b.MinZ() + i), camZ),
+                                      _mm_sub_ps(camZ, _mm_loadu_ps(b.MaxZ() + i))), zero);
+    __m128 distSq = _mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dz, dz));
+    __m128 inRange = _mm_cmpngt_ps(distSq, _mm_set1_ps(p.drawDistSq));
+    __m128 forced = _mm_cmple_ps(distSq, _mm_set1_ps(p.forceDistSq));
+
+    __m128 inside = _mm_cmpeq_ps(zero, zero);
+    for (int k = 0; k < 6; ++k) {
+        if (k == EARLY_PLANES &&
+            _mm_movemask_ps(_mm_and_ps(inRange, _mm_or_ps(forced, inside))) == 0)
+            return 0;
+        __m128 dot = _mm_add_ps(_mm_add_ps(_mm_add_ps(
+            _mm_mul_ps(v.nx[k], _mm_loadu_ps(planes[k].x + i)),
+            _mm_mul_ps(v.ny[k], _mm_loadu_ps(planes[k].y + i))),
+            _mm_mul_ps(v.nz[k], _mm_loadu_ps(planes[k].z + i))),
+            v.d[k]);
+        inside = _mm_and_ps(inside, _mm_cmpnlt_ps(dot, zero));
+    }
+    return static_cast<uint32_t>(_mm_movemask_ps(_mm_and_ps(inRange, _mm_or_ps(forced, inside))));
+}
+
+// Stores the indices base + lane of `mask` at out + n; returns the new n
+KERNEL_TARGET("sse2")
+static size_t CompactSSE2(uint32_t mask, size_t base, uint32_t* out, size_t n) {
+    __m128i lanes = _mm_load_si128(reinterpret_cast<const __m128i*>(s_compact.lanes[mask]));
+    __m128i idx = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(base)), lanes);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + n), idx);
+    return n + static_cast<size_t>(std::popcount(mask));
+}
+
+KERNEL_TARGET("sse2")
+static size_t CullSSE2(const ColumnBounds& b, const ColumnCull::Params& p, uint32_t* out) {
+    CullPlane planes[6];
+    SelectPlanes(b, p, planes);
+    PlanesSSE2 v;
+    for (int k = 0; k < 6; ++k) {
+        v.nx[k] = _mm_set1_ps(planes[k].nx);
+        v.ny[k] = _mm_set1_ps(planes[k].ny);
+        v.nz[k] = _mm_set1_ps(planes[k].nz);
+        v.d[k] = _mm_set1_ps(planes[k].d);
+    }
+    size_t n = 0;
+    for (size_t i = 0; i < b.PaddedSize(); i += ColumnBounds::LANES) {
+        n = CompactSSE2(CullMaskSSE2(b, i, planes, v, p), i, out, n);
+        n = CompactSSE2(CullMaskSSE2(b, i + 4, planes, v, p), i + 4, out, n);
+    }
+    return n;
+}
+
+// ── AVX2 (8 lanes) ───────────────────────────────────────────────────
+
+KERNEL_TARGET("avx2")
+static size_t CullAVX2(const ColumnBounds& b, const ColumnCull::Params& p, uint32_t* out) {
+    CullPlane planes[6];
+    SelectPlanes(b, p, planes);
+    __m256 nx[6], ny[6], nz[6], d[6];
+    for (int k = 0; k < 6; ++k) {
+        nx[k] = _mm256_set1_ps(planes[k].nx);
+        ny[k] = _mm256_set1_ps(planes[k].ny);
+        nz[k] = _mm256_set1_ps(planes[k].nz);
+        d[k] = _mm256_set1_ps(planes[k].d);
+    }
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 camX = _mm256_set1_ps(p.camX);
+    const __m256 camZ = _mm256_set1_ps(p.camZ);
+    const __m256 drawSq = _mm256_set1_ps(p.drawDistSq);
+    const __m256 forceSq = _mm256_set1_ps(p.forceDistSq);
+    size_t n = 0;
+    for (size_t i = 0; i < b.PaddedSize(); i += ColumnBounds::LANES) {
+        __m256 dx = _mm256_max_ps(_mm256_max_ps(_mm256_sub_ps(_mm256_loadu_ps(b.MinX() + i), camX),
+                                                _mm256_sub_ps(camX, _mm256_loadu_ps(b.MaxX() + i))), zero);
+        __m256 dz = _mm256_max_ps(_mm256_max_ps(_mm256_sub_ps(_mm256_loadu_ps(b.MinZ() + i), camZ),
+                                                _mm256_sub_ps(camZ, _mm256_loadu_ps(b.MaxZ() + i))), zero);
+        __m256 distSq = _mm256_add_ps(_mm256_mul_ps(dx, dx), _mm256_mul_ps(dz, dz));
+        __m256 inRange = _mm256_cmp_ps(distSq, drawSq, _CMP_NGT_UQ);
+        __m256 forced = _mm256_cmp_ps(distSq, forceSq, _CMP_LE_OQ);
+
+        __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+        bool rejected = false;
+        for (int k = 0; k < 6; ++k) {
+            if (k == EARLY_PLANES) {
+                __m256 keep = _mm256_and_ps(inRange, _mm256_or_ps(forced, inside));
+                if (_mm256_testz_ps(keep, keep)) { rejected = true; break; }
+            }
+            __m256 dot = _mm256_add_ps(_mm256_add_ps(_mm256_add_ps(
+                _mm256_mul_ps(nx[k], _mm256_loadu_ps(planes[k].x + i)),
+                _mm256_mul_ps(ny[k], _mm256_loadu_ps(planes[k].y + i))),
+                _mm256_mul_ps(nz[k], _mm256_loadu_ps(planes[k].z + i))),
+                d[k]);
+            inside = _mm256_and_ps(inside, _mm256_cmp_ps(dot, zero, _CMP_NLT_UQ));
+        }
+        if (rejected) continue;
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_ps(
+            _mm256_and_ps(inRange, _mm256_or_ps(forced, inside))));
+
+        // Compact each half through the 4-lane table
+        __m128i base = _mm_set1_epi32(static_cast<int>(i));
+        uint32_t lo = mask & 0xF, hi = mask >> 4;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + n), _mm_add_epi32(base,
+            _mm_load_si128(reinterpret_cast<const __m128i*>(s_compact.lanes[lo]))));
+        n += static_cast<size_t>(std::popcount(lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + n), _mm_add_epi32(_mm_add_epi32(base, _mm_set1_epi32(4)),
+            _mm_load_si128(reinterpret_cast<const __m128i*>(s_compact.lanes[hi]))));
+        n += static_cast<size_t>(std::popcount(hi));
+    }
+    return n;
+}
+#endif
+
+// ── NEON (2 × 4 lanes) ───────────────────────────────────────────────
+
+#if defined(CULL_ARM64)
+struct PlanesNEON {
+    float32x4_t nx[6], ny[6], nz[6], d[6];
+};
+
+static uint32_t CullMaskNEON(const ColumnBounds& b, size_t i, const CullPlane* planes,
+                             const PlanesNEON& v, const ColumnCull::Params& p) {
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t camX = vdupq_n_f32(p.camX);
+    const float32x4_t camZ = vdupq_n_f32(p.camZ);
+    float32x4_t dx = vmaxq_f32(vmaxq_f32(vsubq_f32(vld1q_f32(b.MinX() + i), camX),
+                                         vsubq_f32(camX, vld1q_f32(b.MaxX() + i))), zero);
+    float32x4_t dz = vmaxq_f32(vmaxq_f32(vsubq_f32(vld1q_f32(b.MinZ() + i), camZ),
+                                         vsubq_f32(camZ, vld1q_f32(b.MaxZ() + i))), zero);
+    float32x4_t distSq = vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dz, dz));
+    uint32x4_t inRange = vmvnq_u32(vcgtq_f32(distSq, vdupq_n_f32(p.drawDistSq)));
+    uint32x4_t forced = vcleq_f32(distSq, vdupq_n_f32(p.forceDistSq));
+
+    uint32x4_t inside = vdupq_n_u32(0xFFFFFFFFu);
+    for (int k = 0; k < 6; ++k) {
+        if (k == EARLY_PLANES && vmaxvq_u32(vandq_u32(inRange, vorrq_u32(forced, inside))) == 0)
+            return 0;
+        float32x4_t dot = vaddq_f32(vaddq_f32(vaddq_f32(
+            vmulq_f32(v.nx[k], vld1q_f32(planes[k].x + i)),
+            vmulq_f32(v.ny[k], vld1q_f32(planes[k].y + i))),
+            vmulq_f32(v.nz[k], vld1q_f32(planes[k].z + i))),
+            v.d[k]);
+        inside = vandq_u32(inside, vmvnq_u32(vcltq_f32(dot, zero)));
+    }
+    uint32x4_t visible = vandq_u32(inRange, vorrq_u32(forced, inside));
+    static const uint32_t bits[4] = {1, 2, 4, 8};
+    return vaddvq_u32(vandq_u32(visible, vld1q_u32(bits)));
+}
+
+static size_t CompactNEON(uint32_t mask, size_t base, uint32_t* out, size_t n) {
+    uint32x4_t idx = vaddq_u32(vdupq_n_u32(static_cast<uint32_t>(base)), vld1q_u32(s_compact.lanes[mask]));
+    vst1q_u32(out + n, idx);
+    return n + static_cast<size_t>(std::popcount(mask));
+}
+
+static size_t CullNEON(const ColumnBounds& b, const ColumnCull::Params& p, uint32_t* out) {
+    CullPlane planes[6];
+    SelectPlanes(b, p, planes);
+    PlanesNEON v;
+    for (int k = 0; k < 6; ++k) {
+        v.nx[k] = vdupq_n_f32(planes[k].nx);
+        v.ny[k] = vdupq_n_f32(planes[k].ny);
+        v.nz[k] = vdupq_n_f32(planes[k].nz);
+        v.d[k] = vdupq_n_f32(planes[k].d);
+    }
+    size_t n = 0;
+    for (size_t i = 0; i < b.PaddedSize(); i += ColumnBounds::LANES) {
+        n = CompactNEON(CullMaskNEON(b, i, planes, v, p), i, out, n);
+        n = CompactNEON(CullMaskNEON(b, i + 4, planes, v, p), i + 4, out, n);
+    }
+    return n;
+}
+#endif
+
+// ── Dispatch ─────────────────────────────────────────────────────────
+
+size_t ColumnCull::Cull(KernelTier tier, const ColumnBounds& bounds, const Params& params,
+                        uint32_t* out) {
+    switch (tier) {
+#if defined(CULL_X86)
+        case KernelTier::SIMD128:  return CullSSE2(bounds, params, out);
+        case KernelTier::SIMD256:  return CullAVX2(bounds, params, out);
+#elif defined(CULL_ARM64)
+        case KernelTier::SIMD128:  return CullNEON(bounds, params, out);
+#endif
+        default:                   return CullScalar(bounds, params, out);
+    }
+}
+
+size_t ColumnCull::Cull(const ColumnBounds& bounds, const Params& params, uint32_t* out) {
+    return Cull(CodecKernels::GetTier(), bounds, params, out);
+}
+
+const char* ColumnCull::GetTierName(KernelTier tier) {
+    switch (tier) {
+#if defined(CULL_X86)
+        case KernelTier::SIMD128:  return "SSE2";
+        case KernelTier::SIMD256:  return "AVX2";
+#elif defined(CULL_ARM64)
+        case KernelTier::SIMD128:  return "NEON";
+#endif
+        default:                   return "Scalar";
+    }
+}
@@ -0,0 +1,252 @@
+#include "World/ColumnStore.hpp"
+#include "World/WorldGenerator.hpp"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+ColumnStore::~ColumnStore() {
+    std::unique_lock lock(m_mutex);
+    UnmapLocked();
+}
+
+// ── Mapping ──────────────────────────────────────────────────────────
+
+bool ColumnStore::MapLocked() {
+    if (m_path.empty()) return false;
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(m_path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) return false;
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart < static_cast<LONGLONG>(sizeof(Header))) {
+        CloseHandle(file);
+        return false;
+    }
+    HANDLE map = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* view = map ? MapViewOfFile(map, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (!view) {
+        if (map) CloseHandle(map);
+        CloseHandle(file);
+        return false;
+    }
+    m_fileHandle = file;
+    m_mapHandle = map;
+    m_mapping = view;
+    m_mappedSize = static_cast<size_t>(size.QuadPart);
+#else
+    int fd = open(m_path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(Header))) {
+        close(fd);
+        return false;
+    }
+    void* view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) return false;
+    m_mapping = view;
+    m_mappedSize = static_cast<size_t>(st.st_size);
+#endif
+
+    Header header;
+    std::memcpy(&header, m_mapping, sizeof(header));
+    size_t capacity = (m_mappedSize - sizeof(Header)) / sizeof(ColumnRecord);
+    if (header.magic != MAGIC || header.version != CURRENT_VERSION ||
+        header.recordSize != sizeof(ColumnRecord) || header.seed != m_seed ||
+        header.generatorVersion != WorldGenerator::GENERATOR_VERSION ||
+        header.sortedCount > capacity) {
+        UnmapLocked();  // stale store — rewritten on the next flush
+        return false;
+    }
+
+    // A partial record at the end (interrupted append) is ignored
+    m_records = reinterpret_cast<const ColumnRecord*>(
+        static_cast<const uint8_t*>(m_mapping) + sizeof(Header));
+    m_sortedCount = header.sortedCount;
+    m_recordCount = capacity;
+    for (size_t i = m_sortedCount; i < m_recordCount; ++i)
+        m_tailIndex[m_records[i].key] = i;
+    return true;
+}
+
+void ColumnStore::UnmapLocked() {
+    if (m_mapping) {
+#ifdef _WIN32
+        UnmapViewOfFile(m_mapping);
+        CloseHandle(static_cast<HANDLE>(m_mapHandle));
+        CloseHandle(static_cast<HANDLE>(m_fileHandle));
+        m_mapHandle = nullptr;
+        m_fileHandle = nullptr;
+#else
+        munmap(m_mapping, m_mappedSize);
+#endif
+    }
+    m_mapping = nullptr;
+    m_mappedSize = 0;
+    m_records = nullptr;
+    m_sortedCount = 0;
+    m_recordCount = 0;
+    m_tailIndex.clear();
+}
+
+// ── Open / flush ─────────────────────────────────────────────────────
+
+void ColumnStore::Reset(uint32_t seed) {
+    std::unique_lock lock(m_mutex);
+    UnmapLocked();
+    m_pending.clear();
+    m_path.clear();
+    m_seed = seed;
+}
+
+bool ColumnStore::Open(const std::string& path, uint32_t seed) {
+    std::unique_lock lock(m_mutex);
+    UnmapLocked();
+    m_pending.clear();
+    m_path = path;
+    m_seed = seed;
+    return MapLocked();
+}
+
+bool ColumnStore::Flush() {
+    std::unique_lock lock(m_mutex);
+    if (m_path.empty() || m_pending.empty()) return true;
+
+    // Sort the tail back in once it outgrows 1/8 of the sorted section —
+    // keeps the in-memory tail index small
+    size_t tail = m_recordCount - m_sortedCount + m_pending.size();
+    bool partialRecord = m_mapping &&
+        (m_mappedSize - sizeof(Header)) % sizeof(ColumnRecord) != 0;
+    if (!m_mapping || partialRecord || tail > std::max<size_t>(256, m_sortedCount / 8))
+        return RewriteLocked();
+
+    UnmapLocked();
+    {
+        std::ofstream f(m_path, std::ios::binary | std::ios::app);
+        if (!f.is_open()) {
+            MapLocked();
+            return false;
+        }
+        for (const auto& [key, record] : m_pending)
+            f.write(reinterpret_cast<const char*>(&record), sizeof(record));
+        if (!f.good()) {
+            MapLocked();
+            return false;
+        }
+    }
+    m_pending.clear();
+    return MapLocked();
+}
+
+bool ColumnStore::RewriteLocked() {
+    std::vector<ColumnRecord> all;
+    all.reserve(m_recordCount + m_pending.size());
+    if (m_records)
+        all.insert(all.end(), m_records, m_records + m_recordCount);
+    for (const auto& [key, record] : m_pending)
+        all.push_back(record);
+    std::sort(all.begin(), all.end(), [](const ColumnRecord& a, const ColumnRecord& b) {
+        return a.key < b.key;
+    });
+
+    Header header{};
+    header.magic = MAGIC;
+    header.version = CURRENT_VERSION;
+    header.recordSize = sizeof(ColumnRecord);
+    header.seed = m_seed;
+    header.generatorVersion = WorldGenerator::GENERATOR_VERSION;
+    header.sortedCount = static_cast<uint32_t>(all.size());
+
+    std::string tmpPath = m_path + ".tmp";
+    {
+        std::ofstream f(tmpPath, std::ios::binary | std::ios::trunc);
+        if (!f.is_open()) return false;
+        f.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        f.write(reinterpret_cast<const char*>(all.data()),
+                static_cast<std::streamsize>(all.size() * sizeof(ColumnRecord)));
+        if (!f.good()) return false;
+    }
+
+    // Windows cannot replace a file that is still mapped
+    UnmapLocked();
+    std::error_code ec;
+    std::filesystem::rename(tmpPath, m_path, ec);
+    if (ec) {
+        MapLocked();
+        return false;
+    }
+    m_pending.clear();
+    return MapLocked();
+}
+
+// ── Lookup ───────────────────────────────────────────────────────────
+
+const ColumnRecord* ColumnStore::FindLocked(uint64_t key) const {
+    if (m_records) {
+        const ColumnRecord* begin = m_records;
+        const ColumnRecord* end = m_records + m_sortedCount;
+        const ColumnRecord* it = std::lower_bound(begin, end, key,
+            [](const ColumnRecord& r, uint64_t k) { return r.key < k; });
+        if (it != end && it->key == key) return it;
+
+        auto tailIt = m_tailIndex.find(key);
+        if (tailIt != m_tailIndex.end()) return &m_records[tailIt->second];
+    }
+    auto pendingIt = m_pending.find(key);
+    if (pendingIt != m_pending.end()) return &pendingIt->second;
+    return nullptr;
+}
+
+size_t ColumnStore::GetColumnCount() const {
+    std::shared_lock lock(m_mutex);
+    return m_recordCount + m_pending.size();
+}
+
+bool ColumnStore::Find(int cx, int cz, ColumnRecord& out) const {
+    std::shared_lock lock(m_mutex);
+    const ColumnRecord* r = FindLocked(PackKey(cx, cz));
+    if (!r) return false;
+    out = *r;
+    return true;
+}
+
+bool ColumnStore::FindMaxCy(int cx, int cz, int& maxCy) const {
+    std::shared_lock lock(m_mutex);
+    const ColumnRecord* r = FindLocked(PackKey(cx, cz));
+    if (!r) return false;
+    maxCy = r->maxCy;
+    return true;
+}
+
+bool ColumnStore::FindSurface(int worldX, int worldZ, uint8_t& height, uint8_t& biome) const {
+    // Floor division — world coords may be negative
+    int cx = worldX >> 4;
+    int cz = worldZ >> 4;
+    int idx = (worldX & 15) + (worldZ & 15) * 16;
+
+    std::shared_lock lock(m_mutex);
+    const ColumnRecord* r = FindLocked(PackKey(cx, cz));
+    if (!r) return false;
+    height = r->heights[idx];
+    biome = r->biomes[idx];
+    return true;
+}
+
+void ColumnStore::Insert(const ColumnRecord& record) {
+    std::unique_lock lock(m_mutex);
+    if (FindLocked(record.key)) return;
+    m_pending.emplace(record.key, record);
+}
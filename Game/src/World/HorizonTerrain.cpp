@@ -0,0 +1,212 @@
+#include "World/HorizonTerrain.hpp"
+#include "World/TextureAtlas.hpp"
+#include <algorithm>
+#include <cmath>
+
+static constexpr int SAMPLES = HorizonTerrain::TILE_CELLS + 3;     // corners plus a border each side
+
+static int floorDiv(int a, int b) {
+    int q = a / b;
+    if ((a % b != 0) && ((a < 0) != (b < 0))) --q;
+    return q;
+}
+
+// Top block of a column as WorldGenerator::Generate places it
+static BlockType SurfaceBlock(int height, Biome biome) {
+    switch (biome) {
+        case Biome::Desert:
+        case Biome::Beach:
+        case Biome::Ocean:
+            return BlockType::Sand;
+        case Biome::Mountains:
+            return height > 90 ? BlockType::Stone : BlockType::Grass;
+        case Biome::Plains:
+        case Biome::Forest:
+        default:
+            if (height <= WorldGenerator::SEA_LEVEL + 2 && height >= WorldGenerator::SEA_LEVEL - 2)
+                return BlockType::Sand;
+            return BlockType::Grass;
+    }
+}
+
+// Middle of a block's top texture, so the whole quad takes one texel
+static void TileCenter(BlockType type, float& u, float& v) {
+    AtlasUV uv = TextureAtlas::GetTileUV(GetBlockTextureTile(type, BlockFace::Top));
+    u = (uv.u0 + uv.u1) * 0.5f;
+    v = (uv.v0 + uv.v1) * 0.5f;
+}
+
+// Quad of corners a, b, c, d wound like LodMesher faces
+static void EmitQuad(ChunkMeshData& mesh, const float (&p)[4][3], const float (&n)[4][3],
+                     float u, float v) {
+    uint32_t base = static_cast<uint32_t>(mesh.vertices.size());
+    for (int i = 0; i < 4; ++i)
+        mesh.vertices.emplace_back(p[i][0], p[i][1], p[i][2], n[i][0], n[i][1], n[i][2], u, v);
+    const uint32_t quad[6] = {base, base + 2, base + 1, base, base + 3, base + 2};
+    mesh.indices.insert(mesh.indices.end(), quad, quad + 6);
+}
+
+int HorizonTerrain::GetLevelCount(int distance) {
+    for (int levels = 1; levels < MAX_LEVELS; ++levels)
+        if ((MIN_LEVEL0_REACH << (levels - 1)) >= distance) return levels;
+    return MAX_LEVELS;
+}
+
+bool HorizonTerrain::IsInLayout(int cx, int cz, int innerChunks, int distance,
+                                int tx, int tz, int level, Rect& hole) {
+    if (distance <= innerChunks || level < 0 || level >= GetLevelCount(distance)) return false;
+    const int t = GetTileChunks(level);
+
+    // Level area: RING_TILES tiles either side of the center on level+1's grid
+    int sx = floorDiv(cx, 2 * t) * 2, sz = floorDiv(cz, 2 * t) * 2;
+    if (tx < sx - RING_TILES || tx >= sx + RING_TILES ||
+        tz < sz - RING_TILES || tz >= sz + RING_TILES)
+        return false;
+    // ...less the level below's, which is whole tiles of this one
+    if (level > 0) {
+        int ix = floorDiv(cx, t), iz = floorDiv(cz, t);
+        if (tx >= ix - RING_TILES / 2 && tx < ix + RING_TILES / 2 &&
+            tz >= iz - RING_TILES / 2 && tz < iz + RING_TILES / 2)
+            return false;
+    }
+
+    int x0 = tx * t, x1 = x0 + t - 1;
+    int z0 = tz * t, z1 = z0 + t - 1;
+    int dx = std::max(0, std::max(x0 - cx, cx - x1));
+    int dz = std::max(0, std::max(z0 - cz, cz - z1));
+    if (std::max(dx, dz) > distance) return false;
+
+    hole.minX = std::max(x0, cx - innerChunks);
+    hole.maxX = std::min(x1, cx + innerChunks);
+    hole.minZ = std::max(z0, cz - innerChunks);
+    hole.maxZ = std::min(z1, cz + innerChunks);
+    if (hole.minX == x0 && hole.maxX == x1 && hole.minZ == z0 && hole.maxZ == z1)
+        return false;
+    return true;
+}
+
+void HorizonTerrain::Layout(int cx, int cz, int innerChunks, int distance, std::vector<Tile>& out) {
+    out.clear();
+    if (distance <= innerChunks) return;
+    const int levels = GetLevelCount(distance);
+    for (int level = 0; level < levels; ++level) {
+        const int t = GetTileChunks(level);
+        int sx = floorDiv(cx, 2 * t) * 2, sz = floorDiv(cz, 2 * t) * 2;
+        for (int tz = sz - RING_TILES; tz < sz + RING_TILES; ++tz)
+            for (int tx = sx - RING_TILES; tx < sx + RING_TILES; ++tx) {
+                Tile tile{tx, tz, level, {}};
+                if (IsInLayout(cx, cz, innerChunks, distance, tx, tz, level, tile.hole))
+                    out.push_back(tile);
+            }
+    }
+}
+
+void HorizonTerrain::Build(const WorldGenerator& generator, const Tile& tile,
+                           ChunkMeshData& land, ChunkMeshData& water) {
+    land.vertices.clear();
+    land.indices.clear();
+    water.vertices.clear();
+    water.indices.clear();
+
+    const int cellChunks = 1 << tile.level;
+    const int cellBlocks = Chunk::SIZE * cellChunks;
+    const int chunkX = tile.tx * GetTileChunks(tile.level);
+    const int chunkZ = tile.tz * GetTileChunks(tile.level);
+    const int blockX = chunkX * Chunk::SIZE;
+    const int blockZ = chunkZ * Chunk::SIZE;
+
+    // Surface height and biome at every cell corner, plus a border ring for
+    // the normals; sample (i, k) is corner (i - 1, k - 1)
+    int heights[SAMPLES * SAMPLES];
+    Biome biomes[SAMPLES * SAMPLES];
+    for (int k = 0; k < SAMPLES; ++k)
+        for (int i = 0; i < SAMPLES; ++i) {
+            ColumnInfo info = generator.SampleColumn(blockX + (i - 1) * cellBlocks,
+                                                     blockZ + (k - 1) * cellBlocks);
+            heights[i + k * SAMPLES] = info.surfaceHeight;
+            biomes[i + k * SAMPLES] = info.biome;
+        }
+    auto heightAt = [&](int i, int k) { return heights[(i + 1) + (k + 1) * SAMPLES]; };
+
+    // Cells drawn: all but those wholly inside the hole
+    bool drawn[TILE_CELLS * TILE_CELLS];
+    for (int k = 0; k < TILE_CELLS; ++k)
+        for (int i = 0; i < TILE_CELLS; ++i) {
+            int x0 = chunkX + i * cellChunks, z0 = chunkZ + k * cellChunks;
+            int x1 = x0 + cellChunks - 1, z1 = z0 + cellChunks - 1;
+            bool inHole = !tile.hole.IsEmpty() &&
+                          x0 >= tile.hole.minX && x1 <= tile.hole.maxX &&
+                          z0 >= tile.hole.minZ && z1 <= tile.hole.maxZ;
+            drawn[i + k * TILE_CELLS] = !inHole;
+        }
+    auto isDrawn = [&](int i, int k) {
+        return i >= 0 && i < TILE_CELLS && k >= 0 && k < TILE_CELLS && drawn[i + k * TILE_CELLS];
+    };
+
+    // Corner positions (top of the surface block) and smoothed normals
+    float pos[TILE_CELLS + 1][TILE_CELLS + 1][3];
+    float nrm[TILE_CELLS + 1][TILE_CELLS + 1][3];
+    const float step = static_cast<float>(cellBlocks);
+    for (int k = 0; k <= TILE_CELLS; ++k)
+        for (int i = 0; i <= TILE_CELLS; ++i) {
+            pos[k][i][0] = static_cast<float>(blockX + i * cellBlocks);
+            pos[k][i][1] = static_cast<float>(heightAt(i, k) + 1);
+            pos[k][i][2] = static_cast<float>(blockZ + k * cellBlocks);
+            float sx = static_cast<float>(heightAt(i + 1, k) - heightAt(i - 1, k)) / (2.0f * step);
+            float sz = static_cast<float>(heightAt(i, k + 1) - heightAt(i, k - 1)) / (2.0f * step);
+            float inv = 1.0f / std::sqrt(sx * sx + 1.0f + sz * sz);
+            nrm[k][i][0] = -sx * inv;
+            nrm[k][i][1] = inv;
+            nrm[k][i][2] = -sz * inv;
+        }
+
+    float waterU, waterV;
+    TileCenter(BlockType::Water, waterU, waterV);
+    const float waterY = static_cast<float>(WorldGenerator::SEA_LEVEL) + 0.875f;
+    const float skirt = step;
+
+    for (int k = 0; k < TILE_CELLS; ++k)
+        for (int i = 0; i < TILE_CELLS; ++i) {
+            if (!drawn[i + k * TILE_CELLS]) continue;
+            int h = heightAt(i, k);
+            float u, v;
+            TileCenter(SurfaceBlock(h, biomes[(i + 1) + (k + 1) * SAMPLES]), u, v);
+
+            // Top, corners as FACES[Top]: (0,0) (0,1) (1,1) (1,0)
+            const float (&a)[3] = pos[k][i];
+            const float (&b)[3] = pos[k + 1][i];
+            const float (&c)[3] = pos[k + 1][i + 1];
+            const float (&d)[3] = pos[k][i + 1];
+            const float top[4][3] = {{a[0], a[1], a[2]}, {b[0], b[1], b[2]},
+                                     {c[0], c[1], c[2]}, {d[0], d[1], d[2]}};
+            const float topN[4][3] = {
+                {nrm[k][i][0], nrm[k][i][1], nrm[k][i][2]},
+                {nrm[k + 1][i][0], nrm[k + 1][i][1], nrm[k + 1][i][2]},
+                {nrm[k + 1][i + 1][0], nrm[k + 1][i + 1][1], nrm[k + 1][i + 1][2]},
+                {nrm[k][i + 1][0], nrm[k][i + 1][1], nrm[k][i + 1][2]}};
+            EmitQuad(land, top, topN, u, v);
+
+            // Skirts on edges without a drawn neighbor, wound like the side
+            // faces: bottom and top of the far corner, then of the near one
+            auto emitSkirt = [&](const float (&p)[3], const float (&q)[3], float nx, float nz) {
+                const float quad[4][3] = {{p[0], p[1] - skirt, p[2]}, {p[0], p[1], p[2]},
+                                          {q[0], q[1], q[2]}, {q[0], q[1] - skirt, q[2]}};
+                const float n[4][3] = {{nx, 0, nz}, {nx, 0, nz}, {nx, 0, nz}, {nx, 0, nz}};
+                EmitQuad(land, quad, n, u, v);
+            };
+            if (!isDrawn(i, k + 1)) emitSkirt(c, b, 0, 1);      // North
+            if (!isDrawn(i, k - 1)) emitSkirt(a, d, 0, -1);     // South
+            if (!isDrawn(i + 1, k)) emitSkirt(d, c, 1, 0);      // East
+            if (!isDrawn(i - 1, k)) emitSkirt(b, a, -1, 0);     // West
+
+            bool wet = h < WorldGenerator::SEA_LEVEL || heightAt(i + 1, k) < WorldGenerator::SEA_LEVEL ||
+                       heightAt(i, k + 1) < WorldGenerator::SEA_LEVEL ||
+                       heightAt(i + 1, k + 1) < WorldGenerator::SEA_LEVEL;
+            if (wet) {
+                const float surface[4][3] = {{a[0], waterY, a[2]}, {b[0], waterY, b[2]},
+                                             {c[0], waterY, c[2]}, {d[0], waterY, d[2]}};
+                const float up[4][3] = {{0, 1, 0}, {0, 1, 0}, {0, 1, 0}, {0, 1, 0}};
+                EmitQuad(water, surface, up, waterU, waterV);
+            }
+        }
+}
@@ -0,0 +1,193 @@
+#include "World/LodMesher.hpp"
+#include "World/ChunkKey.hpp"
+#include "World/TextureAtlas.hpp"
+#include <algorithm>
+#include <cstring>
+
+static constexpr int COLUMN_HEIGHT = (WorldGenerator::MAX_CHUNK_Y + 1) * Chunk::SIZE;
+static constexpr int MAX_CELLS = Chunk::SIZE / 2;      // cells across at level 1
+
+// Unit-cube corners of each BlockFace quad (BlockFace order), wound like
+// Chunk meshing; texture corners are (u0,v1) (u0,v0) (u1,v0) (u1,v1)
+struct FaceCorners {
+    float x[4], y[4], z[4];
+    float nx, ny, nz;
+};
+static constexpr FaceCorners FACES[6] = {
+    {{0, 0, 1, 1}, {1, 1, 1, 1}, {0, 1, 1, 0},  0,  1,  0},    // Top
+    {{0, 0, 1, 1}, {0, 0, 0, 0}, {1, 0, 0, 1},  0, -1,  0},    // Bottom
+    {{1, 1, 0, 0}, {0, 1, 1, 0}, {1, 1, 1, 1},  0,  0,  1},    // North
+    {{0, 0, 1, 1}, {0, 1, 1, 0}, {0, 0, 0, 0},  0,  0, -1},    // South
+    {{1, 1, 1, 1}, {0, 1, 1, 0}, {0, 0, 1, 1},  1,  0,  0},    // East
+    {{0, 0, 0, 0}, {0, 1, 1, 0}, {1, 1, 0, 0}, -1,  0,  0},    // West
+};
+
+// Neighbor column step of the horizontal faces (North, South, East, West)
+static constexpr int SIDE_STEP[4][2] = {{0, 1}, {0, -1}, {1, 0}, {-1, 0}};
+
+// One face of the cube of edge `size` at (x, y, z)
+static void EmitFace(ChunkMeshData& mesh, BlockFace face, float x, float y, float z,
+                     float size, BlockType type) {
+    const FaceCorners& c = FACES[static_cast<int>(face)];
+    AtlasUV uv = TextureAtlas::GetTileUV(GetBlockTextureTile(type, face));
+    const float us[4] = {uv.u0, uv.u0, uv.u1, uv.u1};
+    const float vs[4] = {uv.v1, uv.v0, uv.v0, uv.v1};
+    uint32_t base = static_cast<uint32_t>(mesh.vertices.size());
+    for (int i = 0; i < 4; ++i)
+        mesh.vertices.emplace_back(x + c.x[i] * size, y + c.y[i] * size, z + c.z[i] * size,
+                                   c.nx, c.ny, c.nz, us[i], vs[i]);
+    const uint32_t quad[6] = {base, base + 2, base + 1, base, base + 3, base + 2};
+    mesh.indices.insert(mesh.indices.end(), quad, quad + 6);
+}
+
+void LodMesher::Build(const WorldGenerator& generator, const SavedChunkMap* saved,
+                      int cx, int cz, int level, Scratch& scratch,
+                      ChunkMeshData& opaque, ChunkMeshData& water) {
+    opaque.vertices.clear();
+    opaque.indices.clear();
+    water.vertices.clear();
+    water.indices.clear();
+
+    const int f = GetScale(level);
+    const int n = Chunk::SIZE / f;
+    const int ny = COLUMN_HEIGHT / f;
+    const int layer = n * n;
+    const int cellCount = layer * ny;
+
+    // Lowest surface block under each cell's footprint
+    ColumnRecord& column = scratch.column;
+    generator.GetColumn(cx, cz, column);
+    int footMin[MAX_CELLS * MAX_CELLS];
+    for (int k = 0; k < n; ++k)
+        for (int i = 0; i < n; ++i) {
+            int m = 255;
+            for (int b = 0; b < f; ++b)
+                for (int a = 0; a < f; ++a)
+                    m = std::min(m, static_cast<int>(column.heights[(i * f + a) + (k * f + b) * Chunk::SIZE]));
+            footMin[i + k * n] = m;
+        }
+
+    // Lowest surface block of each neighbor next to each edge cell
+    int edgeMin[4][MAX_CELLS];
+    for (int s = 0; s < 4; ++s) {
+        generator.GetColumn(cx + SIDE_STEP[s][0], cz + SIDE_STEP[s][1], scratch.neighbor);
+        for (int c = 0; c < n; ++c) {
+            int m = 255;
+            for (int a = 0; a < f; ++a) {
+                int along = c * f + a, x, z;
+                switch (s) {
+                    case 0:  x = along; z = 0; break;                   // North: its south edge
+                    case 1:  x = along; z = Chunk::SIZE - 1; break;     // South: its north edge
+                    case 2:  x = 0; z = along; break;                   // East: its west edge
+                    default: x = Chunk::SIZE - 1; z = along; break;     // West: its east edge
+                }
+                m = std::min(m, static_cast<int>(scratch.neighbor.heights[x + z * Chunk::SIZE]));
+            }
+            edgeMin[s][c] = m;
+        }
+    }
+
+    // Cell j of a footprint is forced solid while (j + 1) * f <= footMin + 1 - f
+    auto firstOpenCell = [f](int surface) { return std::max(0, (surface + 1) / f - 1); };
+    int lowY = COLUMN_HEIGHT;
+    for (int c = 0; c < layer; ++c) lowY = std::min(lowY, firstOpenCell(footMin[c]) * f);
+    int lowCy = lowY / Chunk::SIZE;
+    int maxCy = std::min(static_cast<int>(column.maxCy), WorldGenerator::MAX_CHUNK_Y);
+
+    // Count solid and water blocks per cell; `cells` holds the highest solid
+    // type so far (blocks are visited bottom up)
+    std::vector<uint8_t>& cells = scratch.cells;
+    std::vector<uint8_t>& waterTop = scratch.waterTop;
+    std::vector<uint16_t>& counts = scratch.counts;     // solid, water per cell
+    cells.assign(cellCount, static_cast<uint8_t>(BlockType::Air));
+    waterTop.assign(cellCount, 0);
+    counts.assign(cellCount * 2, 0);
+
+    Chunk& chunk = scratch.chunk;
+    for (int cy = lowCy; cy <= maxCy; ++cy) {
+        chunk.Reset(cx, cy, cz);
+        const SavedChunkMap::Blocks* blocks = saved ? saved->Find(ChunkKey::Pack(cx, cy, cz)) : nullptr;
+        if (blocks)
+            std::memcpy(const_cast<uint8_t*>(chunk.GetBlockData()), blocks->data(), blocks->size());
+        else
+            generator.Generate(&chunk);
+
+        const uint8_t* data = chunk.GetBlockData();
+        for (int y = 0; y < Chunk::SIZE; ++y) {
+            int wy = cy * Chunk::SIZE + y;
+            int rowBase = (wy / f) * layer;
+            for (int z = 0; z < Chunk::SIZE; ++z) {
+                int cellRow = rowBase + (z / f) * n;
+                const uint8_t* line = data + z * Chunk::SIZE + y * Chunk::SIZE * Chunk::SIZE;
+                for (int x = 0; x < Chunk::SIZE; ++x) {
+                    BlockType type = static_cast<BlockType>(line[x]);
+                    if (type == BlockType::Air) continue;
+                    int cell = cellRow + x / f;
+                    if (IsBlockSolid(type)) {
+                        ++counts[cell * 2];
+                        cells[cell] = static_cast<uint8_t>(type);
+                    } else {
+                        ++counts[cell * 2 + 1];
+                        waterTop[cell] = static_cast<uint8_t>(wy % f);
+                    }
+                }
+            }
+        }
+    }
+
+    const int volume = f * f * f;
+    for (int j = 0; j < ny; ++j)
+        for (int c = 0; c < layer; ++c) {
+            int cell = c + j * layer;
+            int solid = counts[cell * 2], wet = counts[cell * 2 + 1];
+            if (solid * 2 >= volume) continue;      // keeps its highest solid type
+            if (j < firstOpenCell(footMin[c])) {
+                if (solid == 0) cells[cell] = static_cast<uint8_t>(BlockType::Stone);
+            } else if (wet > volume - solid - wet) {
+                cells[cell] = static_cast<uint8_t>(BlockType::Water);
+            } else {
+                cells[cell] = static_cast<uint8_t>(BlockType::Air);
+            }
+        }
+
+    auto solidAt = [&](int i, int j, int k) {
+        return IsBlockSolid(static_cast<BlockType>(cells[i + k * n + j * layer]));
+    };
+    // Outside the column: solid up to SKIRT_DEPTH below the neighbor's edge
+    auto outsideSolid = [&](int side, int along, int j) {
+        return (j + 1) * f <= edgeMin[side][along] + 1 - SKIRT_DEPTH;
+    };
+
+    const float size = static_cast<float>(f);
+    for (int j = 0; j < ny; ++j)
+        for (int k = 0; k < n; ++k)
+            for (int i = 0; i < n; ++i) {
+                BlockType type = static_cast<BlockType>(cells[i + k * n + j * layer]);
+                if (type == BlockType::Air) continue;
+                float x = static_cast<float>(cx * Chunk::SIZE + i * f);
+                float y = static_cast<float>(j * f);
+                float z = static_cast<float>(cz * Chunk::SIZE + k * f);
+
+                if (type == BlockType::Water) {
+                    // Surface only, at the highest water block's lowered top
+                    bool airAbove = j + 1 >= ny ||
+                        static_cast<BlockType>(cells[i + k * n + (j + 1) * layer]) == BlockType::Air;
+                    if (airAbove) {
+                        float top = y + static_cast<float>(waterTop[i + k * n + j * layer]) + 0.875f;
+                        EmitFace(water, BlockFace::Top, x, top - size, z, size, type);
+                    }
+                    continue;
+                }
+
+                bool open[6];
+                open[0] = j + 1 >= ny || !solidAt(i, j + 1, k);
+                open[1] = j > 0 && !solidAt(i, j - 1, k);
+                open[2] = (k + 1 < n) ? !solidAt(i, j, k + 1) : !outsideSolid(0, i, j);
+                open[3] = (k > 0)     ? !solidAt(i, j, k - 1) : !outsideSolid(1, i, j);
+                open[4] = (i + 1 < n) ? !solidAt(i + 1, j, k) : !outsideSolid(2, k, j);
+                open[5] = (i > 0)     ? !solidAt(i - 1, j, k) : !outsideSolid(3, k, j);
+                for (int face = 0; face < 6; ++face)
+                    if (open[face])
+                        EmitFace(opaque, static_cast<BlockFace>(face), x, y, z, size, type);
+            }
+}
@@ -0,0 +1,57 @@
+#include "World/MeshBatchRenderBackend.hpp"
+#include <Runtime/Material.hpp>
+
+ChunkMeshId MeshBatchRenderBackend::CreateMesh(const ChunkMeshData& data) {
+    Sleak::VoxelVertexGroup vertices;
+    Sleak::IndexGroup indices;
+    for (const WorldVertex& w : data.vertices) {
+        Sleak::VoxelVertex v(w.x, w.y, w.z, w.nx, w.ny, w.nz, w.u, w.v);
+        v.SetColor(w.r, w.g, w.b, w.a);
+        vertices.AddVertex(v);
+    }
+    for (uint32_t i : data.indices)
+        indices.add(i);
+
+    Sleak::MeshHandle handle = Sleak::MeshBatch::CreateVoxelMesh(vertices, indices);
+    if (!handle.IsValid()) return 0;
+
+    ChunkMeshId id;
+    if (!m_freeIds.empty()) {
+        id = m_freeIds.back();
+        m_freeIds.pop_back();
+        m_meshes[id - 1] = std::move(handle);
+    } else {
+        m_meshes.push_back(std::move(handle));
+        id = static_cast<ChunkMeshId>(m_meshes.size());
+    }
+    return id;
+}
+
+void MeshBatchRenderBackend::DestroyMesh(ChunkMeshId id) {
+    if (id == 0 || id > m_meshes.size()) return;
+    // MeshHandle releases its GPU buffers via RefPtr
+    m_meshes[id - 1] = {};
+    m_freeIds.push_back(id);
+}
+
+void MeshBatchRenderBackend::BeginPass(ChunkRenderPass pass) {
+    Sleak::Material* material = m_material.get();
+    if (pass == ChunkRenderPass::Water) material = m_waterMaterial.get();
+    else if (pass == ChunkRenderPass::ShadowCaster) material = m_casterMaterial.get();
+    m_passActive = material != nullptr;
+    if (m_passActive)
+        Sleak::MeshBatch::BeginBatch(material);
+}
+
+void MeshBatchRenderBackend::Draw(ChunkMeshId id) {
+    if (!m_passActive || id == 0 || id > m_meshes.size()) return;
+    const Sleak::MeshHandle& handle = m_meshes[id - 1];
+    if (handle.IsValid())
+        Sleak::MeshBatch::Draw(handle);
+}
+
+void MeshBatchRenderBackend::EndPass() {
+    if (m_passActive)
+        Sleak::MeshBatch::EndBatch();
+    m_passActive = false;
+}
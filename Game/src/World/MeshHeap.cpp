@@ -0,0 +1,352 @@
+#include "World/MeshHeap.hpp"
+#include <algorithm>
+#include <bit>
+
+// ── MeshHeap ──
+
+void MeshHeap::Reset(uint32_t capacity) {
+    m_blocks.clear();
+    m_spareBlocks.clear();
+    m_handles.clear();
+    m_spareHandles.clear();
+    for (int fl = 0; fl < FL_COUNT; ++fl) {
+        m_slBitmap[fl] = 0;
+        for (int sl = 0; sl < SL_COUNT; ++sl) m_bins[fl][sl] = INVALID;
+    }
+    m_flBitmap = 0;
+    m_first = m_last = INVALID;
+    m_capacity = capacity;
+    m_used = 0;
+    m_allocations = 0;
+    m_freeBlocks = 0;
+    if (capacity == 0) return;
+
+    uint32_t block = NewBlock();
+    m_blocks[block].size = capacity;
+    m_first = m_last = block;
+    InsertFree(block);
+}
+
+// Bin of a free block of `size` elements: sizes under SL_COUNT get a bin
+// each, larger ones the SL_COUNT-way split of their power of two
+void MeshHeap::Mapping(uint32_t size, int& fl, int& sl) {
+    if (size < SL_COUNT) {
+        fl = 0;
+        sl = static_cast<int>(size);
+        return;
+    }
+    int msb = std::bit_width(size) - 1;
+    fl = msb - SL_LOG2 + 1;
+    sl = static_cast<int>(size >> (msb - SL_LOG2)) - SL_COUNT;
+}
+
+uint32_t MeshHeap::FindFree(uint32_t size) const {
+    // Round up to the next bin start so every block found is big enough
+    uint64_t rounded = size;
+    if (size >= SL_COUNT) {
+        int msb = std::bit_width(size) - 1;
+        rounded += (uint64_t(1) << (msb - SL_LOG2)) - 1;
+        if (rounded > UINT32_MAX) return INVALID;
+    }
+    int fl, sl;
+    Mapping(static_cast<uint32_t>(rounded), fl, sl);
+
+    uint32_t slMap = m_slBitmap[fl] & (~0u << sl);
+    if (slMap == 0) {
+        uint32_t flMap = (fl + 1 < 32) ? (m_flBitmap & (~0u << (fl + 1))) : 0;
+        if (flMap == 0) return INVALID;
+        fl = std::countr_zero(flMap);
+        slMap = m_slBitmap[fl];
+    }
+    return m_bins[fl][std::countr_zero(slMap)];
+}
+
+void MeshHeap::InsertFree(uint32_t block) {
+    Block& b = m_blocks[block];
+    int fl, sl;
+    Mapping(b.size, fl, sl);
+    b.handle = INVALID;
+    b.prevFree = INVALID;
+    b.nextFree = m_bins[fl][sl];
+    if (b.nextFree != INVALID) m_blocks[b.nextFree].prevFree = block;
+    m_bins[fl][sl] = block;
+    m_slBitmap[fl] |= 1u << sl;
+    m_flBitmap |= 1u << fl;
+    ++m_freeBlocks;
+}
+
+void MeshHeap::RemoveFree(uint32_t block) {
+    Block& b = m_blocks[block];
+    int fl, sl;
+    Mapping(b.size, fl, sl);
+    if (b.prevFree != INVALID) m_blocks[b.prevFree].nextFree = b.nextFree;
+    else m_bins[fl][sl] = b.nextFree;
+    if (b.nextFree != INVALID) m_blocks[b.nextFree].prevFree = b.prevFree;
+    if (m_bins[fl][sl] == INVALID) {
+        m_slBitmap[fl] &= ~(1u << sl);
+        if (m_slBitmap[fl] == 0) m_flBitmap &= ~(1u << fl);
+    }
+    b.prevFree = b.nextFree = INVALID;
+    --m_freeBlocks;
+}
+
+void MeshHeap::Split(uint32_t block, uint32_t size) {
+    uint32_t rest = m_blocks[block].size - size;
+    if (rest == 0) return;
+    uint32_t tail = NewBlock();        // may grow m_blocks: index, don't hold references
+    Block& b = m_blocks[block];
+    Block& t = m_blocks[tail];
+    t.offset = b.offset + size;
+    t.size = rest;
+    t.prevPhys = block;
+    t.nextPhys = b.nextPhys;
+    if (b.nextPhys != INVALID) m_blocks[b.nextPhys].prevPhys = tail;
+    else m_last = tail;
+    b.nextPhys = tail;
+    b.size = size;
+    InsertFree(tail);
+}
+
+void MeshHeap::Release(uint32_t block) {
+    uint32_t prev = m_blocks[block].prevPhys;
+    if (prev != INVALID && m_blocks[prev].handle == INVALID) {
+        RemoveFree(prev);
+        Block& b = m_blocks[block];
+        b.offset = m_blocks[prev].offset;
+        b.size += m_blocks[prev].size;
+        b.prevPhys = m_blocks[prev].prevPhys;
+        if (b.prevPhys != INVALID) m_blocks[b.prevPhys].nextPhys = block;
+        else m_first = block;
+        m_spareBlocks.push_back(prev);
+    }
+    uint32_t next = m_blocks[block].nextPhys;
+    if (next != INVALID && m_blocks[next].handle == INVALID) {
+        RemoveFree(next);
+        Block& b = m_blocks[block];
+        b.size += m_blocks[next].size;
+        b.nextPhys = m_blocks[next].nextPhys;
+        if (b.nextPhys != INVALID) m_blocks[b.nextPhys].prevPhys = block;
+        else m_last = block;
+        m_spareBlocks.push_back(next);
+    }
+    InsertFree(block);
+}
+
+uint32_t MeshHeap::NewBlock() {
+    uint32_t block;
+    if (!m_spareBlocks.empty()) {
+        block = m_spareBlocks.back();
+        m_spareBlocks.pop_back();
+        m_blocks[block] = Block{};
+    } else {
+        block = static_cast<uint32_t>(m_blocks.size());
+        m_blocks.emplace_back();
+        // Any block can end up spare; sized with the table, Free never allocates
+        m_spareBlocks.reserve(m_blocks.capacity());
+    }
+    return block;
+}
+
+uint32_t MeshHeap::NewHandle(uint32_t block) {
+    uint32_t handle;
+    if (!m_spareHandles.empty()) {
+        handle = m_spareHandles.back();
+        m_spareHandles.pop_back();
+        m_handles[handle] = block;
+    } else {
+        handle = static_cast<uint32_t>(m_handles.size());
+        m_handles.push_back(block);
+        m_spareHandles.reserve(m_handles.capacity());
+    }
+    m_blocks[block].handle = handle;
+    return handle;
+}
+
+uint32_t MeshHeap::Allocate(uint32_t size) {
+    if (size == 0) return INVALID;
+    uint32_t block = FindFree(size);
+    if (block == INVALID) return INVALID;
+    RemoveFree(block);
+    Split(block, size);
+    m_used += size;
+    ++m_allocations;
+    return NewHandle(block);
+}
+
+void MeshHeap::Free(uint32_t handle) {
+    if (handle == INVALID || handle >= m_handles.size()) return;
+    uint32_t block = m_handles[handle];
+    if (block == INVALID) return;
+    m_used -= m_blocks[block].size;
+    --m_allocations;
+    m_handles[handle] = INVALID;
+    m_spareHandles.push_back(handle);
+    Release(block);
+}
+
+bool MeshHeap::Compact(Move& move) {
+    uint32_t top = m_last;
+    if (top != INVALID && m_blocks[top].handle == INVALID) top = m_blocks[top].prevPhys;
+    if (top == INVALID) return false;
+
+    const uint32_t size = m_blocks[top].size;
+    const uint32_t limit = m_blocks[top].offset;
+    uint32_t dest = FindFree(size);
+    if (dest == INVALID || m_blocks[dest].offset > limit) {
+        // Allocate skips the request's own bin, whose blocks may be smaller;
+        // look through a few of them for one that fits below
+        int fl, sl;
+        Mapping(size, fl, sl);
+        dest = m_bins[fl][sl];
+        for (int i = 0; i < COMPACT_SCAN && dest != INVALID; ++i, dest = m_blocks[dest].nextFree)
+            if (m_blocks[dest].size >= size && m_blocks[dest].offset < limit) break;
+        if (dest == INVALID || m_blocks[dest].size < size || m_blocks[dest].offset > limit) return false;
+    }
+
+    RemoveFree(dest);
+    Split(dest, size);
+    const uint32_t handle = m_blocks[top].handle;
+    move = {handle, m_blocks[top].offset, m_blocks[dest].offset, size};
+    m_handles[handle] = dest;
+    m_blocks[dest].handle = handle;
+    Release(top);
+    return true;
+}
+
+uint32_t MeshHeap::GetTailFree() const {
+    if (m_last == INVALID || m_blocks[m_last].handle != INVALID) return 0;
+    return m_blocks[m_last].size;
+}
+
+bool MeshHeap::Validate() const {
+    uint32_t offset = 0, used = 0, allocations = 0, freeBlocks = 0;
+    uint32_t prev = INVALID;
+    bool prevFree = false;
+    for (uint32_t block = m_first; block != INVALID; block = m_blocks[block].nextPhys) {
+        const Block& b = m_blocks[block];
+        if (b.offset != offset || b.size == 0 || b.prevPhys != prev) return false;
+        bool isFree = b.handle == INVALID;
+        if (isFree) {
+            if (prevFree) return false;         // should have merged
+            int fl, sl;
+            Mapping(b.size, fl, sl);
+            bool binned = false;
+            for (uint32_t f = m_bins[fl][sl]; f != INVALID; f = m_blocks[f].nextFree)
+                if (f == block) { binned = true; break; }
+            if (!binned) return false;
+            ++freeBlocks;
+        } else {
+            if (b.handle >= m_handles.size() || m_handles[b.handle] != block) return false;
+            used += b.size;
+            ++allocations;
+        }
+        prevFree = isFree;
+        offset += b.size;
+        prev = block;
+    }
+    if (prev != m_last || offset != m_capacity) return false;
+    if (used != m_used || allocations != m_allocations || freeBlocks != m_freeBlocks) return false;
+
+    uint32_t binned = 0;
+    for (int fl = 0; fl < FL_COUNT; ++fl) {
+        if (((m_flBitmap >> fl) & 1u) != (m_slBitmap[fl] != 0 ? 1u : 0u)) return false;
+        for (int sl = 0; sl < SL_COUNT; ++sl) {
+            if (((m_slBitmap[fl] >> sl) & 1u) != (m_bins[fl][sl] != INVALID ? 1u : 0u)) return false;
+            for (uint32_t f = m_bins[fl][sl]; f != INVALID; f = m_blocks[f].nextFree) ++binned;
+        }
+    }
+    return binned == m_freeBlocks;
+}
+
+// ── MeshArena ──
+
+bool MeshArena::TryPage(uint32_t page, uint32_t vertexCount, uint32_t indexCount, Allocation& out) {
+    Page& p = m_pages[page];
+    uint32_t vertices = MeshHeap::INVALID, indices = MeshHeap::INVALID;
+    if (vertexCount > 0 && (vertices = p.vertices.Allocate(vertexCount)) == MeshHeap::INVALID)
+        return false;
+    if (indexCount > 0 && (indices = p.indices.Allocate(indexCount)) == MeshHeap::INVALID) {
+        p.vertices.Free(vertices);
+        return false;
+    }
+    out = {page, vertices, indices};
+    return true;
+}
+
+bool MeshArena::Allocate(uint32_t vertexCount, uint32_t indexCount, Allocation& out) {
+    if (vertexCount == 0 && indexCount == 0) return false;
+    for (uint32_t page = 0; page < m_pages.size(); ++page)
+        if (m_pages[page].live && TryPage(page, vertexCount, indexCount, out)) return true;
+
+    uint32_t page = 0;
+    while (page < m_pages.size() && m_pages[page].live) ++page;
+    if (page == m_pages.size()) m_pages.emplace_back();
+    Page& p = m_pages[page];
+    p.vertices.Reset(std::max(m_pageVertices, vertexCount));
+    p.indices.Reset(std::max(m_pageIndices, indexCount));
+    p.live = true;
+    ++m_livePages;
+    ++m_pagesCreated;
+    return TryPage(page, vertexCount, indexCount, out);
+}
+
+bool MeshArena::IsEmpty(uint32_t page) const {
+    return m_pages[page].vertices.GetAllocationCount() == 0 &&
+           m_pages[page].indices.GetAllocationCount() == 0;
+}
+
+void MeshArena::Free(const Allocation& allocation) {
+    if (allocation.page >= m_pages.size() || !m_pages[allocation.page].live) return;
+    Page& p = m_pages[allocation.page];
+    p.vertices.Free(allocation.vertices);
+    p.indices.Free(allocation.indices);
+    if (!IsEmpty(allocation.page)) return;
+
+    // Keep one empty page as a spare
+    for (uint32_t page = 0; page < m_pages.size(); ++page)
+        if (page != allocation.page && m_pages[page].live && IsEmpty(page)) {
+            p.vertices.Reset(0);
+            p.indices.Reset(0);
+            p.live = false;
+            --m_livePages;
+            ++m_pagesReleased;
+            return;
+        }
+}
+
+int MeshArena::Compact(int maxMoves, std::vector<Move>& moves) {
+    const uint32_t heaps = static_cast<uint32_t>(m_pages.size()) * 2;
+    int moved = 0;
+    // Each heap in turn until maxMoves or a full lap without a move
+    for (uint32_t idle = 0; moved < maxMoves && idle < heaps; ) {
+        if (m_compactCursor >= heaps) m_compactCursor = 0;
+        uint32_t page = m_compactCursor / 2;
+        bool indexHeap = (m_compactCursor & 1) != 0;
+        Page& p = m_pages[page];
+        Move move{page, indexHeap, {}};
+        if (p.live && (indexHeap ? p.indices : p.vertices).Compact(move.move)) {
+            moves.push_back(move);
+            ++moved;
+            idle = 0;
+        } else {
+            ++m_compactCursor;
+            ++idle;
+        }
+    }
+    m_moves += static_cast<uint64_t>(moved);
+    return moved;
+}
+
+uint64_t MeshArena::GetVertexCapacity() const {
+    uint64_t total = 0;
+    for (const Page& p : m_pages)
+        if (p.live) total += p.vertices.GetCapacity();
+    return total;
+}
+
+uint64_t MeshArena::GetIndexCapacity() const {
+    uint64_t total = 0;
+    for (const Page& p : m_pages)
+        if (p.live) total += p.indices.GetCapacity();
+    return total;
+}
@@ -0,0 +1,401 @@
+#include "World/OcclusionBuffer.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define OCCLUSION_X86 1
+#include <immintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define OCCLUSION_ARM64 1
+#include <arm_neon.h>
+#endif
+
+// Same per-function ISA selection as CodecKernels.cpp
+#if defined(_MSC_VER) && !defined(__clang__)
+#define KERNEL_TARGET(x)
+#else
+#define KERNEL_TARGET(x) __attribute__((target(x)))
+#endif
+
+static constexpr float EMPTY_DEPTH = std::numeric_limits<float>::infinity();
+static constexpr int BLOCK = 8;     // pixels per kernel step
+
+// Edge functions of a convex polygon in pixel space: a pixel center (x, y)
+// is covered when a*x + b*y + c >= 0 for every edge. Clipping a quad against
+// the near plane adds at most one vertex; unused edges are 0·p + 1.
+static constexpr int MAX_EDGES = 5;
+struct PolyEdges {
+    float a[MAX_EDGES], b[MAX_EDGES], c[MAX_EDGES];
+};
+
+// Pixel rectangle [x0, x1) x [y0, y1); fills widen x to whole blocks
+struct PixelRect {
+    int x0, x1, y0, y1;
+};
+
+// ── Scalar (reference) ───────────────────────────────────────────────
+// The SIMD tiers evaluate the same expressions in the same order, so they
+// write the same pixels with the same depths.
+
+static void FillScalar(float* depth, const PolyEdges& e, const PixelRect& r, float d) {
+    for (int y = r.y0; y < r.y1; ++y) {
+        float fy = static_cast<float>(y) + 0.5f;
+        float row[MAX_EDGES];
+        for (int k = 0; k < MAX_EDGES; ++k) row[k] = e.b[k] * fy;
+        float* line = depth + y * OcclusionBuffer::WIDTH;
+        for (int x = r.x0; x < r.x1; ++x) {
+            float fx = static_cast<float>(x) + 0.5f;
+            bool inside = true;
+            for (int k = 0; k < MAX_EDGES; ++k)
+                inside = inside && (e.a[k] * fx + row[k] + e.c[k] >= 0.0f);
+            if (inside) line[x] = std::min(line[x], d);
+        }
+    }
+}
+
+// True when some pixel in the rectangle is not strictly nearer than `d`
+static bool AnyNotNearerScalar(const float* depth, const PixelRect& r, float d) {
+    for (int y = r.y0; y < r.y1; ++y) {
+        const float* line = depth + y * OcclusionBuffer::WIDTH;
+        for (int x = r.x0; x < r.x1; ++x)
+            if (!(line[x] < d)) return true;
+    }
+    return false;
+}
+
+// ── SSE2 (2 × 4 pixels) ──────────────────────────────────────────────
+
+#if defined(OCCLUSION_X86)
+KERNEL_TARGET("sse2")
+static void FillSSE2(float* depth, const PolyEdges& e, const PixelRect& r, float d) {
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 dv = _mm_set1_ps(d);
+    const __m128 laneX = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    __m128 a[MAX_EDGES], c[MAX_EDGES];
+    for (int k = 0; k < MAX_EDGES; ++k) {
+        a[k] = _mm_set1_ps(e.a[k]);
+        c[k] = _mm_set1_ps(e.c[k]);
+    }
+    for (int y = r.y0; y < r.y1; ++y) {
+        float fy = static_cast<float>(y) + 0.5f;
+        __m128 row[MAX_EDGES];
+        for (int k = 0; k < MAX_EDGES; ++k) row[k] = _mm_set1_ps(e.b[k] * fy);
+        float* line = depth + y * OcclusionBuffer::WIDTH;
+        for (int x = r.x0; x < r.x1; x += 4) {
+            __m128 fx = _mm_add_ps(_mm_set1_ps(static_cast<float>(x)), laneX);
+            __m128 inside = _mm_cmpeq_ps(zero, zero);
+            for (int k = 0; k < MAX_EDGES; ++k) {
+                __m128 v = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[k], fx), row[k]), c[k]);
+                inside = _mm_and_ps(inside, _mm_cmpge_ps(v, zero));
+            }
+            __m128 old = _mm_loadu_ps(line + x);
+            __m128 nearer = _mm_min_ps(old, dv);
+            _mm_storeu_ps(line + x, _mm_or_ps(_mm_and_ps(inside, nearer), _mm_andnot_ps(inside, old)));
+        }
+    }
+}
+
+KERNEL_TARGET("sse2")
+static bool AnyNotNearerSSE2(const float* depth, const PixelRect& r, float d) {
+    const __m128 dv = _mm_set1_ps(d);
+    const __m128i lane = _mm_setr_epi32(0, 1, 2, 3);
+    const __m128i lo = _mm_set1_epi32(r.x0 - 1);
+    const __m128i hi = _mm_set1_epi32(r.x1);
+    int start = r.x0 & ~3;
+    for (int y = r.y0; y < r.y1; ++y) {
+        const float* line = depth + y * OcclusionBuffer::WIDTH;
+        for (int x = start; x < r.x1; x += 4) {
+            __m128i px = _mm_add_epi32(_mm_set1_epi32(x), lane);
+            __m128i inRect = _mm_and_si128(_mm_cmpgt_epi32(px, lo), _mm_cmplt_epi32(px, hi));
+            __m128 notNearer = _mm_cmpnlt_ps(_mm_loadu_ps(line + x), dv);
+            if (_mm_movemask_ps(_mm_and_ps(notNearer, _mm_castsi128_ps(inRect)))) return true;
+        }
+    }
+    return false;
+}
+
+// ── AVX2 (8 pixels) ──────────────────────────────────────────────────
+
+KERNEL_TARGET("avx2")
+static void FillAVX2(float* depth, const PolyEdges& e, const PixelRect& r, float d) {
+    const __m256 zero = _mm256_setzero_ps();
+    const __m256 dv = _mm256_set1_ps(d);
+    const __m256 laneX = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+    __m256 a[MAX_EDGES], c[MAX_EDGES];
+    for (int k = 0; k < MAX_EDGES; ++k) {
+        a[k] = _mm256_set1_ps(e.a[k]);
+        c[k] = _mm256_set1_ps(e.c[k]);
+    }
+    for (int y = r.y0; y < r.y1; ++y) {
+        float fy = static_cast<float>(y) + 0.5f;
+        __m256 row[MAX_EDGES];
+        for (int k = 0; k < MAX_EDGES; ++k) row[k] = _mm256_set1_ps(e.b[k] * fy);
+        float* line = depth + y * OcclusionBuffer::WIDTH;
+        for (int x = r.x0; x < r.x1; x += BLOCK) {
+            __m256 fx = _mm256_add_ps(_mm256_set1_ps(static_cast<float>(x)), laneX);
+            __m256 inside = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+            for (int k = 0; k < MAX_EDGES; ++k) {
+                __m256 v = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(a[k], fx), row[k]), c[k]);
+                inside = _mm256_and_ps(inside, _mm256_cmp_ps(v, zero, _CMP_GE_OQ));
+            }
+            __m256 old = _mm256_loadu_ps(line + x);
+            _mm256_storeu_ps(line + x, _mm256_blendv_ps(old, _mm256_min_ps(old, dv), inside));
+        }
+    }
+}
+
+KERNEL_TARGET("avx2")
+static bool AnyNotNearerAVX2(const float* depth, const PixelRect& r, float d) {
+    const __m256 dv = _mm256_set1_ps(d);
+    const __m256i lane = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i lo = _mm256_set1_epi32(r.x0 - 1);
+    const __m256i hi = _mm256_set1_epi32(r.x1);
+    int start = r.x0 & ~(BLOCK - 1);
+    for (int y = r.y0; y < r.y1; ++y) {
+        const float* line = depth + y * OcclusionBuffer::WIDTH;
+        for (int x = start; x < r.x1; x += BLOCK) {
+            __m256i px = _mm256_add_epi32(_mm256_set1_epi32(x), lane);
+            __m256i inRect = _mm256_and_si256(_mm256_cmpgt_epi32(px, lo), _mm256_cmpgt_epi32(hi, px));
+            __m256 notNearer = _mm256_cmp_ps(_mm256_loadu_ps(line + x), dv, _CMP_NLT_UQ);
+            __m256 hit = _mm256_and_ps(notNearer, _mm256_castsi256_ps(inRect));
+            if (!_mm256_testz_ps(hit, hit)) return true;
+        }
+    }
+    return false;
+}
+#endif
+
+// ── NEON (2 × 4 pixels) ──────────────────────────────────────────────
+
+#if defined(OCCLUSION_ARM64)
+static void FillNEON(float* depth, const PolyEdges& e, const PixelRect& r, float d) {
+    const float32x4_t zero = vdupq_n_f32(0.0f);
+    const float32x4_t dv = vdupq_n_f32(d);
+    static const float lanes[4] = {0.5f, 1.5f, 2.5f, 3.5f};
+    const float32x4_t laneX = vld1q_f32(lanes);
+    float32x4_t a[MAX_EDGES], c[MAX_EDGES];
+    for (int k = 0; k < MAX_EDGES; ++k) {
+        a[k] = vdupq_n_f32(e.a[k]);
+        c[k] = vdupq_n_f32(e.c[k]);
+    }
+    for (int y = r.y0; y < r.y1; ++y) {
+        float fy = static_cast<float>(y) + 0.5f;
+        float32x4_t row[MAX_EDGES];
+        for (int k = 0; k < MAX_EDGES; ++k) row[k] = vdupq_n_f32(e.b[k] * fy);
+        float* line = depth + y * OcclusionBuffer::WIDTH;
+        for (int x = r.x0; x < r.x1; x += 4) {
+            float32x4_t fx = vaddq_f32(vdupq_n_f32(static_cast<float>(x)), laneX);
+            uint32x4_t inside = vdupq_n_u32(0xFFFFFFFFu);
+            for (int k = 0; k < MAX_EDGES; ++k) {
+                // Separate multiply and adds: no fused rounding, same as scalar
+                float32x4_t v = vaddq_f32(vaddq_f32(vmulq_f32(a[k], fx), row[k]), c[k]);
+                inside = vandq_u32(inside, vcgeq_f32(v, zero));
+            }
+            float32x4_t old = vld1q_f32(line + x);
+            vst1q_f32(line + x, vbslq_f32(inside, vminq_f32(old, dv), old));
+        }
+    }
+}
+
+static bool AnyNotNearerNEON(const float* depth, const PixelRect& r, float d) {
+    const float32x4_t dv = vdupq_n_f32(d);
+    static const int32_t lanes[4] = {0, 1, 2, 3};
+    const int32x4_t lane = vld1q_s32(lanes);
+    const int32x4_t lo = vdupq_n_s32(r.x0);
+    const int32x4_t hi = vdupq_n_s32(r.x1);
+    int start = r.x0 & ~3;
+    for (int y = r.y0; y < r.y1; ++y) {
+        const float* line = depth + y * OcclusionBuffer::WIDTH;
+        for (int x = start; x < r.x1; x += 4) {
+            int32x4_t px = vaddq_s32(vdupq_n_s32(x), lane);
+            uint32x4_t inRect = vandq_u32(vcgeq_s32(px, lo), vcltq_s32(px, hi));
+            uint32x4_t notNearer = vmvnq_u32(vcltq_f32(vld1q_f32(line + x), dv));
+            if (vmaxvq_u32(vandq_u32(notNearer, inRect))) return true;
+        }
+    }
+    return false;
+}
+#endif
+
+// ── Dispatch ─────────────────────────────────────────────────────────
+
+static void Fill(KernelTier tier, float* depth, const PolyEdges& e, const PixelRect& r, float d) {
+    switch (tier) {
+#if defined(OCCLUSION_X86)
+        case KernelTier::SIMD128:  FillSSE2(depth, e, r, d); return;
+        case KernelTier::SIMD256:  FillAVX2(depth, e, r, d); return;
+#elif defined(OCCLUSION_ARM64)
+        case KernelTier::SIMD128:  FillNEON(depth, e, r, d); return;
+#endif
+        default:                   FillScalar(depth, e, r, d); return;
+    }
+}
+
+static bool AnyNotNearer(KernelTier tier, const float* depth, const PixelRect& r, float d) {
+    switch (tier) {
+#if defined(OCCLUSION_X86)
+        case KernelTier::SIMD128:  return AnyNotNearerSSE2(depth, r, d);
+        case KernelTier::SIMD256:  return AnyNotNearerAVX2(depth, r, d);
+#elif defined(OCCLUSION_ARM64)
+        case KernelTier::SIMD128:  return AnyNotNearerNEON(depth, r, d);
+#endif
+        default:                   return AnyNotNearerScalar(depth, r, d);
+    }
+}
+
+const char* OcclusionBuffer::GetTierName(KernelTier tier) {
+    switch (tier) {
+#if defined(OCCLUSION_X86)
+        case KernelTier::SIMD128:  return "SSE2";
+        case KernelTier::SIMD256:  return "AVX2";
+#elif defined(OCCLUSION_ARM64)
+        case KernelTier::SIMD128:  return "NEON";
+#endif
+        default:                   return "Scalar";
+    }
+}
+
+// ── Buffer ───────────────────────────────────────────────────────────
+
+static_assert(OcclusionBuffer::WIDTH % BLOCK == 0, "rows must be whole kernel blocks");
+
+OcclusionBuffer::OcclusionBuffer()
+    : m_tier(CodecKernels::GetTier()), m_depth(WIDTH * HEIGHT, EMPTY_DEPTH) {}
+
+void OcclusionBuffer::Begin(const WorldViewProj& viewProj) {
+    m_viewProj = viewProj;
+    std::fill(m_depth.begin(), m_depth.end(), EMPTY_DEPTH);
+}
+
+size_t OcclusionBuffer::CountCovered() const {
+    return static_cast<size_t>(std::count_if(m_depth.begin(), m_depth.end(),
+                                             [](float d) { return d < EMPTY_DEPTH; }));
+}
+
+void OcclusionBuffer::DrawOccluder(const WorldVec3& min, const WorldVec3& max) {
+    const WorldVec3& eye = m_viewProj.eye;
+    // A face points towards the camera when the camera is outside its plane
+    if (eye.x < min.x || eye.x > max.x) {
+        float x = (eye.x < min.x) ? min.x : max.x;
+        WorldVec3 q[4] = {{x, min.y, min.z}, {x, max.y, min.z}, {x, max.y, max.z}, {x, min.y, max.z}};
+        DrawPolygon(q, 4);
+    }
+    if (eye.y < min.y || eye.y > max.y) {
+        float y = (eye.y < min.y) ? min.y : max.y;
+        WorldVec3 q[4] = {{min.x, y, min.z}, {max.x, y, min.z}, {max.x, y, max.z}, {min.x, y, max.z}};
+        DrawPolygon(q, 4);
+    }
+    if (eye.z < min.z || eye.z > max.z) {
+        float z = (eye.z < min.z) ? min.z : max.z;
+        WorldVec3 q[4] = {{min.x, min.y, z}, {max.x, min.y, z}, {max.x, max.y, z}, {min.x, max.y, z}};
+        DrawPolygon(q, 4);
+    }
+}
+
+void OcclusionBuffer::DrawPolygon(const WorldVec3* corners, int count) {
+    const auto& m = m_viewProj.rows;
+    ScreenVert in[4];
+    for (int i = 0; i < count; ++i) {
+        const WorldVec3& p = corners[i];
+        in[i] = {m[0][0] * p.x + m[0][1] * p.y + m[0][2] * p.z + m[0][3],
+                 m[1][0] * p.x + m[1][1] * p.y + m[1][2] * p.z + m[1][3],
+                 m[2][0] * p.x + m[2][1] * p.y + m[2][2] * p.z + m[2][3]};
+    }
+
+    // Clip against the near plane (Sutherland-Hodgman on w)
+    ScreenVert clipped[MAX_EDGES];
+    int n = 0;
+    for (int i = 0; i < count; ++i) {
+        const ScreenVert& cur = in[i];
+        const ScreenVert& next = in[(i + 1) % count];
+        bool curIn = cur.w >= NEAR_DEPTH, nextIn = next.w >= NEAR_DEPTH;
+        if (curIn) clipped[n++] = cur;
+        if (curIn != nextIn) {
+            float t = (NEAR_DEPTH - cur.w) / (next.w - cur.w);
+            clipped[n++] = {cur.x + (next.x - cur.x) * t, cur.y + (next.y - cur.y) * t, NEAR_DEPTH};
+        }
+    }
+    if (n < 3) return;
+
+    // Whole face at its farthest depth, in pixels (y down)
+    float depth = 0.0f;
+    for (int i = 0; i < n; ++i) {
+        ScreenVert& v = clipped[i];
+        depth = std::max(depth, v.w);
+        v.x = (v.x / v.w * 0.5f + 0.5f) * static_cast<float>(WIDTH);
+        v.y = (0.5f - v.y / v.w * 0.5f) * static_cast<float>(HEIGHT);
+    }
+
+    PolyEdges edges;
+    float area = 0.0f;
+    for (int i = 0; i < MAX_EDGES; ++i) {
+        if (i >= n) {
+            edges.a[i] = 0.0f; edges.b[i] = 0.0f; edges.c[i] = 1.0f;
+            continue;
+        }
+        const ScreenVert& p = clipped[i];
+        const ScreenVert& q = clipped[(i + 1) % n];
+        edges.a[i] = p.y - q.y;
+        edges.b[i] = q.x - p.x;
+        edges.c[i] = p.x * q.y - p.y * q.x;
+        area += edges.c[i];
+    }
+    if (std::abs(area) < 1e-6f) return;
+    // Inside is the non-negative side whichever way the face winds on screen
+    if (area < 0.0f) {
+        for (int i = 0; i < n; ++i) {
+            edges.a[i] = -edges.a[i]; edges.b[i] = -edges.b[i]; edges.c[i] = -edges.c[i];
+        }
+    }
+
+    float minX = clipped[0].x, maxX = clipped[0].x, minY = clipped[0].y, maxY = clipped[0].y;
+    for (int i = 1; i < n; ++i) {
+        minX = std::min(minX, clipped[i].x); maxX = std::max(maxX, clipped[i].x);
+        minY = std::min(minY, clipped[i].y); maxY = std::max(maxY, clipped[i].y);
+    }
+    constexpr float W = static_cast<float>(WIDTH), H = static_cast<float>(HEIGHT);
+    PixelRect r;
+    r.x0 = static_cast<int>(std::clamp(minX, 0.0f, W)) & ~(BLOCK - 1);
+    r.x1 = (static_cast<int>(std::ceil(std::clamp(maxX, 0.0f, W))) + BLOCK - 1) & ~(BLOCK - 1);
+    r.y0 = static_cast<int>(std::clamp(minY, 0.0f, H));
+    r.y1 = static_cast<int>(std::ceil(std::clamp(maxY, 0.0f, H)));
+    if (r.x0 >= r.x1 || r.y0 >= r.y1) return;
+
+    Fill(m_tier, m_depth.data(), edges, r, depth);
+}
+
+bool OcclusionBuffer::IsVisible(const WorldVec3& min, const WorldVec3& max) const {
+    const auto& m = m_viewProj.rows;
+    float minX = EMPTY_DEPTH, maxX = -EMPTY_DEPTH, minY = EMPTY_DEPTH, maxY = -EMPTY_DEPTH;
+    float nearest = EMPTY_DEPTH;
+    for (int i = 0; i < 8; ++i) {
+        float px = (i & 1) ? max.x : min.x;
+        float py = (i & 2) ? max.y : min.y;
+        float pz = (i & 4) ? max.z : min.z;
+        float w = m[2][0] * px + m[2][1] * py + m[2][2] * pz + m[2][3];
+        // Reaches the near plane: its projection is unbounded
+        if (!(w >= NEAR_DEPTH)) return true;
+        float x = m[0][0] * px + m[0][1] * py + m[0][2] * pz + m[0][3];
+        float y = m[1][0] * px + m[1][1] * py + m[1][2] * pz + m[1][3];
+        float sx = (x / w * 0.5f + 0.5f) * static_cast<float>(WIDTH);
+        float sy = (0.5f - y / w * 0.5f) * static_cast<float>(HEIGHT);
+        minX = std::min(minX, sx); maxX = std::max(maxX, sx);
+        minY = std::min(minY, sy); maxY = std::max(maxY, sy);
+        nearest = std::min(nearest, w);
+    }
+
+    // Occluders cover pixels by their centers, so an edge can claim up to
+    // half a pixel it does not hide: one pixel of margin around the box
+    // keeps such slivers visible
+    constexpr float W = static_cast<float>(WIDTH), H = static_cast<float>(HEIGHT);
+    PixelRect r;
+    r.x0 = static_cast<int>(std::floor(std::clamp(minX - 1.0f, 0.0f, W)));
+    r.x1 = static_cast<int>(std::floor(std::clamp(maxX + 2.0f, 0.0f, W)));
+    r.y0 = static_cast<int>(std::floor(std::clamp(minY - 1.0f, 0.0f, H)));
+    r.y1 = static_cast<int>(std::floor(std::clamp(maxY + 2.0f, 0.0f, H)));
+    // Off the buffer: leave the decision to the frustum test
+    if (r.x0 >= r.x1 || r.y0 >= r.y1) return true;
+
+    return AnyNotNearer(m_tier, m_depth.data(), r, nearest);
+}
@@ -1,4 +1,8 @@
 #include "World/RegionFile.hpp"
+#include "World/ChunkCodec.hpp"
+#include "World/CodecKernels.hpp"
+#include "World/ChunkKey.hpp"
+#include "World/FlatHashMap.hpp"
 #include <fstream>
 #include <cstring>
 
@@ -56,25 +60,8 @@ static bool ReadI32(const uint8_t*& p, const uint8_t* end, int32_t& v) {
 
 // ── CRC32 ────────────────────────────────────────────────────────────
 
-static uint32_t s_crcTable[256];
-static bool s_crcInit = false;
-
-static void InitCRCTable() {
-    for (uint32_t i = 0; i < 256; ++i) {
-        uint32_t crc = i;
-        for (int j = 0; j < 8; ++j)
-            crc = (crc >> 1) ^ (0xEDB88320 & (-(crc & 1)));
-        s_crcTable[i] = crc;
-    }
-    s_crcInit = true;
-}
-
 uint32_t RegionFile::CRC32(const uint8_t* data, size_t size) {
-    if (!s_crcInit) InitCRCTable();
-    uint32_t crc = 0xFFFFFFFF;
-    for (size_t i = 0; i < size; ++i)
-        crc = (crc >> 8) ^ s_crcTable[(crc ^ data[i]) & 0xFF];
-    return crc ^ 0xFFFFFFFF;
+    return CodecKernels::CRC32(data, size);
 }
 
 // ── RLE ──────────────────────────────────────────────────────────────
@@ -84,9 +71,7 @@ std::vector<uint8_t> RegionFile::RLEEncode(const uint8_t* data, size_t size) {
     size_t i = 0;
     while (i < size) {
         uint8_t val = data[i];
-        uint16_t count = 1;
-        while (i + count < size && data[i + count] == val && count < 65535)
-            ++count;
+        uint16_t count = static_cast<uint16_t>(CodecKernels::RunLength(data + i, size - i, 65535));
         WriteU16(out, count);
         WriteU8(out, val);
         i += count;
@@ -124,46 +109,126 @@ std::string RegionFile::RegionFileName(int rx, int rz) {
 }
 
 // ── Save ─────────────────────────────────────────────────────────────
+// v2 chunk record: cx(4) cy(4) cz(4) codec(1) size(4) crc(4) payload(size)
+// v1 chunk record: cx(4) cy(4) cz(4) size(4) crc(4) rle(size)
+
+// Encodes one chunk record and appends it to `buf`. The scratch buffers
+// keep their capacity from chunk to chunk.
+struct ChunkEncodeScratch {
+    std::vector<uint8_t> payload;
+    std::vector<uint8_t> delta;
+    std::array<uint8_t, 4096> baseBlocks;
+};
+
+static void WriteChunk(std::vector<uint8_t>& buf, const ChunkSaveData& c,
+                       const ChunkBaseSource* base, ChunkEncodeScratch& scratch) {
+    WriteI32(buf, c.cx);
+    WriteI32(buf, c.cy);
+    WriteI32(buf, c.cz);
+
+    std::vector<uint8_t>& payload = scratch.payload;
+    ChunkCodecId codec = ChunkCodec::EncodeBest(c.blocks.data(), c.blocks.size(), payload);
+    if (base && base->generate) {
+        // Lightly edited terrain: keep only the blocks that differ from
+        // generation, unless the full encoding is already smaller
+        base->generate(c.cx, c.cy, c.cz, scratch.baseBlocks.data());
+        ChunkCodec::DeltaEncode(c.blocks.data(), scratch.baseBlocks.data(), c.blocks.size(),
+                                base->version, scratch.delta);
+        if (scratch.delta.size() < payload.size()) {
+            payload.swap(scratch.delta);
+            codec = ChunkCodecId::Delta;
+        }
+    }
+    uint32_t crc = RegionFile::CRC32(c.blocks.data(), c.blocks.size());
 
-bool RegionFile::Save(const std::string& path, const std::vector<ChunkSaveData>& chunks) {
+    WriteU8(buf, static_cast<uint8_t>(codec));
+    WriteU32(buf, static_cast<uint32_t>(payload.size()));
+    WriteU32(buf, crc);
+    buf.insert(buf.end(), payload.begin(), payload.end());
+}
+
+static bool WriteRegion(const std::string& path, const std::vector<uint8_t>& buf) {
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+    file.write(reinterpret_cast<const char*>(buf.data()),
+               static_cast<std::streamsize>(buf.size()));
+    return file.good();
+}
+
+bool RegionFile::Save(const std::string& path, const std::vector<ChunkSaveData>& chunks,
+                      const ChunkBaseSource* base) {
     std::vector<uint8_t> buf;
 
     WriteU32(buf, MAGIC);
     WriteU16(buf, CURRENT_VERSION);
     WriteU16(buf, static_cast<uint16_t>(chunks.size()));
 
-    for (const auto& c : chunks) {
-        WriteI32(buf, c.cx);
-        WriteI32(buf, c.cy);
-        WriteI32(buf, c.cz);
+    ChunkEncodeScratch scratch;
+    for (const auto& c : chunks)
+        WriteChunk(buf, c, base, scratch);
+    return WriteRegion(path, buf);
+}
+
+bool RegionFile::Update(const std::string& path, const std::vector<const ChunkSaveData*>& chunks,
+                        const ChunkBaseSource* base) {
+    // A missing or unreadable region starts empty, as a fresh Save would
+    std::vector<uint8_t> old;
+    std::vector<RegionChunkRecord> records;
+    if (!ReadFile(path, old) || !ParseIndex(old, records))
+        records.clear();
 
-        auto compressed = RLEEncode(c.blocks.data(), c.blocks.size());
-        uint32_t crc = CRC32(c.blocks.data(), c.blocks.size());
+    FlatHashSet<uint64_t> replaced;
+    replaced.reserve(chunks.size());
+    for (const ChunkSaveData* c : chunks)
+        replaced.insert(ChunkKey::Pack(c->cx, c->cy, c->cz));
 
-        WriteU32(buf, static_cast<uint32_t>(compressed.size()));
-        WriteU32(buf, crc);
-        buf.insert(buf.end(), compressed.begin(), compressed.end());
+    std::vector<uint8_t> buf;
+    buf.reserve(old.size() + chunks.size() * 64);
+    WriteU32(buf, MAGIC);
+    WriteU16(buf, CURRENT_VERSION);
+    size_t countAt = buf.size();
+    WriteU16(buf, 0);
+
+    // Untouched records keep their payload bytes: no decode, no re-encode
+    size_t count = 0;
+    for (const auto& r : records) {
+        if (replaced.find(ChunkKey::Pack(r.cx, r.cy, r.cz)) != replaced.end()) continue;
+        WriteI32(buf, r.cx);
+        WriteI32(buf, r.cy);
+        WriteI32(buf, r.cz);
+        WriteU8(buf, r.codec);
+        WriteU32(buf, r.size);
+        WriteU32(buf, r.crc);
+        buf.insert(buf.end(), r.payload, r.payload + r.size);
+        ++count;
     }
 
-    std::ofstream file(path, std::ios::binary);
-    if (!file.is_open()) return false;
-    file.write(reinterpret_cast<const char*>(buf.data()),
-               static_cast<std::streamsize>(buf.size()));
-    return file.good();
+    ChunkEncodeScratch scratch;
+    for (const ChunkSaveData* c : chunks) {
+        WriteChunk(buf, *c, base, scratch);
+        ++count;
+    }
+
+    buf[countAt] = static_cast<uint8_t>(count & 0xFF);
+    buf[countAt + 1] = static_cast<uint8_t>((count >> 8) & 0xFF);
+    return WriteRegion(path, buf);
 }
 
 // ── Load ─────────────────────────────────────────────────────────────
 
-bool RegionFile::Load(const std::string& path, std::vector<ChunkSaveData>& chunks) {
+bool RegionFile::ReadFile(const std::string& path, std::vector<uint8_t>& buf) {
     std::ifstream file(path, std::ios::binary | std::ios::ate);
     if (!file.is_open()) return false;
 
     auto fileSize = file.tellg();
     file.seekg(0);
-    std::vector<uint8_t> buf(static_cast<size_t>(fileSize));
+    buf.resize(static_cast<size_t>(fileSize));
     file.read(reinterpret_cast<char*>(buf.data()), fileSize);
-    if (!file.good()) return false;
+    return file.good();
+}
 
+bool RegionFile::ParseIndex(const std::vector<uint8_t>& buf,
+                            std::vector<RegionChunkRecord>& records) {
     const uint8_t* p = buf.data();
     const uint8_t* end = p + buf.size();
 
@@ -173,23 +238,66 @@ bool RegionFile::Load(const std::string& path, std::vector<ChunkSaveData>& chunk
     if (!ReadU16(p, end, version) || version > CURRENT_VERSION) return false;
     if (!ReadU16(p, end, chunkCount)) return false;
 
-    chunks.resize(chunkCount);
+    records.resize(chunkCount);
     for (uint16_t i = 0; i < chunkCount; ++i) {
-        auto& c = chunks[i];
-        if (!ReadI32(p, end, c.cx)) return false;
-        if (!ReadI32(p, end, c.cy)) return false;
-        if (!ReadI32(p, end, c.cz)) return false;
+        auto& r = records[i];
+        if (!ReadI32(p, end, r.cx)) return false;
+        if (!ReadI32(p, end, r.cy)) return false;
+        if (!ReadI32(p, end, r.cz)) return false;
 
-        uint32_t compSize, crc;
-        if (!ReadU32(p, end, compSize)) return false;
-        if (!ReadU32(p, end, crc)) return false;
+        // v1 files have no codec byte — every chunk is RLE
+        r.codec = static_cast<uint8_t>(ChunkCodecId::RLE);
+        if (version >= 2 && !ReadU8(p, end, r.codec)) return false;
 
-        if (p + compSize > end) return false;
-        if (!RLEDecode(p, compSize, c.blocks.data(), 4096)) return false;
-        p += compSize;
+        if (!ReadU32(p, end, r.size)) return false;
+        if (!ReadU32(p, end, r.crc)) return false;
 
-        uint32_t checkCrc = CRC32(c.blocks.data(), 4096);
-        if (checkCrc != crc) return false;
+        if (r.size > static_cast<size_t>(end - p)) return false;
+        r.payload = p;
+        p += r.size;
+    }
+    return true;
+}
+
+bool RegionFile::DecodeChunk(const RegionChunkRecord& record, std::array<uint8_t, 4096>& blocks,
+                             const ChunkBaseSource* base) {
+    if (record.codec == static_cast<uint8_t>(ChunkCodecId::Delta)) {
+        if (!base || !base->generate) return false;
+        std::array<uint8_t, 4096> baseBlocks;
+        base->generate(record.cx, record.cy, record.cz, baseBlocks.data());
+        if (!ChunkCodec::DeltaDecode(record.payload, record.size, baseBlocks.data(),
+                                     base->version, blocks.data(), blocks.size()))
+            return false;
+    } else if (!ChunkCodec::Decode(static_cast<ChunkCodecId>(record.codec), record.payload,
+                                   record.size, blocks.data(), blocks.size())) {
+        return false;
+    }
+
+    return CRC32(blocks.data(), blocks.size()) == record.crc;
+}
+
+bool RegionFile::IsStaleDelta(const RegionChunkRecord& record, const ChunkBaseSource& base) {
+    uint16_t version;
+    return record.codec == static_cast<uint8_t>(ChunkCodecId::Delta) &&
+           ChunkCodec::DeltaBaseVersion(record.payload, record.size, version) &&
+           version != base.version;
+}
+
+bool RegionFile::Load(const std::string& path, std::vector<ChunkSaveData>& chunks,
+                      const ChunkBaseSource* base) {
+    std::vector<uint8_t> buf;
+    std::vector<RegionChunkRecord> records;
+    if (!ReadFile(path, buf)) return false;
+    if (!ParseIndex(buf, records)) return false;
+
+    chunks.resize(records.size());
+    for (size_t i = 0; i < records.size(); ++i) {
+        auto& c = chunks[i];
+        c.cx = records[i].cx;
+        c.cy = records[i].cy;
+        c.cz = records[i].cz;
+        if (!DecodeChunk(records[i], c.blocks, base))
+            return false;
     }
     return true;
 }
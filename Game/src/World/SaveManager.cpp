@@ -1,7 +1,14 @@
 #include "World/SaveManager.hpp"
+#include "World/WorldGenerator.hpp"
+#include "World/Chunk.hpp"
+#include "World/TraceTimeline.hpp"
 #include <fstream>
 #include <cstring>
 #include <chrono>
+#include <atomic>
+#include <thread>
+#include <algorithm>
+#include <optional>
 #include <filesystem>
 #include <sys/stat.h>
 #ifdef _WIN32
@@ -144,56 +151,56 @@ bool SaveManager::EnsureDirectories() const {
     return true;
 }
 
-int64_t SaveManager::PackCoord(int32_t cx, int32_t cy, int32_t cz) {
-    // Pack 3 ints into a single int64 for map key
-    // cy is limited range, cx/cz are world coords
-    uint64_t ux = static_cast<uint32_t>(cx);
-    uint64_t uy = static_cast<uint32_t>(cy) & 0xFFFF;
-    uint64_t uz = static_cast<uint32_t>(cz);
-    return static_cast<int64_t>((ux << 32) | (uy << 16) | (uz & 0xFFFF));
+// Base chunks for delta-encoded saves: the chunk as the generator produces it
+static ChunkBaseSource MakeBaseSource(const WorldGenerator& generator) {
+    ChunkBaseSource base;
+    base.version = WorldGenerator::GENERATOR_VERSION;
+    base.generate = [&generator](int32_t cx, int32_t cy, int32_t cz, uint8_t* blocks) {
+        Chunk chunk(cx, cy, cz);
+        generator.Generate(&chunk);
+        std::memcpy(blocks, chunk.GetBlockData(), Chunk::VOLUME);
+    };
+    return base;
 }
 
 // ── Save ─────────────────────────────────────────────────────────────
 
 bool SaveManager::SaveWorld(const WorldMeta& meta,
-                            const std::vector<ChunkSaveData>& dirtyChunks) {
+                            const std::vector<ChunkSaveData>& dirtyChunks,
+                            const WorldGenerator* generator) {
+    SLEAK_TRACE_SCOPE("SaveWorld");
     EnsureDirectories();
 
     // Group dirty chunks by region
-    std::unordered_map<int64_t, std::vector<const ChunkSaveData*>> regionGroups;
-    std::unordered_map<int64_t, std::pair<int,int>> regionCoords;
+    FlatHashMap<uint64_t, std::vector<const ChunkSaveData*>> regionGroups;
+    FlatHashMap<uint64_t, std::pair<int,int>> regionCoords;
 
     for (const auto& chunk : dirtyChunks) {
         int rx, rz;
         RegionFile::RegionCoord(chunk.cx, chunk.cz, rx, rz);
-        int64_t key = PackCoord(rx, 0, rz);
+        uint64_t key = ChunkKey::Pack(rx, 0, rz);
         regionGroups[key].push_back(&chunk);
         regionCoords[key] = {rx, rz};
     }
 
-    // For each region: load existing data, merge dirty chunks, save
+    // Delta bases are only generated for the dirty chunks; the world's own
+    // generator has their columns cached already
+    std::optional<WorldGenerator> ownGenerator;
+    ChunkBaseSource base;
+    const ChunkBaseSource* saveBase = nullptr;
+    if (meta.flags & WorldMeta::FLAG_DELTA_CHUNKS) {
+        if (!generator || generator->GetSeed() != meta.seed)
+            generator = &ownGenerator.emplace(meta.seed);
+        base = MakeBaseSource(*generator);
+        saveBase = &base;
+    }
+
+    // For each region: keep the stored records, replace the dirty chunks
     for (auto& [key, dirtyList] : regionGroups) {
+        SLEAK_TRACE_SCOPE("SaveRegion");
         auto [rx, rz] = regionCoords[key];
         std::string regionPath = m_savePath + "/regions/" + RegionFile::RegionFileName(rx, rz);
-
-        // Load existing region data
-        std::vector<ChunkSaveData> existing;
-        RegionFile::Load(regionPath, existing);
-
-        // Build map of existing chunks, overwrite with dirty ones
-        std::unordered_map<int64_t, ChunkSaveData> merged;
-        for (auto& c : existing)
-            merged[PackCoord(c.cx, c.cy, c.cz)] = c;
-        for (auto* c : dirtyList)
-            merged[PackCoord(c->cx, c->cy, c->cz)] = *c;
-
-        // Convert back to vector
-        std::vector<ChunkSaveData> toSave;
-        toSave.reserve(merged.size());
-        for (auto& [k, v] : merged)
-            toSave.push_back(std::move(v));
-
-        if (!RegionFile::Save(regionPath, toSave))
+        if (!RegionFile::Update(regionPath, dirtyList, saveBase))
             return false;
     }
 
@@ -212,16 +219,16 @@ bool SaveManager::WriteWorldDat(const WorldMeta& meta,
                                 const std::vector<ChunkSaveData>& /*dirtyChunks*/) const {
     // First, read existing world.dat to get previous region list
     WorldMeta existing;
-    std::unordered_map<int64_t, WorldMeta::RegionEntry> allRegions;
+    FlatHashMap<uint64_t, WorldMeta::RegionEntry> allRegions;
 
     if (const_cast<SaveManager*>(this)->ReadWorldDat(existing)) {
         for (const auto& r : existing.regions)
-            allRegions[PackCoord(r.rx, 0, r.rz)] = r;
+            allRegions[ChunkKey::Pack(r.rx, 0, r.rz)] = r;
     }
 
     // Merge new regions (overwrite counts for updated regions)
     for (const auto& r : meta.regions)
-        allRegions[PackCoord(r.rx, 0, r.rz)] = r;
+        allRegions[ChunkKey::Pack(r.rx, 0, r.rz)] = r;
 
     std::vector<uint8_t> buf;
 
@@ -264,21 +271,104 @@ bool SaveManager::WriteWorldDat(const WorldMeta& meta,
 
 // ── Load ─────────────────────────────────────────────────────────────
 
-bool SaveManager::LoadWorld(WorldMeta& meta,
-                            std::unordered_map<int64_t, std::array<uint8_t, 4096>>& chunkData) {
+// Runs fn(i) for every i in [0, count) across `threads` threads (the caller
+// included). Work is claimed in batches from an atomic counter — no lock.
+template <typename Fn>
+static void ParallelFor(size_t count, int threads, size_t batch, Fn&& fn) {
+    std::atomic<size_t> next{0};
+    auto worker = [&] {
+        for (;;) {
+            size_t begin = next.fetch_add(batch);
+            if (begin >= count) return;
+            size_t end = std::min(begin + batch, count);
+            for (size_t i = begin; i < end; ++i)
+                fn(i);
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int t = 1; t < threads; ++t)
+        pool.emplace_back(worker);
+    worker();
+    for (auto& t : pool)
+        t.join();
+}
+
+static int LoadThreadCount(size_t jobs) {
+    int count = static_cast<int>(std::thread::hardware_concurrency());
+    if (count < 1) count = 1;
+    if (count > 16) count = 16;
+    if (static_cast<size_t>(count) > jobs) count = static_cast<int>(std::max<size_t>(jobs, 1));
+    return count;
+}
+
+bool SaveManager::LoadWorld(WorldMeta& meta, SavedChunkMap& chunkData) {
+    SLEAK_TRACE_SCOPE("LoadWorld");
     if (!ReadWorldDat(meta)) return false;
 
-    chunkData.clear();
+    chunkData.Clear();
 
-    // Load all region files listed in the meta
-    for (const auto& region : meta.regions) {
+    WorldGenerator generator(meta.seed);
+    ChunkBaseSource base = MakeBaseSource(generator);
+
+    // Stage 1: read and index every region file in parallel
+    struct RegionSlot {
+        std::vector<uint8_t> buf;
+        std::vector<RegionChunkRecord> records;
+        bool ok = false;
+    };
+    std::vector<RegionSlot> regions(meta.regions.size());
+    ParallelFor(regions.size(), LoadThreadCount(regions.size()), 1, [&](size_t i) {
+        const auto& region = meta.regions[i];
         std::string regionPath = m_savePath + "/regions/" +
                                  RegionFile::RegionFileName(region.rx, region.rz);
-        std::vector<ChunkSaveData> chunks;
-        if (!RegionFile::Load(regionPath, chunks)) continue;
+        regions[i].ok = RegionFile::ReadFile(regionPath, regions[i].buf) &&
+                        RegionFile::ParseIndex(regions[i].buf, regions[i].records);
+    });
+
+    // Stage 2: give every chunk its own map slot up front. Later regions win
+    // on duplicates, so each slot has exactly one writer and workers can fill
+    // slots without synchronization (the map is reserved for every record,
+    // so slots never move).
+    struct DecodeJob {
+        const RegionChunkRecord* record;
+        SavedChunkMap::Blocks* blocks;
+        bool ok;
+    };
+    size_t recordCount = 0;
+    for (const auto& region : regions)
+        if (region.ok) recordCount += region.records.size();
+    chunkData.Reserve(recordCount);
+
+    FlatHashMap<uint64_t, size_t> jobIndex;
+    jobIndex.reserve(recordCount);
+    std::vector<DecodeJob> jobs;
+    jobs.reserve(recordCount);
+    for (auto& region : regions) {
+        if (!region.ok) continue;
+        for (auto& rec : region.records) {
+            uint64_t key = ChunkKey::Pack(rec.cx, rec.cy, rec.cz);
+            auto [it, inserted] = jobIndex.try_emplace(key, jobs.size());
+            if (inserted)
+                jobs.push_back({&rec, chunkData.Insert(key).first, false});
+            else
+                jobs[it->second].record = &rec;
+        }
+    }
 
-        for (auto& c : chunks)
-            chunkData[PackCoord(c.cx, c.cy, c.cz)] = c.blocks;
+    // Stage 3: decode + CRC-verify chunks in parallel
+    ParallelFor(jobs.size(), LoadThreadCount(jobs.size()), 16, [&](size_t i) {
+        jobs[i].ok = RegionFile::DecodeChunk(*jobs[i].record, *jobs[i].blocks, &base);
+    });
+
+    // Corrupt chunks are dropped and regenerate from the seed. So do deltas
+    // from another generator version, but those are counted for the caller
+    // to report: their records are kept, not lost.
+    m_staleDeltaChunks = 0;
+    for (auto& job : jobs) {
+        if (job.ok) continue;
+        if (RegionFile::IsStaleDelta(*job.record, base)) ++m_staleDeltaChunks;
+        chunkData.Erase(ChunkKey::Pack(job.record->cx, job.record->cy, job.record->cz));
     }
 
     // Also scan for region files not in meta (from previous saves)
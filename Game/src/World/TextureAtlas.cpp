@@ -8,8 +8,6 @@
 using namespace Sleak;
 using namespace Sleak::UI;
 
-int TextureAtlas::s_rows = 1;
-
 // Tile source files in BlockTile enum order
 static const char* s_tilePaths[] = {
     "assets/textures/blocks/grass_block_top.png",  // TILE_GRASS_TOP
@@ -49,7 +47,6 @@ static void ResampleNearest(const unsigned char* src, int srcW, int srcH,
 
 Texture* TextureAtlas::BuildAtlas() {
     constexpr int tileCount = TILE_COUNT;
-    s_rows = (tileCount + TILES_PER_ROW - 1) / TILES_PER_ROW;
 
     // First pass: load all tiles and find the max dimension to use as tile size
     struct TileData {
@@ -69,7 +66,7 @@ Texture* TextureAtlas::BuildAtlas() {
     if (tileSize == 0) tileSize = 16; // fallback
 
     int atlasW = tileSize * TILES_PER_ROW;
-    int atlasH = tileSize * s_rows;
+    int atlasH = tileSize * ROWS;
 
     // Allocate atlas pixel buffer (RGBA)
     std::vector<unsigned char> atlas(atlasW * atlasH * 4, 0);
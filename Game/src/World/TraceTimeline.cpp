@@ -0,0 +1,197 @@
+#include "World/TraceTimeline.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// ── Per-thread rings ─────────────────────────────────────────────────
+
+// Single producer (the owning thread), any number of readers. Slots are
+// relaxed atomics so a reader racing the producer never reads torn data
+// it keeps; the release store of head publishes a finished slot.
+struct TraceRing {
+    struct Slot {
+        std::atomic<const char*> name{nullptr};
+        std::atomic<uint64_t> startNs{0};
+        std::atomic<uint64_t> durNs{0};
+    };
+
+    Slot slots[TraceTimeline::RING_CAPACITY];
+    std::atomic<uint64_t> head{0};   // total spans ever written
+    std::atomic<bool> inUse{true};
+    uint32_t tid = 0;
+    std::string name;                // guarded by the registry mutex
+};
+
+struct TraceRegistry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<TraceRing>> rings;
+    uint32_t nextTid = 1;
+};
+
+static TraceRegistry& GetRegistry() {
+    static TraceRegistry registry;
+    return registry;
+}
+
+// Returns the ring to the registry when its thread exits. The next thread
+// that starts recording reuses it (worker pools restart on reloads), so the
+// ring count stays bounded by the peak number of live threads.
+struct TraceRingHandle {
+    TraceRing* ring = nullptr;
+    ~TraceRingHandle() {
+        if (ring) ring->inUse.store(false, std::memory_order_release);
+    }
+};
+
+static thread_local TraceRingHandle t_ring;
+
+static TraceRing* AcquireRing() {
+    if (t_ring.ring) return t_ring.ring;
+
+    TraceRegistry& reg = GetRegistry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    TraceRing* ring = nullptr;
+    for (auto& r : reg.rings) {
+        if (!r->inUse.load(std::memory_order_acquire)) {
+            ring = r.get();
+            ring->head.store(0, std::memory_order_relaxed);
+            ring->inUse.store(true, std::memory_order_relaxed);
+            break;
+        }
+    }
+    if (!ring) {
+        reg.rings.push_back(std::make_unique<TraceRing>());
+        ring = reg.rings.back().get();
+    }
+    ring->tid = reg.nextTid++;
+    ring->name = "Thread " + std::to_string(ring->tid);
+    t_ring.ring = ring;
+    return ring;
+}
+
+struct TraceSpanCopy {
+    const char* name;
+    uint64_t startNs;
+    uint64_t durNs;
+};
+
+// Snapshot of one ring's surviving spans, oldest first
+static void CopyRing(const TraceRing& ring, std::vector<TraceSpanCopy>& out) {
+    constexpr uint64_t CAP = TraceTimeline::RING_CAPACITY;
+    uint64_t end = ring.head.load(std::memory_order_acquire);
+    uint64_t begin = (end > CAP) ? end - CAP : 0;
+    size_t first = out.size();
+    for (uint64_t i = begin; i < end; ++i) {
+        const auto& s = ring.slots[i & (CAP - 1)];
+        out.push_back({s.name.load(std::memory_order_relaxed),
+                       s.startNs.load(std::memory_order_relaxed),
+                       s.durNs.load(std::memory_order_relaxed)});
+    }
+    // The producer may have lapped the copy; the slot it is writing right
+    // now (index `after`) aliases index after - CAP, so drop that one too.
+    uint64_t after = ring.head.load(std::memory_order_acquire);
+    uint64_t keepFrom = (after + 1 > CAP) ? after + 1 - CAP : 0;
+    if (keepFrom > begin) {
+        size_t drop = static_cast<size_t>(std::min<uint64_t>(keepFrom - begin, end - begin));
+        out.erase(out.begin() + first, out.begin() + first + drop);
+    }
+}
+
+static void WriteJsonString(std::ofstream& f, const char* s) {
+    f << '"';
+    for (; *s; ++s) {
+        char c = *s;
+        if (c == '"' || c == '\\') f << '\\' << c;
+        else if (static_cast<unsigned char>(c) < 0x20) f << ' ';
+        else f << c;
+    }
+    f << '"';
+}
+
+// ── Recording ────────────────────────────────────────────────────────
+
+void TraceTimeline::Record(const char* name, uint64_t startNs, uint64_t endNs) {
+    TraceRing* ring = AcquireRing();
+    uint64_t idx = ring->head.load(std::memory_order_relaxed);
+    auto& slot = ring->slots[idx & (RING_CAPACITY - 1)];
+    slot.name.store(name, std::memory_order_relaxed);
+    slot.startNs.store(startNs, std::memory_order_relaxed);
+    slot.durNs.store(endNs - startNs, std::memory_order_relaxed);
+    ring->head.store(idx + 1, std::memory_order_release);
+}
+
+void TraceTimeline::SetThreadName(const std::string& name) {
+    TraceRing* ring = AcquireRing();
+    std::lock_guard<std::mutex> lock(GetRegistry().mutex);
+    ring->name = name;
+}
+
+void TraceTimeline::Clear() {
+    // Only the producer may touch its head, so rings are cleared by a time
+    // cut instead: spans that started before it are skipped on export.
+    s_clearNs.store(Now(), std::memory_order_relaxed);
+}
+
+// ── Chrome trace export ──────────────────────────────────────────────
+
+bool TraceTimeline::WriteChromeTrace(const std::string& path) {
+    struct Track {
+        uint32_t tid;
+        std::string name;
+        std::vector<TraceSpanCopy> spans;
+    };
+    std::vector<Track> tracks;
+    {
+        TraceRegistry& reg = GetRegistry();
+        std::lock_guard<std::mutex> lock(reg.mutex);
+        tracks.reserve(reg.rings.size());
+        for (auto& r : reg.rings) {
+            Track t{r->tid, r->name, {}};
+            CopyRing(*r, t.spans);
+            tracks.push_back(std::move(t));
+        }
+    }
+
+    uint64_t cut = s_clearNs.load(std::memory_order_relaxed);
+    uint64_t origin = UINT64_MAX;
+    for (auto& t : tracks) {
+        t.spans.erase(std::remove_if(t.spans.begin(), t.spans.end(),
+                                     [cut](const TraceSpanCopy& s) { return s.startNs < cut || !s.name; }),
+                      t.spans.end());
+        for (const auto& s : t.spans) origin = std::min(origin, s.startNs);
+    }
+    if (origin == UINT64_MAX) origin = 0;
+
+    std::error_code ec;
+    std::filesystem::path parent = std::filesystem::path(path).parent_path();
+    if (!parent.empty()) std::filesystem::create_directories(parent, ec);
+
+    std::ofstream f(path, std::ios::out | std::ios::trunc);
+    if (!f) return false;
+
+    f << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    bool first = true;
+    char num[64];
+    for (const auto& t : tracks) {
+        f << (first ? "" : ",\n") << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"
+          << t.tid << ",\"args\":{\"name\":";
+        WriteJsonString(f, t.name.c_str());
+        f << "}}";
+        first = false;
+        for (const auto& s : t.spans) {
+            // Chrome timestamps are microseconds
+            std::snprintf(num, sizeof(num), ",\"ts\":%.3f,\"dur\":%.3f}",
+                          static_cast<double>(s.startNs - origin) / 1000.0,
+                          static_cast<double>(s.durNs) / 1000.0);
+            f << ",\n{\"name\":";
+            WriteJsonString(f, s.name);
+            f << ",\"ph\":\"X\",\"pid\":1,\"tid\":" << t.tid << num;
+        }
+    }
+    f << "\n]}\n";
+    return f.good();
+}
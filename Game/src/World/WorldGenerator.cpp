@@ -1,6 +1,10 @@
 #include "World/WorldGenerator.hpp"
 #include "World/Chunk.hpp"
+#include "World/CodecKernels.hpp"
+#include "World/ColumnStore.hpp"
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 
 WorldGenerator::WorldGenerator() {
     InitNoises();
@@ -155,13 +159,65 @@ ColumnInfo WorldGenerator::GetColumnInfo(int worldX, int worldZ) const {
     return {h, biome};
 }
 
+// ── Column store ─────────────────────────────────────────────────────
+
+const ColumnStore* WorldGenerator::GetActiveStore() const {
+    // A store built for another seed would hand back the wrong terrain
+    if (m_columnStore && m_columnStore->GetSeed() == m_seed) return m_columnStore;
+    return nullptr;
+}
+
+ColumnInfo WorldGenerator::GetColumnInfoCached(int worldX, int worldZ) const {
+    uint8_t height, biome;
+    if (const ColumnStore* store = GetActiveStore()) {
+        if (store->FindSurface(worldX, worldZ, height, biome))
+            return {height, static_cast<Biome>(biome)};
+    }
+    return GetColumnInfo(worldX, worldZ);
+}
+
+int WorldGenerator::MaxCyFromSurface(int maxH) {
+    // Ensure we at least reach sea level (water fills above terrain)
+    if (maxH < SEA_LEVEL) maxH = SEA_LEVEL;
+    // +16 margin for trees (same as IsChunkAboveTerrain), convert to chunk Y
+    int maxCy = (maxH + 16) / Chunk::SIZE;
+    if (maxCy > MAX_CHUNK_Y) maxCy = MAX_CHUNK_Y;
+    return maxCy;
+}
+
+void WorldGenerator::ComputeColumn(int cx, int cz, ColumnRecord& column) const {
+    std::memset(&column, 0, sizeof(column));
+    column.key = ColumnStore::PackKey(cx, cz);
+    for (int lz = 0; lz < Chunk::SIZE; ++lz) {
+        for (int lx = 0; lx < Chunk::SIZE; ++lx) {
+            ColumnInfo col = GetColumnInfo(cx * Chunk::SIZE + lx, cz * Chunk::SIZE + lz);
+            column.heights[lx + lz * Chunk::SIZE] = static_cast<uint8_t>(col.surfaceHeight);
+            column.biomes[lx + lz * Chunk::SIZE] = static_cast<uint8_t>(col.biome);
+        }
+    }
+
+    // Same 9 samples as GetMaxFilledChunkY so both paths agree
+    int maxH = 0;
+    for (int lx : {0, Chunk::SIZE - 1, Chunk::SIZE / 2})
+        for (int lz : {0, Chunk::SIZE - 1, Chunk::SIZE / 2})
+            maxH = std::max(maxH, static_cast<int>(column.heights[lx + lz * Chunk::SIZE]));
+    column.maxCy = static_cast<uint8_t>(MaxCyFromSurface(maxH));
+}
+
 // Public convenience wrappers (for external callers like IsChunkAboveTerrain)
 Biome WorldGenerator::GetBiome(int worldX, int worldZ) const {
-    return GetColumnInfo(worldX, worldZ).biome;
+    return GetColumnInfoCached(worldX, worldZ).biome;
 }
 
 int WorldGenerator::GetSurfaceHeight(int worldX, int worldZ) const {
-    return GetColumnInfo(worldX, worldZ).surfaceHeight;
+    return GetColumnInfoCached(worldX, worldZ).surfaceHeight;
+}
+
+void WorldGenerator::GetColumn(int cx, int cz, ColumnRecord& out) const {
+    const ColumnStore* store = GetActiveStore();
+    if (store && store->Find(cx, cz, out)) return;
+    ComputeColumn(cx, cz, out);
+    if (store) m_columnStore->Insert(out);
 }
 
 bool WorldGenerator::IsCave(int worldX, int worldY, int worldZ) const {
@@ -221,7 +277,7 @@ void WorldGenerator::PlaceTrees(Chunk* chunk) const {
             int treeZ = cellZ * CELL_SIZE + static_cast<int>((h >> 8) % CELL_SIZE);
 
             // Use combined query to avoid redundant noise evaluations
-            ColumnInfo col = GetColumnInfo(treeX, treeZ);
+            ColumnInfo col = GetColumnInfoCached(treeX, treeZ);
 
             // Biome density check
             float density;
@@ -295,30 +351,42 @@ void WorldGenerator::Generate(Chunk* chunk) const {
     int chunkBaseY = chunk->GetChunkY() * Chunk::SIZE;
     int chunkBaseZ = chunk->GetChunkZ() * Chunk::SIZE;
 
+    // Heights and biomes for the whole column — from the store when this
+    // column was generated before, otherwise one noise pass (then stored)
+    const ColumnStore* store = GetActiveStore();
+    ColumnRecord column;
+    bool haveColumn = store && store->Find(chunk->GetChunkX(), chunk->GetChunkZ(), column);
+
     // Quick reject with increased margin for trees
     int maxH = 0;
     int samples[][2] = {
-        {chunkBaseX, chunkBaseZ},
-        {chunkBaseX + Chunk::SIZE - 1, chunkBaseZ},
-        {chunkBaseX, chunkBaseZ + Chunk::SIZE - 1},
-        {chunkBaseX + Chunk::SIZE - 1, chunkBaseZ + Chunk::SIZE - 1},
-        {chunkBaseX + Chunk::SIZE / 2, chunkBaseZ + Chunk::SIZE / 2}
+        {0, 0},
+        {Chunk::SIZE - 1, 0},
+        {0, Chunk::SIZE - 1},
+        {Chunk::SIZE - 1, Chunk::SIZE - 1},
+        {Chunk::SIZE / 2, Chunk::SIZE / 2}
     };
     for (auto& s : samples) {
-        int h = GetSurfaceHeight(s[0], s[1]);
+        int h = haveColumn ? column.heights[s[0] + s[1] * Chunk::SIZE]
+                           : GetSurfaceHeight(chunkBaseX + s[0], chunkBaseZ + s[1]);
         if (h > maxH) maxH = h;
     }
     if (maxH < SEA_LEVEL) maxH = SEA_LEVEL;
     maxH += 16;
     if (chunkBaseY > maxH) return;
 
+    if (!haveColumn) {
+        ComputeColumn(chunk->GetChunkX(), chunk->GetChunkZ(), column);
+        if (store) m_columnStore->Insert(column);
+    }
+
     for (int lx = 0; lx < Chunk::SIZE; ++lx) {
         int worldX = chunkBaseX + lx;
         for (int lz = 0; lz < Chunk::SIZE; ++lz) {
             int worldZ = chunkBaseZ + lz;
 
-            // Single noise evaluation for both height and biome
-            ColumnInfo col = GetColumnInfo(worldX, worldZ);
+            ColumnInfo col = {column.heights[lx + lz * Chunk::SIZE],
+                              static_cast<Biome>(column.biomes[lx + lz * Chunk::SIZE])};
 
             for (int ly = 0; ly < Chunk::SIZE; ++ly) {
                 int worldY = chunkBaseY + ly;
@@ -415,11 +483,8 @@ void WorldGenerator::Generate(Chunk* chunk) const {
 
 bool WorldGenerator::IsChunkEmpty(const Chunk* chunk) const {
     const uint8_t* data = chunk->GetBlockData();
-    for (int i = 0; i < Chunk::VOLUME; ++i) {
-        if (data[i] != static_cast<uint8_t>(BlockType::Air))
-            return false;
-    }
-    return true;
+    return data[0] == static_cast<uint8_t>(BlockType::Air) &&
+           CodecKernels::IsUniform(data, Chunk::VOLUME);
 }
 
 bool WorldGenerator::IsChunkFullySolid(const Chunk* chunk) const {
@@ -432,6 +497,11 @@ bool WorldGenerator::IsChunkFullySolid(const Chunk* chunk) const {
 }
 
 int WorldGenerator::GetMaxFilledChunkY(int cx, int cz) const {
+    int storedMaxCy;
+    if (const ColumnStore* store = GetActiveStore()) {
+        if (store->FindMaxCy(cx, cz, storedMaxCy)) return storedMaxCy;
+    }
+
     int baseX = cx * Chunk::SIZE;
     int baseZ = cz * Chunk::SIZE;
     int maxH = 0;
@@ -442,12 +512,7 @@ int WorldGenerator::GetMaxFilledChunkY(int cx, int cz) const {
             int h = GetSurfaceHeight(x, z);
             if (h > maxH) maxH = h;
         }
-    // Ensure we at least reach sea level (water fills above terrain)
-    if (maxH < SEA_LEVEL) maxH = SEA_LEVEL;
-    // +16 margin for trees (same as IsChunkAboveTerrain), convert to chunk Y
-    int maxCy = (maxH + 16) / Chunk::SIZE;
-    if (maxCy > MAX_CHUNK_Y) maxCy = MAX_CHUNK_Y;
-    return maxCy;
+    return MaxCyFromSurface(maxH);
 }
 
 bool WorldGenerator::IsChunkAboveTerrain(int cx, int cy, int cz) const {
@@ -0,0 +1,245 @@
+#!/usr/bin/env python3
+"""
+SleakCraft Performance Regression Gate
+Usage: python perf_gate.py check  <baseline.json> [...] [--bin bin] [--repeat N] [--keep dir]
+       python perf_gate.py check  <baseline.json> --results run1.json [run2.json ...]
+       python perf_gate.py update <baseline.json> [...] [--bin bin] [--repeat N]
+
+Runs the benchmark command stored in each baseline N times, takes the median
+of every gated metric and compares it with the checked-in value. A metric
+regresses when its median is worse than the baseline by more than its
+tolerance (relative). Prints a diff table and exits 1 on any regression or
+missing metric, 2 on usage / benchmark failures.
+
+`update` re-runs the benchmarks and rewrites the baseline values in place,
+keeping the metric list, directions and tolerances. Baselines are only
+meaningful on the machine they were recorded on: refresh them there.
+
+Baseline format (Bench/baselines/*.json):
+  {
+    "benchmark": "world_micro",                 # must match the run's "benchmark"
+    "command": ["SleakMicroBench", "--json", "{out}"],
+    "repeat": 5,                                # default N (median-of-N)
+    "tolerance": 0.15,                          # default relative tolerance
+    "metrics": {
+      "noise.fbm2d.oct4/ns_per_op": {"value": 337.9, "better": "lower"},
+      "scalar/region_load_mbps":    {"value": 610.0, "better": "higher", "tolerance": 0.25}
+    }
+  }
+
+Metric keys are "<row id>/<field>", where the row id joins the string/id
+fields of a "results" entry (name, tier, scenario, codec, render_distance,
+workers) with ':'.
+"""
+
+import sys
+import json
+import math
+import argparse
+import subprocess
+import tempfile
+from pathlib import Path
+
+
+# ──────────────────────────────────────────────────────────────────────────────
+# Benchmark JSON → flat metrics
+# ──────────────────────────────────────────────────────────────────────────────
+
+ID_FIELDS = ("name", "tier", "scenario", "codec", "render_distance", "workers")
+
+
+def row_id(row):
+    parts = [str(row[k]) for k in ID_FIELDS if k in row]
+    return ":".join(parts) if parts else "?"
+
+
+def flatten(doc):
+    """Return {metric key: float} for every numeric field of every result row."""
+    metrics = {}
+    for row in doc.get("results", []):
+        rid = row_id(row)
+        for key, val in row.items():
+            if key in ID_FIELDS or isinstance(val, bool):
+                continue
+            if isinstance(val, (int, float)):
+                metrics[f"{rid}/{key}"] = float(val)
+    return metrics
+
+
+def load_json(path):
+    with open(path, "r", encoding="utf-8") as f:
+        return json.load(f)
+
+
+# ──────────────────────────────────────────────────────────────────────────────
+# Running benchmarks
+# ──────────────────────────────────────────────────────────────────────────────
+
+def run_benchmark(baseline, bin_dir, repeat, keep_dir):
+    """Run the baseline's command `repeat` times; returns a list of JSON docs."""
+    command = baseline.get("command")
+    if not command:
+        raise RuntimeError("baseline has no \"command\"; pass --results instead")
+
+    exe = Path(bin_dir) / command[0]
+    if not exe.exists() and Path(str(exe) + ".exe").exists():
+        exe = Path(str(exe) + ".exe")
+    if not exe.exists():
+        raise RuntimeError(f"benchmark executable not found: {exe}")
+
+    runs = []
+    with tempfile.TemporaryDirectory() as tmp:
+        out_dir = Path(keep_dir) if keep_dir else Path(tmp)
+        out_dir.mkdir(parents=True, exist_ok=True)
+        for i in range(repeat):
+            out = out_dir / f"{baseline['benchmark']}_run{i + 1}.json"
+            args = [str(exe)] + [a.replace("{out}", str(out)) for a in command[1:]]
+            print(f"  [{i + 1}/{repeat}] {' '.join(args)}", flush=True)
+            proc = subprocess.run(args, stdout=subprocess.DEVNULL)
+            if proc.returncode != 0:
+                raise RuntimeError(f"{command[0]} exited with code {proc.returncode}")
+            runs.append(load_json(out))
+    return runs
+
+
+# ──────────────────────────────────────────────────────────────────────────────
+# Statistics helpers
+# ──────────────────────────────────────────────────────────────────────────────
+
+def median(values):
+    s = sorted(values)
+    n = len(s)
+    if n == 0:
+        return math.nan
+    mid = n // 2
+    return s[mid] if n % 2 else 0.5 * (s[mid - 1] + s[mid])
+
+
+def spread(values):
+    """Relative half-range of the runs around their median (noise estimate)."""
+    m = median(values)
+    if len(values) < 2 or m == 0:
+        return 0.0
+    return (max(values) - min(values)) * 0.5 / abs(m)
+
+
+def medians(runs, keys):
+    """{key: (median, spread)} over all runs that report the key."""
+    flat = [flatten(doc) for doc in runs]
+    out = {}
+    for key in keys:
+        vals = [f[key] for f in flat if key in f]
+        if vals:
+            out[key] = (median(vals), spread(vals))
+    return out
+
+
+# ──────────────────────────────────────────────────────────────────────────────
+# Commands
+# ──────────────────────────────────────────────────────────────────────────────
+
+def collect(baseline, args):
+    if args.results:
+        runs = [load_json(p) for p in args.results]
+    else:
+        repeat = args.repeat or baseline.get("repeat", 5)
+        runs = run_benchmark(baseline, args.bin, repeat, args.keep)
+
+    for doc in runs:
+        if doc.get("benchmark") != baseline["benchmark"]:
+            raise RuntimeError(f"run is \"{doc.get('benchmark')}\", baseline expects "
+                               f"\"{baseline['benchmark']}\"")
+    return runs
+
+
+def check(path, args):
+    baseline = load_json(path)
+    print(f"\n{baseline['benchmark']}  ({path})")
+    runs = collect(baseline, args)
+    gated = baseline.get("metrics", {})
+    current = medians(runs, gated.keys())
+    default_tol = baseline.get("tolerance", 0.10)
+
+    failures = 0
+    width = max([len(k) for k in gated] + [6])
+    print(f"  {'metric':<{width}} {'baseline':>12} {'median':>12} {'delta':>9} "
+          f"{'tol':>6} {'noise':>7}  status")
+    print(f"  {'-' * width} {'-' * 12} {'-' * 12} {'-' * 9} {'-' * 6} {'-' * 7}  ------")
+    for key, spec in gated.items():
+        base = float(spec["value"])
+        tol = float(spec.get("tolerance", default_tol))
+        if key not in current:
+            print(f"  {key:<{width}} {base:>12.4g} {'-':>12} {'-':>9} {tol:>6.0%} {'-':>7}  MISSING")
+            failures += 1
+            continue
+
+        med, noise = current[key]
+        delta = (med - base) / base if base != 0 else 0.0
+        # Positive "worse" = slower / smaller throughput than the baseline
+        worse = delta if spec.get("better", "lower") == "lower" else -delta
+        if worse > tol:
+            status = "REGRESSED"
+            failures += 1
+        elif worse < -tol:
+            status = "improved"
+        else:
+            status = "ok"
+        if noise > tol and status != "ok":
+            status += " (noisy)"
+        print(f"  {key:<{width}} {base:>12.4g} {med:>12.4g} {delta:>+9.1%} "
+              f"{tol:>6.0%} {noise:>7.1%}  {status}")
+
+    print(f"  {len(gated) - failures}/{len(gated)} metrics within tolerance")
+    return failures
+
+
+def update(path, args):
+    baseline = load_json(path)
+    print(f"\n{baseline['benchmark']}  ({path})")
+    runs = collect(baseline, args)
+    gated = baseline.get("metrics", {})
+    current = medians(runs, gated.keys())
+
+    for key, spec in gated.items():
+        if key not in current:
+            print(f"  {key}: not reported by the benchmark, kept {spec['value']}")
+            continue
+        old = spec["value"]
+        spec["value"] = float(f"{current[key][0]:.6g}")
+        print(f"  {key}: {old} -> {spec['value']}  (noise {current[key][1]:.1%})")
+
+    with open(path, "w", encoding="utf-8") as f:
+        json.dump(baseline, f, indent=2)
+        f.write("\n")
+    return 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compare benchmark runs against checked-in baselines.")
+    parser.add_argument("mode", choices=("check", "update"))
+    parser.add_argument("baselines", nargs="+", help="baseline JSON files")
+    parser.add_argument("--bin", default="bin", help="directory holding the benchmark executables")
+    parser.add_argument("--repeat", type=int, default=0, help="runs per benchmark (median-of-N)")
+    parser.add_argument("--results", nargs="+", help="use existing run JSON files instead of running")
+    parser.add_argument("--keep", help="keep the per-run JSON files in this directory")
+    args = parser.parse_args()
+
+    if args.results and len(args.baselines) != 1:
+        print("--results needs exactly one baseline", file=sys.stderr)
+        return 2
+
+    failures = 0
+    for path in args.baselines:
+        try:
+            failures += (check if args.mode == "check" else update)(path, args)
+        except (OSError, RuntimeError, ValueError, KeyError) as e:
+            print(f"  error: {e}", file=sys.stderr)
+            return 2
+
+    if args.mode == "check":
+        print(f"\n{'FAIL' if failures else 'PASS'}: {failures} regression(s)")
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())